@@ -2,11 +2,17 @@
 #define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERS_H
 
 #include "s21_containers/AVLTree/AVLTree.h"
+#include "s21_containers/AVLTree/IndexedRedBlackTree.h"
 #include "s21_containers/list/s21_list.h"
 #include "s21_containers/map/s21_map.h"
+#include "s21_containers/policy/s21_execution_policy.h"
+#include "s21_containers/policy/s21_pool_allocator.h"
+#include "s21_containers/policy/s21_storage_policy.h"
 #include "s21_containers/queue/s21_queue.h"
 #include "s21_containers/set/s21_set.h"
 #include "s21_containers/stack/s21_stack.h"
+#include "s21_containers/thread_pool/s21_thread_pool.h"
 #include "s21_containers/vector/s21_vector.h"
+#include "s21_containers/ws_deque/s21_ws_deque.h"
 
 #endif
\ No newline at end of file
@@ -1,19 +1,37 @@
 #ifndef S21_CONTAINERS_SRC_S21_CONTAINERS_AVLTREE_S21_AVLTREE_H
 #define S21_CONTAINERS_SRC_S21_CONTAINERS_AVLTREE_S21_AVLTREE_H
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <limits>
+#include <type_traits>
 #include <vector>
 
-namespace s21 {
-enum RedBlackTreeColor { pBlack, pRed };
+#include "../policy/s21_execution_policy.h"
+#include "../policy/s21_storage_policy.h"
+#include "RedBlackTreeNode.h"
 
-template <typename Key, typename Comparator = std::less<Key>>
-class RedBlackTree {
+namespace s21 {
+/**
+ * @brief Красно-черное дерево, на котором построены set, map и multiset.
+ *
+ * @tparam Key Тип ключа
+ * @tparam Comparator Функция сравнения ключей. Компаратор без состояния
+ * хранится как пустой базовый класс и не увеличивает размер дерева
+ * @tparam Storage Политика хранения tree_policy<Layout, Allocator> (см.
+ * s21_storage_policy.h) или только тег раскладки узла:
+ * RedBlackTreeDefaultLayout (цвет в отдельном поле) или
+ * RedBlackTreeCompactLayout (цвет в младшем бите указателя на родителя)
+ */
+template <typename Key, typename Comparator = std::less<Key>,
+          typename Storage = tree_policy<>>
+class RedBlackTree : private detail::EmptyBaseHolder<Comparator> {
  private:
-  struct RedBlackTreeNode;
   struct RedBlackTreeIterator;
   struct RedBlackTreeIteratorConst;
+  using CompareHolder = detail::EmptyBaseHolder<Comparator>;
 
  public:
   using key_type = Key;
@@ -24,15 +42,34 @@ class RedBlackTree {
   using size_type = std::size_t;
 
   using tree_type = RedBlackTree;
-  using tree_node = RedBlackTreeNode;
+  using policy_type = typename tree_policy_traits<Storage>::type;
+  using layout_type = typename policy_type::layout_type;
+  using tree_node = RedBlackTreeNode<key_type, layout_type>;
   using tree_color = RedBlackTreeColor;
+  using allocator_type =
+      typename policy_type::template allocator_type<tree_node>;
+
+  static_assert(alignof(tree_node) > 1,
+                "RedBlackTree: младший бит адреса узла должен быть свободен");
+  static_assert(!std::is_same_v<layout_type, RedBlackTreePrefixLayout> ||
+                    detail::PrefixOrdered<Comparator>::value,
+                "RedBlackTreePrefixLayout requires a bytewise string "
+                "comparator (std::less)");
 
   /**
    * @brief Конструктор по умолчанию для класса RedBlackTree.
    *
    * Создает пустое дерево с начальным размером 0.
    */
-  RedBlackTree() : head_(new tree_node), size_(0U) {}
+  RedBlackTree() : head_(CreateNode()), size_(0U) {}
+
+  /**
+   * @brief Создает пустое дерево с заданной функцией сравнения.
+   *
+   * @param cmp Функция сравнения ключей
+   */
+  explicit RedBlackTree(const Comparator &cmp)
+      : CompareHolder(cmp), head_(CreateNode()), size_(0U) {}
 
   /**
    * @brief Конструктор копирования для класса RedBlackTree.
@@ -41,7 +78,7 @@ class RedBlackTree {
    *
    * Создает новое дерево и копирует в него элементы из заданного дерева.
    */
-  RedBlackTree(const tree_type &other) : RedBlackTree() {
+  RedBlackTree(const tree_type &other) : RedBlackTree(other.KeyComp()) {
     if (other.Size() > 0) {
       CopyTreeFromOther(other);
     }
@@ -54,7 +91,9 @@ class RedBlackTree {
    *
    * Создает новое дерево и перемещает в него элементы из заданного дерева.
    */
-  RedBlackTree(tree_type &&other) noexcept : RedBlackTree() { Swap(other); }
+  RedBlackTree(tree_type &&other) noexcept : RedBlackTree(other.KeyComp()) {
+    Swap(other);
+  }
 
   /**
    * @brief Оператор присваивания копирования для класса RedBlackTree.
@@ -100,7 +139,7 @@ class RedBlackTree {
    */
   ~RedBlackTree() {
     Clear();
-    delete head_;
+    DestroyNode(head_);
     head_ = nullptr;
   }
 
@@ -124,6 +163,11 @@ class RedBlackTree {
    */
   size_type Size() const noexcept { return size_; }
 
+  /**
+   * @brief Функция сравнения ключей дерева.
+   */
+  const Comparator &KeyComp() const noexcept { return CompareHolder::Get(); }
+
   /**
    * @brief Проверяет, пуст ли дерево.
    *
@@ -205,19 +249,19 @@ class RedBlackTree {
         // Отцепляем узел от других узлов в other
 
         if (moving_node->left_ != nullptr) {
-          moving_node->left_->parent_ = moving_node->parent_;
+          moving_node->left_->SetParent(moving_node->Parent());
         }
 
         if (moving_node->right_ != nullptr) {
-          moving_node->right_->parent_ = moving_node->parent_;
+          moving_node->right_->SetParent(moving_node->Parent());
         }
 
-        if (moving_node->parent_->left_ == moving_node) {
-          moving_node->parent_->left_ = nullptr;
+        if (moving_node->Parent()->left_ == moving_node) {
+          moving_node->Parent()->left_ = nullptr;
         }
 
-        if (moving_node->parent_->right_ == moving_node) {
-          moving_node->parent_->right_ = nullptr;
+        if (moving_node->Parent()->right_ == moving_node) {
+          moving_node->Parent()->right_ = nullptr;
         }
 
         // Приводим узел к виду по умолчанию
@@ -275,7 +319,7 @@ class RedBlackTree {
    * свойствам красно-черного дерева.
    */
   iterator Insert(const key_type &key) {
-    tree_node *new_node = new tree_node{key};
+    tree_node *new_node = CreateNode(key);
     return Insert(Root(), new_node, false).first;
   }
 
@@ -290,11 +334,11 @@ class RedBlackTree {
    * (false, если вставка не произошла
    */
   std::pair<iterator, bool> InsertUnique(const key_type &key) {
-    tree_node *new_node = new tree_node{key};
+    tree_node *new_node = CreateNode(key);
     std::pair<iterator, bool> result = Insert(Root(), new_node, true);
     if (result.second == false)
       // Если вставка не произошла, то удаляем созданный узел
-      delete new_node;
+      DestroyNode(new_node);
 
     return result;
   }
@@ -331,7 +375,7 @@ class RedBlackTree {
     result.reserve(sizeof...(args));
 
     for (auto item : {std::forward<Args>(args)...}) {
-      tree_node *new_node = new tree_node(std::move(item));
+      tree_node *new_node = CreateNode(std::move(item));
       std::pair<iterator, bool> result_insert = Insert(Root(), new_node, false);
       result.push_back(result_insert);
     }
@@ -359,15 +403,70 @@ class RedBlackTree {
     result.reserve(sizeof...(args));
 
     for (auto item : {std::forward<Args>(args)...}) {
-      tree_node *new_node = new tree_node(std::move(item));
+      tree_node *new_node = CreateNode(std::move(item));
       std::pair<iterator, bool> result_insert = Insert(Root(), new_node, true);
-      if (result_insert.second == false) delete new_node;
+      if (result_insert.second == false) DestroyNode(new_node);
       result.push_back(result_insert);
     }
 
     return result;
   }
 
+  /**
+   * @brief Вставляет пакет элементов [first, last) за один проход по дереву.
+   *
+   * @details Сначала для всех элементов создаются узлы, указатели на них
+   * сортируются (стабильно), и вставка идет в порядке возрастания ключей.
+   * Каждый следующий ключ не меньше предыдущего, поэтому поиск места
+   * начинается не от корня, а от последнего вставленного узла (finger):
+   * поднимаемся от него до ближайшего поддерева, в диапазон которого попадает
+   * новый ключ, и спускаемся уже внутри него. Для плотных пакетов подъем и
+   * спуск занимают O(1) уровней вместо O(log n), и верхние уровни дерева
+   * почти не трогаются.
+   *
+   * @param first, last Диапазон вставляемых элементов
+   * @param unique_only Если true, элементы с уже существующими ключами не
+   * вставляются; из одинаковых ключей внутри пакета вставляется первый
+   * @return size_type Количество вставленных элементов
+   */
+  template <typename InputIt>
+  size_type InsertBatch(InputIt first, InputIt last, bool unique_only) {
+    std::vector<tree_node *> nodes = MakeSortedNodes(first, last);
+    try {
+      // После стабильной сортировки первый из равных - первый во входе
+      if (unique_only) DeleteEqualNodes(nodes, true);
+      return InsertSortedNodes(nodes, unique_only,
+                               [](key_type &, key_type &&) {});
+    } catch (...) {
+      DestroyNodes(nodes);
+      throw;
+    }
+  }
+
+  /**
+   * @brief Пакетная вставка с обновлением (upsert): новые ключи вставляются,
+   * а для существующих вызывается assign(existing, std::move(incoming)).
+   *
+   * @details Работает как InsertBatch() с unique_only = true, но из
+   * одинаковых ключей внутри пакета побеждает последний (как при
+   * последовательных присваиваниях).
+   *
+   * @param first, last Диапазон элементов
+   * @param assign Функция обновления существующего элемента
+   * @return size_type Количество вставленных (новых) элементов
+   */
+  template <typename InputIt, typename Assign>
+  size_type UpsertBatch(InputIt first, InputIt last, Assign assign) {
+    std::vector<tree_node *> nodes = MakeSortedNodes(first, last);
+    try {
+      DeleteEqualNodes(nodes, false);
+      return InsertSortedNodes(nodes, true, assign);
+    } catch (...) {
+      DestroyNodes(nodes);
+      throw;
+    }
+  }
+
   /**
    * @brief Находит элемент с ключом, эквивалентным key. Стандарт не
    * регулирует, какой именно элемент будет найден, если их несколько, но в
@@ -380,7 +479,7 @@ class RedBlackTree {
   iterator Find(const_reference key) {
     iterator result = LowerBound(key);
 
-    if (result == End() || cmp_(key, *result))
+    if (result == End() || KeyLess(key, PrefixOf(key), result.node_))
       // Если LowerBound() ничего не нашел или нашел элемент > key
       return End();
 
@@ -409,9 +508,10 @@ class RedBlackTree {
   iterator LowerBound(const_reference key) {
     tree_node *start = Root();
     tree_node *result = End().node_;
+    const prefix_type prefix = PrefixOf(key);
 
     while (start != nullptr) {
-      if (!cmp_(start->key_, key)) {
+      if (!NodeLess(start, key, prefix)) {
         // Если найден элемент не меньше key, то запоминаем его как
         // предварительный результат поисков (т.е. как минимум один
         // элемент уже найден), далее в цикле будем обновлять этот
@@ -446,9 +546,10 @@ class RedBlackTree {
   iterator UpperBound(const_reference key) {
     tree_node *start = Root();
     tree_node *result = End().node_;
+    const prefix_type prefix = PrefixOf(key);
 
     while (start != nullptr) {
-      if (cmp_(key, start->key_)) {
+      if (KeyLess(key, prefix, start)) {
         // Если искомое значение меньше значения узла, то запоминаем
         // текущий узел, т.к. он больше искомого
         result = start;
@@ -465,6 +566,57 @@ class RedBlackTree {
     return iterator(result);
   }
 
+  /**
+   * @brief Пакетный поиск: для каждого ключа из [first, last) записывает в out
+   * результат Find() (итератор найденного элемента или End()).
+   *
+   * @details Одиночный спуск по дереву упирается в промахи кэша: следующий
+   * узел нельзя загрузить, пока не сравнили текущий. Здесь ключи
+   * обрабатываются группами по kFindManyGroupSize: на каждом шаге все поиски
+   * группы продвигаются на один уровень вниз, и для каждого следующего узла
+   * сразу выдается __builtin_prefetch. Пока идут сравнения в остальных поисках
+   * группы, узел успевает загрузиться, и промахи разных поисков
+   * перекрываются (group prefetching).
+   *
+   * @tparam ForwardIt Итератор по искомым ключам (нужен многопроходный, т.к.
+   * ключи группы читаются на каждом уровне)
+   * @tparam OutputIt Итератор вывода, принимающий iterator
+   * @tparam KeyCompare Функция сравнения, которую можно вызвать как
+   * cmp(node_key, key) и cmp(key, node_key). Позволяет искать в словаре по
+   * ключу, не собирая пару ключ-значение
+   * @return Итератор вывода за последним записанным результатом
+   */
+  template <typename ForwardIt, typename OutputIt, typename KeyCompare>
+  OutputIt FindMany(ForwardIt first, ForwardIt last, OutputIt out,
+                    const KeyCompare &cmp) {
+    ForEachFound(first, last, cmp, [this, &out](tree_node *node) {
+      *out++ = iterator(node == nullptr ? head_ : node);
+    });
+    return out;
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt FindMany(ForwardIt first, ForwardIt last, OutputIt out) {
+    return FindMany(first, last, out, KeyComp());
+  }
+
+  /**
+   * @brief Пакетная проверка наличия ключей, аналог FindMany(), записывающий в
+   * out значения bool.
+   */
+  template <typename ForwardIt, typename OutputIt, typename KeyCompare>
+  OutputIt ContainsMany(ForwardIt first, ForwardIt last, OutputIt out,
+                        const KeyCompare &cmp) {
+    ForEachFound(first, last, cmp,
+                 [&out](tree_node *node) { *out++ = node != nullptr; });
+    return out;
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt ContainsMany(ForwardIt first, ForwardIt last, OutputIt out) {
+    return ContainsMany(first, last, out, KeyComp());
+  }
+
   /**
    * @brief Удаляет узел из дерева по итератору.
    *
@@ -473,7 +625,7 @@ class RedBlackTree {
    * @details Метод удаляет узел из двоичного дерева поиска, используя итератор
    * для указания на удаляемый узел. Сначала вызывается метод ExtractNode,
    * который извлекает узел из дерева, сохраняя его структуру. Затем удаляемый
-   * узел освобождается с помощью оператора delete.
+   * узел освобождается через аллокатор узлов.
    *
    * @note Этот метод предназначен для использования в контексте классов,
    * реализующих двоичные деревья поиска, где итераторы используются для доступа
@@ -481,7 +633,7 @@ class RedBlackTree {
    */
   void Erase(iterator pos) noexcept {
     tree_node *result = ExtractNode(pos);
-    delete result;
+    DestroyNode(result);
   }
 
   /**
@@ -504,7 +656,8 @@ class RedBlackTree {
   void Swap(tree_type &other) noexcept {
     std::swap(head_, other.head_);
     std::swap(size_, other.size_);
-    std::swap(cmp_, other.cmp_);
+    using std::swap;
+    swap(CompareHolder::Get(), other.CompareHolder::Get());
   }
 
   /**
@@ -526,13 +679,13 @@ class RedBlackTree {
    */
   bool CheckTree() const noexcept {
     // head дерева должен быть красный.
-    if (head_->color_ == pBlack) return false;
+    if (head_->Color() == pBlack) return false;
 
     // Пустое дерево корректно всегда
     if (Root() == nullptr) return true;
 
     // Корень дерева должен быть чёрный.
-    if (Root()->color_ == pRed) return false;
+    if (Root()->Color() == pRed) return false;
 
     // Оба потомка каждого красного узла — чёрные.
     if (CheckRedNodes(Root()) == false) return false;
@@ -544,9 +697,536 @@ class RedBlackTree {
     // Если всё ок, то возвращаем true
     return true;
   }
-  tree_node *&GetRoot() { return head_->parent_; }
+  tree_node *GetRoot() { return head_->Parent(); }
+
+  /**
+   * @brief Делит диапазон [first, last) на две непустые части по структуре
+   * дерева (для параллельной обработки поддеревьев).
+   *
+   * @details Точка деления - наименьший общий предок первого и последнего
+   * элементов диапазона: слева от него лежит часть левого поддерева, справа -
+   * часть правого. Для всего дерева это корень, т.е. деление на левое и правое
+   * поддеревья. Если общий предок совпадает с first (first - предок
+   * последнего элемента), то берется общий предок следующего за first
+   * элемента и последнего. Работает за O(высота дерева) без обхода элементов.
+   *
+   * @tparam It iterator или const_iterator дерева
+   * @return It Итератор mid, такой что [first, mid) и [mid, last) не пусты,
+   * или last, если в диапазоне меньше двух элементов
+   */
+  template <typename It>
+  static It SplitRange(It first, It last) noexcept {
+    if (first == last) return last;
+    It back = last;
+    --back;
+    if (first == back) return last;
+
+    It lower = first;
+    auto mid = CommonAncestor(lower.node_, back.node_);
+    if (mid == first.node_) {
+      ++lower;
+      mid = CommonAncestor(lower.node_, back.node_);
+    }
+    return It(mid);
+  }
+
+  /**
+   * @brief Заменяет содержимое дерева элементами [first, last), строя
+   * сбалансированное дерево за O(n) после сортировки.
+   *
+   * @details Элементы устойчиво сортируются s21::stable_sort (если ключи
+   * нельзя переставлять - сортируются указатели на их узлы), при unique_only
+   * из равных оставляется первый. Узлы создаются параллельно, если это
+   * позволяет политика. Затем дерево собирается снизу вверх: корень каждого
+   * поддерева - средний узел его диапазона, и верхние уровни рекурсии
+   * выполняются параллельно. В таком дереве все листья лежат на двух
+   * последних уровнях, поэтому достаточно покрасить самый нижний уровень в
+   * красный, а остальные узлы - в черный.
+   *
+   * Если создание узла или сравнение выбросит исключение, все созданные узлы
+   * удаляются, а дерево остается без изменений.
+   *
+   * @param policy Политика выполнения (s21::execution::seq или par)
+   * @param first, last Диапазон элементов
+   * @param unique_only Удалять ли элементы с равными ключами
+   */
+  template <typename Policy, typename InputIt>
+  void Build(Policy &&policy, InputIt first, InputIt last, bool unique_only) {
+    std::vector<tree_node *> nodes;
+    if constexpr (std::is_move_assignable_v<key_type>) {
+      // Ключи, которые можно переставлять, сортируем сами по себе: так
+      // сравнения идут по плотному массиву, а узлы потом выделяются в
+      // порядке ключей и лучше ложатся в память для обхода
+      std::vector<key_type> keys(first, last);
+      detail::StableSort(policy, keys.begin(), keys.end(), KeyComp());
+      if (unique_only) {
+        auto equal = [this](const_reference lhs, const_reference rhs) {
+          return !KeyComp()(lhs, rhs);
+        };
+        keys.erase(std::unique(keys.begin(), keys.end(), equal), keys.end());
+      }
+      nodes = MakeNodes(policy, std::make_move_iterator(keys.begin()),
+                        std::make_move_iterator(keys.end()));
+    } else {
+      // Иначе (например, пары с константным ключом в map) сортируем
+      // указатели на узлы
+      nodes = MakeNodes(policy, first, last);
+      try {
+        SortNodes(policy, nodes);
+        if (unique_only) DeleteEqualNodes(nodes, true);
+      } catch (...) {
+        DestroyNodes(nodes);
+        throw;
+      }
+    }
+
+    Clear();
+    AttachSorted(policy, nodes);
+  }
+
+  /**
+   * @brief k-way слияние: переносит в дерево узлы из всех деревьев sources.
+   *
+   * @details Узлы не копируются и не пересоздаются, а переходят из исходных
+   * деревьев. Обходы всех деревьев (включая это) выполняются параллельно и
+   * дают отсортированные последовательности узлов; они сливаются
+   * detail::MergeRuns() (при параллельной политике - параллельно, устойчиво:
+   * из равных ключей первым идет узел этого дерева, затем узлы источников по
+   * порядку). Результат и остатки источников собираются снизу вверх за O(n),
+   * как в Build(), т.е. всего O(n log k) вместо O(n log n) при
+   * последовательных Merge().
+   *
+   * При unique_only узлы с ключами, которые уже есть в результате, остаются
+   * в своих деревьях-источниках (как в MergeUnique()).
+   *
+   * @param policy Политика выполнения (s21::execution::seq или par)
+   * @param sources Деревья-источники (это же дерево среди них пропускается)
+   * @param unique_only Оставлять ли в результате только уникальные ключи
+   */
+  template <typename Policy>
+  void MergeAll(Policy &&policy, const std::vector<tree_type *> &sources,
+                bool unique_only) {
+    std::vector<tree_type *> trees{this};
+    for (tree_type *source : sources)
+      if (source != this && source->size_ > 0) trees.push_back(source);
+    if (trees.size() == 1) return;
+
+    // Узел вместе с номером дерева, из которого он взят
+    struct SourceNode {
+      tree_node *node;
+      size_type tree;
+    };
+    std::vector<size_type> offsets{0};
+    for (tree_type *tree : trees)
+      offsets.push_back(offsets.back() + tree->size_);
+    std::vector<SourceNode> nodes(offsets.back());
+    detail::ForEachIndex(policy, trees.size(), [&](size_type t) {
+      size_type index = offsets[t];
+      for (iterator it = trees[t]->Begin(); it != trees[t]->End(); ++it)
+        nodes[index++] = {it.node_, t};
+    });
+    detail::MergeRuns(policy, nodes.begin(), offsets,
+                      [this](const SourceNode &lhs, const SourceNode &rhs) {
+                        return KeyComp()(lhs.node->key_, rhs.node->key_);
+                      });
+
+    // Раскладываем узлы: в результат или (дубликаты) обратно в источник
+    std::vector<tree_node *> merged;
+    std::vector<std::vector<tree_node *>> leftovers(trees.size());
+    merged.reserve(nodes.size());
+    for (const SourceNode &item : nodes) {
+      if (unique_only && !merged.empty() &&
+          !KeyComp()(merged.back()->key_, item.node->key_)) {
+        leftovers[item.tree].push_back(item.node);
+      } else {
+        merged.push_back(item.node);
+      }
+    }
+
+    // Все узлы теперь принадлежат векторам, деревья просто отпускают их
+    for (tree_type *tree : trees) {
+      tree->InitializeHead();
+      tree->size_ = 0;
+    }
+    AttachSorted(policy, merged);
+    detail::ForEachIndex(policy, trees.size() - 1, [&](size_type t) {
+      trees[t + 1]->AttachSorted(policy, leftovers[t + 1]);
+    });
+  }
 
  private:
+  /**
+   * @brief Создает узлы для элементов [first, last) и стабильно сортирует
+   * указатели на них по ключу. Если создание узла или сравнение выбросит
+   * исключение, все созданные узлы удаляются, дерево не меняется.
+   */
+  template <typename InputIt>
+  std::vector<tree_node *> MakeSortedNodes(InputIt first, InputIt last) {
+    std::vector<tree_node *> nodes = MakeNodes(execution::seq, first, last);
+    try {
+      SortNodes(execution::seq, nodes);
+    } catch (...) {
+      DestroyNodes(nodes);
+      throw;
+    }
+    return nodes;
+  }
+
+  /**
+   * @brief Стабильно сортирует узлы по ключу.
+   *
+   * @details Сортируется копия указателей: если сравнение выбросит
+   * исключение посреди сортировки, nodes по-прежнему содержит каждый узел
+   * ровно один раз, и вызывающий может их удалить.
+   */
+  template <typename Policy>
+  void SortNodes(const Policy &policy, std::vector<tree_node *> &nodes) {
+    std::vector<tree_node *> sorted(nodes);
+    detail::StableSort(policy, sorted.begin(), sorted.end(),
+                       [this](const tree_node *lhs, const tree_node *rhs) {
+                         return KeyComp()(lhs->key_, rhs->key_);
+                       });
+    nodes.swap(sorted);
+  }
+
+  /**
+   * @brief Удаляет узлы, которые не попали в дерево.
+   */
+  static void DestroyNodes(const std::vector<tree_node *> &nodes) noexcept {
+    for (tree_node *node : nodes) DestroyNode(node);
+  }
+
+  /**
+   * @brief Создает по узлу на каждый элемент [first, last) в порядке входа.
+   * При ошибке удаляет уже созданные узлы и пробрасывает исключение.
+   */
+  template <typename Policy, typename InputIt>
+  std::vector<tree_node *> MakeNodes(const Policy &policy, InputIt first,
+                                     InputIt last) {
+    std::vector<tree_node *> nodes;
+    try {
+      if constexpr (detail::is_random_access_v<InputIt>) {
+        nodes.resize(static_cast<size_type>(last - first), nullptr);
+        std::vector<InputIt> bounds = detail::SplitRange(
+            first, last, size_type{1} << detail::ParallelDepth(policy));
+        detail::ForEachIndex(policy, bounds.size() - 1, [&](size_type i) {
+          for (InputIt it = bounds[i]; it != bounds[i + 1]; ++it)
+            nodes[static_cast<size_type>(it - first)] =
+                CreateNode(key_type(*it));
+        });
+      } else {
+        for (; first != last; ++first)
+          nodes.push_back(CreateNode(key_type(*first)));
+      }
+    } catch (...) {
+      DestroyNodes(nodes);
+      throw;
+    }
+    return nodes;
+  }
+
+  /**
+   * @brief Собирает пустое дерево из отсортированных узлов за O(n) (см.
+   * Build()).
+   */
+  template <typename Policy>
+  void AttachSorted(const Policy &policy,
+                    const std::vector<tree_node *> &nodes) {
+    if (nodes.empty()) return;
+    int red_depth = 0;
+    while ((size_type{2} << red_depth) <= nodes.size()) ++red_depth;
+    tree_node *root = LinkSorted(policy, nodes.data(), 0, nodes.size(), 0,
+                                 red_depth, detail::ParallelDepth(policy));
+    root->SetParent(head_);
+    SetRoot(root);
+    MostLeft() = nodes.front();
+    MostRight() = nodes.back();
+    size_ = nodes.size();
+  }
+
+  /**
+   * @brief Связывает отсортированные узлы nodes[lo, hi) в сбалансированное
+   * поддерево и возвращает его корень.
+   *
+   * @param depth Глубина корня поддерева
+   * @param red_depth Глубина самого нижнего уровня (его узлы красные)
+   * @param parallel_depth До какой глубины поддеревья строятся параллельно
+   */
+  template <typename Policy>
+  static tree_node *LinkSorted(const Policy &policy, tree_node *const *nodes,
+                               size_type lo, size_type hi, int depth,
+                               int red_depth, int parallel_depth) {
+    if (lo >= hi) return nullptr;
+    size_type mid = lo + (hi - lo) / 2;
+    tree_node *node = nodes[mid];
+    tree_node *left = nullptr;
+    tree_node *right = nullptr;
+    auto link_child = [&](size_type i) {
+      if (i == 0) {
+        left = LinkSorted(policy, nodes, lo, mid, depth + 1, red_depth,
+                          parallel_depth);
+      } else {
+        right = LinkSorted(policy, nodes, mid + 1, hi, depth + 1, red_depth,
+                           parallel_depth);
+      }
+    };
+    if (depth < parallel_depth) {
+      detail::ForEachIndex(policy, 2, link_child);
+    } else {
+      link_child(0);
+      link_child(1);
+    }
+
+    node->left_ = left;
+    node->right_ = right;
+    if (left != nullptr) left->SetParent(node);
+    if (right != nullptr) right->SetParent(node);
+    node->SetColor(depth > 0 && depth == red_depth ? pRed : pBlack);
+    return node;
+  }
+
+  /**
+   * @brief Оставляет в отсортированных узлах nodes по одному узлу на каждый
+   * ключ (первый, если keep_first, иначе последний), остальные удаляет.
+   *
+   * @details Если сравнение выбросит исключение, в nodes остаются ровно
+   * неудаленные узлы (уже обработанные и еще не просмотренные).
+   */
+  void DeleteEqualNodes(std::vector<tree_node *> &nodes, bool keep_first) {
+    auto result = nodes.begin();
+    auto first = nodes.begin();
+    auto last = nodes.end();
+    try {
+      while (first != last) {
+        auto run_end = first + 1;
+        while (run_end != last &&
+               !KeyComp()((*first)->key_, (*run_end)->key_))
+          ++run_end;
+        auto kept = keep_first ? first : run_end - 1;
+        for (auto it = first; it != run_end; ++it)
+          if (it != kept) DestroyNode(*it);
+        *result++ = *kept;
+        first = run_end;
+      }
+    } catch (...) {
+      // В [result, first) - удаленные узлы и копии оставленных
+      nodes.erase(result, first);
+      throw;
+    }
+    nodes.erase(result, last);
+  }
+
+  /**
+   * @brief Вставляет отсортированные узлы, начиная поиск места каждого
+   * следующего от предыдущего вставленного узла (см. InsertBatch()).
+   *
+   * @details Поддерево узла x содержит ключи меньше hi(x), где hi(x) - ключ
+   * ближайшего предка, в левом поддереве которого лежит x. Поднимаемся от
+   * finger, пока новый ключ не меньше hi(x); ключ не меньше предыдущего,
+   * поэтому нижняя граница поддерева выполняется автоматически. Если ключ
+   * равен hi(x), то такой элемент уже есть в дереве.
+   *
+   * Узлы, которые не удалось вставить (дубликаты), удаляются; для них
+   * вызывается assign(existing, std::move(incoming)). Если сравнение или
+   * assign выбросит исключение, из nodes убираются уже обработанные узлы:
+   * остаются только те, что не попали в дерево, и их удаляет вызывающий.
+   */
+  template <typename Assign>
+  size_type InsertSortedNodes(std::vector<tree_node *> &nodes,
+                              bool unique_only, Assign assign) {
+    size_type inserted = 0;
+    size_type next = 0;
+    tree_node *finger = nullptr;
+    try {
+      for (; next < nodes.size(); ++next) {
+        tree_node *new_node = nodes[next];
+        tree_node *start = Root();
+        tree_node *existing = nullptr;
+        if (finger != nullptr) {
+          start = finger;
+          while (start != Root()) {
+            tree_node *parent = start->Parent();
+            if (parent->left_ == start) {
+              if (KeyComp()(new_node->key_, parent->key_)) break;
+              if (unique_only && !KeyComp()(parent->key_, new_node->key_)) {
+                existing = parent;
+                break;
+              }
+            }
+            start = parent;
+          }
+        }
+
+        if (existing == nullptr) {
+          std::pair<iterator, bool> result =
+              Insert(start, new_node, unique_only);
+          existing = result.first.node_;
+          if (result.second) {
+            ++inserted;
+            finger = new_node;
+            continue;
+          }
+        }
+        assign(existing->key_, std::move(new_node->key_));
+        DestroyNode(new_node);
+        finger = existing;
+      }
+    } catch (...) {
+      // nodes[0, next) уже в дереве или удалены
+      nodes.erase(nodes.begin(), nodes.begin() + next);
+      throw;
+    }
+    return inserted;
+  }
+
+  /**
+   * @brief Наименьший общий предок двух узлов дерева (узел может быть предком
+   * самого себя).
+   */
+  template <typename Node>
+  static Node *CommonAncestor(Node *lhs, Node *rhs) noexcept {
+    int lhs_depth = Depth(lhs);
+    int rhs_depth = Depth(rhs);
+    for (; lhs_depth > rhs_depth; --lhs_depth) lhs = lhs->Parent();
+    for (; rhs_depth > lhs_depth; --rhs_depth) rhs = rhs->Parent();
+    while (lhs != rhs) {
+      lhs = lhs->Parent();
+      rhs = rhs->Parent();
+    }
+    return lhs;
+  }
+
+  // Глубина узла (у корня 0). Корень узнаем по тому, что его родитель -
+  // служебный узел head_, родитель которого - снова корень.
+  static int Depth(const tree_node *node) noexcept {
+    int depth = 0;
+    while (node->Parent()->Parent() != node) {
+      node = node->Parent();
+      ++depth;
+    }
+    return depth;
+  }
+
+  // Количество поисков, которые FindMany() ведет одновременно. 8-16 промахов
+  // одновременно - предел для буферов заполнения строк у типичных ядер.
+  static constexpr size_type kFindManyGroupSize = 8U;
+
+  /**
+   * @brief Общая часть FindMany() и ContainsMany(): ищет ключи группами с
+   * чередованием спусков и вызывает emit(node) для каждого ключа по порядку,
+   * где node - найденный узел или nullptr.
+   */
+  template <typename ForwardIt, typename KeyCompare, typename Emit>
+  void ForEachFound(ForwardIt first, ForwardIt last, const KeyCompare &cmp,
+                    Emit emit) {
+    ForwardIt group_first = first;
+    while (group_first != last) {
+      tree_node *current[kFindManyGroupSize];
+      tree_node *result[kFindManyGroupSize];
+      size_type count = 0;
+      ForwardIt it = group_first;
+      for (; it != last && count < kFindManyGroupSize; ++it, ++count) {
+        current[count] = Root();
+        result[count] = nullptr;
+      }
+
+      // Спускаемся всеми поисками группы по одному уровню за проход, пока
+      // хотя бы один еще не дошел до листа
+      bool active = true;
+      while (active) {
+        active = false;
+        ForwardIt key = group_first;
+        for (size_type i = 0; i < count; ++i, ++key) {
+          tree_node *node = current[i];
+          if (node == nullptr) continue;
+          // Логика LowerBound(): запоминаем узел не меньше ключа, идем влево
+          if (!cmp(node->key_, *key)) {
+            result[i] = node;
+            node = node->left_;
+          } else {
+            node = node->right_;
+          }
+          current[i] = node;
+          if (node != nullptr) {
+            Prefetch(node);
+            active = true;
+          }
+        }
+      }
+
+      ForwardIt key = group_first;
+      for (size_type i = 0; i < count; ++i, ++key) {
+        // Как в Find(): найденный lower bound должен быть равен ключу
+        if (result[i] != nullptr && cmp(*key, result[i]->key_))
+          result[i] = nullptr;
+        emit(result[i]);
+      }
+      group_first = it;
+    }
+  }
+
+  // Префикс ключа для RedBlackTreePrefixLayout; для остальных раскладок -
+  // пустая структура, и сравнения ниже сводятся к вызову компаратора
+  struct NoPrefix {};
+  static constexpr bool kPrefixLayout =
+      std::is_same_v<layout_type, RedBlackTreePrefixLayout>;
+  using prefix_type =
+      std::conditional_t<kPrefixLayout, std::uint64_t, NoPrefix>;
+
+  static prefix_type PrefixOf([[maybe_unused]] const key_type &key) noexcept {
+    if constexpr (kPrefixLayout) {
+      return detail::KeyPrefix<key_type>::Of(key);
+    } else {
+      return {};
+    }
+  }
+
+  static prefix_type NodePrefix(
+      [[maybe_unused]] const tree_node *node) noexcept {
+    if constexpr (kPrefixLayout) {
+      return node->prefix_;
+    } else {
+      return {};
+    }
+  }
+
+  // node->key_ < key; prefix - префикс key
+  bool NodeLess(const tree_node *node, const key_type &key,
+                [[maybe_unused]] prefix_type prefix) const {
+    if constexpr (kPrefixLayout) {
+      if (node->prefix_ != prefix) return node->prefix_ < prefix;
+    }
+    return KeyComp()(node->key_, key);
+  }
+
+  // key < node->key_; prefix - префикс key
+  bool KeyLess(const key_type &key, [[maybe_unused]] prefix_type prefix,
+               const tree_node *node) const {
+    if constexpr (kPrefixLayout) {
+      if (prefix != node->prefix_) return prefix < node->prefix_;
+    }
+    return KeyComp()(key, node->key_);
+  }
+
+  // Узлы создаются и удаляются только через аллокатор политики хранения
+  template <typename... Args>
+  static tree_node *CreateNode(Args &&...args) {
+    return NodeAllocation::Create(std::forward<Args>(args)...);
+  }
+
+  static void DestroyNode(tree_node *node) noexcept {
+    NodeAllocation::Destroy(node);
+  }
+
+  // Подсказка процессору заранее загрузить узел в кэш
+  static void Prefetch(const tree_node *node) noexcept {
+#if defined(__GNUC__)
+    __builtin_prefetch(node);
+#else
+    (void)node;
+#endif
+  }
+
   /**
    * @brief Копирует дерево из другого дерева, заменяя текущее дерево на копию.
    *
@@ -559,12 +1239,12 @@ class RedBlackTree {
   void CopyTreeFromOther(const tree_type &other) {
     tree_node *other_copy_root = CopyTree(other.Root(), nullptr);
     Clear();
-    Root() = other_copy_root;
-    Root()->parent_ = head_;
+    SetRoot(other_copy_root);
+    Root()->SetParent(head_);
     MostLeft() = SearchMinimum(Root());
     MostRight() = SearchMaximum(Root());
     size_ = other.size_;
-    cmp_ = other.cmp_;
+    CompareHolder::Get() = other.KeyComp();
   }
 
   /**
@@ -581,7 +1261,7 @@ class RedBlackTree {
   [[nodiscard]] tree_node *CopyTree(const tree_node *node, tree_node *parent) {
     // Если вылетит исключение при создании самого первого узла, то ничего
     // страшного, ничего создано не будет
-    tree_node *copy = new tree_node{node->key_, node->color_};
+    tree_node *copy = CreateNode(node->key_, node->Color());
     // А вот все рекурсивные вызовы оборачиваем в try/catch, чтобы в случае
     // возникновения исключения удалить все уже скопированные узлы (иначе
     // будет утечка)
@@ -598,7 +1278,7 @@ class RedBlackTree {
       throw;
     }
 
-    copy->parent_ = parent;
+    copy->SetParent(parent);
     return copy;
   }
 
@@ -616,7 +1296,7 @@ class RedBlackTree {
     if (node == nullptr) return;
     Destroy(node->left_);
     Destroy(node->right_);
-    delete node;
+    DestroyNode(node);
   }
 
   /**
@@ -627,19 +1307,20 @@ class RedBlackTree {
    * узел в nullptr, а самый левый и самый правый узлы в голову дерева.
    */
   void InitializeHead() noexcept {
-    Root() = nullptr;
+    SetRoot(nullptr);
     MostLeft() = head_;
     MostRight() = head_;
   }
 
   /**
-   * @brief Возвращает ссылку на корневой узел дерева.
+   * @brief Возвращает указатель на корневой узел дерева.
    *
-   * @return Ссылка на корневой узел дерева.
+   * @return Указатель на корневой узел дерева.
    *
-   * @note Метод предназначен для доступа к корневому узлу дерева.
+   * @note Метод предназначен для доступа к корневому узлу дерева. Для
+   * изменения корня используется SetRoot().
    */
-  tree_node *&Root() { return head_->parent_; }
+  tree_node *Root() { return head_->Parent(); }
 
   /**
    * @brief Возвращает константную ссылку на корневой узел дерева.
@@ -649,7 +1330,18 @@ class RedBlackTree {
    * @note Метод предназначен для доступа к корневому узлу дерева в контексте
    * const методов.
    */
-  const tree_node *Root() const { return head_->parent_; }
+  const tree_node *Root() const { return head_->Parent(); }
+
+  /**
+   * @brief Устанавливает корневой узел дерева.
+   *
+   * @param root Новый корень дерева.
+   *
+   * @note Корень хранится в поле родителя служебного узла head_, поэтому
+   * запись идет через SetParent(), чтобы не затереть цвет при компактной
+   * раскладке узла.
+   */
+  void SetRoot(tree_node *root) noexcept { head_->SetParent(root); }
 
   /**
    * @brief Возвращает ссылку на самый левый узел дерева.
@@ -700,11 +1392,14 @@ class RedBlackTree {
                                    bool unique_only) {
     tree_node *node = root;
     tree_node *parent = nullptr;
+    bool insert_left = false;
+    const prefix_type prefix = NodePrefix(new_node);
 
     // Ищем место для вставки, пока не дойдем до пустого узла
     while (node != nullptr) {
       parent = node;
-      if (cmp_(new_node->key_, node->key_)) {
+      insert_left = KeyLess(new_node->key_, prefix, node);
+      if (insert_left) {
         // Если new_node < node
         node = node->left_;
       } else {
@@ -716,7 +1411,7 @@ class RedBlackTree {
         } else {
           // Если вставка неуникальных элементов не разрешена, то
           // выясняем node > new_node или node == new_node
-          if (cmp_(node->key_, new_node->key_)) {
+          if (NodeLess(node, new_node->key_, prefix)) {
             // Если node > new_node, то продолжаем поиски в правой
             // ветви
             node = node->right_;
@@ -733,17 +1428,19 @@ class RedBlackTree {
     // которого станет new_node. При этом parent может быть равен nullptr,
     // если в дереве не окажется узлов (пустое дерево), если мы даже не
     // зашли в цикл выше
+    // Направление запоминается при спуске: после него сравнений нет, и
+    // исключение из компаратора не может оставить узел привязанным наполовину
     if (parent != nullptr) {
-      new_node->parent_ = parent;
-      if (cmp_(new_node->key_, parent->key_)) {
+      new_node->SetParent(parent);
+      if (insert_left) {
         parent->left_ = new_node;
       } else
         parent->right_ = new_node;
     } else {
       // Если дерево пустое, то new_node становится корнем дерева
-      new_node->color_ = pBlack;
-      new_node->parent_ = head_;
-      Root() = new_node;
+      new_node->SetColor(pBlack);
+      new_node->SetParent(head_);
+      SetRoot(new_node);
     }
 
     ++size_;
@@ -791,18 +1488,18 @@ class RedBlackTree {
    */
   void BalancingInsert(tree_node *node) {
     // Отец
-    tree_node *parent = node->parent_;
+    tree_node *parent = node->Parent();
     int flag = 1;
 
-    while (node != Root() && parent->color_ == pRed && flag) {
+    while (node != Root() && parent->Color() == pRed && flag) {
       // Дед
-      tree_node *gparent = parent->parent_;
+      tree_node *gparent = parent->Parent();
 
       if (gparent->left_ == parent) {
         // Обрабатываем ситуацию, когда дядя справа у деда
         tree_node *uncle = gparent->right_;
 
-        if (uncle != nullptr && uncle->color_ == pRed) {
+        if (uncle != nullptr && uncle->Color() == pRed) {
           // Случай первый — красный дядя
 
           // Если и отец, и дядя красного цвета, то мы можем
@@ -812,11 +1509,11 @@ class RedBlackTree {
           // gparent, поэтому необходимо рекурсивно вызвать дальнейшую
           // балансировку для этого узла (следующая итерация цикла
           // while).
-          parent->color_ = pBlack;
-          uncle->color_ = pBlack;
-          gparent->color_ = pRed;
+          parent->SetColor(pBlack);
+          uncle->SetColor(pBlack);
+          gparent->SetColor(pRed);
           node = gparent;
-          parent = node->parent_;
+          parent = node->Parent();
         } else {
           // Случай второй — чёрный дядя — папа и дед в разных
           // сторонах.
@@ -835,23 +1532,23 @@ class RedBlackTree {
           // отца через деда к чёрному дяде и перекрасить parent в
           // чёрный, а gparent в красный.
           RotateRight(gparent);
-          gparent->color_ = pRed;
-          parent->color_ = pBlack;
+          gparent->SetColor(pRed);
+          parent->SetColor(pBlack);
           flag = 0;
         }
       } else {
         // Обрабатываем ситуацию, когда дядя слева у деда
         tree_node *uncle = gparent->left_;
 
-        if (uncle != nullptr && uncle->color_ == pRed) {
+        if (uncle != nullptr && uncle->Color() == pRed) {
           // Случай первый — красный дядя
           // Аналогично ситуации, когда дядя справа у деда
-          parent->color_ = pBlack;
-          uncle->color_ = pBlack;
-          gparent->color_ = pRed;
+          parent->SetColor(pBlack);
+          uncle->SetColor(pBlack);
+          gparent->SetColor(pRed);
 
           node = gparent;
-          parent = node->parent_;
+          parent = node->Parent();
         } else {
           // Случай второй — чёрный дядя — папа и дед в разных
           // сторонах. Аналогично ситуации, когда дядя справа у деда
@@ -863,14 +1560,14 @@ class RedBlackTree {
           // Случай третий — чёрный дядя — папа и дед в одной стороне
           // Аналогично ситуации, когда дядя справа у деда
           RotateLeft(gparent);
-          gparent->color_ = pRed;
-          parent->color_ = pBlack;
+          gparent->SetColor(pRed);
+          parent->SetColor(pBlack);
           flag = 0;
         }
       }
     }
 
-    Root()->color_ = pBlack;
+    Root()->SetColor(pBlack);
   }
 
   /**
@@ -885,20 +1582,20 @@ class RedBlackTree {
    */
   void RotateRight(tree_node *node) noexcept {
     tree_node *const pivot = node->left_;
-    pivot->parent_ = node->parent_;
+    pivot->SetParent(node->Parent());
 
     if (node == Root()) {
-      Root() = pivot;
-    } else if (node->parent_->left_ == node) {
-      node->parent_->left_ = pivot;
+      SetRoot(pivot);
+    } else if (node->Parent()->left_ == node) {
+      node->Parent()->left_ = pivot;
     } else {
-      node->parent_->right_ = pivot;
+      node->Parent()->right_ = pivot;
     }
 
     node->left_ = pivot->right_;
-    if (pivot->right_ != nullptr) pivot->right_->parent_ = node;
+    if (pivot->right_ != nullptr) pivot->right_->SetParent(node);
 
-    node->parent_ = pivot;
+    node->SetParent(pivot);
     pivot->right_ = node;
   }
 
@@ -915,19 +1612,19 @@ class RedBlackTree {
   void RotateLeft(tree_node *node) noexcept {
     tree_node *const pivot = node->right_;
 
-    pivot->parent_ = node->parent_;
+    pivot->SetParent(node->Parent());
 
     if (node == Root())
-      Root() = pivot;
-    else if (node->parent_->left_ == node)
-      node->parent_->left_ = pivot;
+      SetRoot(pivot);
+    else if (node->Parent()->left_ == node)
+      node->Parent()->left_ = pivot;
     else
-      node->parent_->right_ = pivot;
+      node->Parent()->right_ = pivot;
 
     node->right_ = pivot->left_;
-    if (pivot->left_ != nullptr) pivot->left_->parent_ = node;
+    if (pivot->left_ != nullptr) pivot->left_->SetParent(node);
 
-    node->parent_ = pivot;
+    node->SetParent(pivot);
     pivot->left_ = node;
   }
 
@@ -1028,7 +1725,7 @@ class RedBlackTree {
     // Обработка К1 — не требуется, т.к. такой случай невозможен
 
     // Обработка Ч1
-    if (deleted_node->color_ == pBlack &&
+    if (deleted_node->Color() == pBlack &&
         ((deleted_node->left_ == nullptr && deleted_node->right_ != nullptr) ||
          (deleted_node->left_ != nullptr && deleted_node->right_ == nullptr))) {
       // Находим красный узел без детей (К0) для обмена значений с ним
@@ -1050,7 +1747,7 @@ class RedBlackTree {
     // Самый сложный и интересный случай, нам необходимо перед удалением
     // перебаласировать дерево таким образом, чтобы черная высота не
     // нарушилась после удаления узла
-    if (deleted_node->color_ == pBlack && deleted_node->left_ == nullptr &&
+    if (deleted_node->Color() == pBlack && deleted_node->left_ == nullptr &&
         deleted_node->right_ == nullptr)
       EraseBalancing(deleted_node);
 
@@ -1066,10 +1763,10 @@ class RedBlackTree {
     } else {
       // В остальных случаях отцепляем ссылки родителя на нашу удаляемый
       // узел
-      if (deleted_node == deleted_node->parent_->left_)
-        deleted_node->parent_->left_ = nullptr;
+      if (deleted_node == deleted_node->Parent()->left_)
+        deleted_node->Parent()->left_ = nullptr;
       else
-        deleted_node->parent_->right_ = nullptr;
+        deleted_node->Parent()->right_ = nullptr;
 
       // Ищем новый минимум для служебного узла, если мы удаляем старый
       // минимум
@@ -1100,41 +1797,43 @@ class RedBlackTree {
    * ExtractNode()
    **/
   void SwapNodesForErase(tree_node *node, tree_node *other) noexcept {
-    if (other->parent_->left_ == other)
-      other->parent_->left_ = node;
+    if (other->Parent()->left_ == other)
+      other->Parent()->left_ = node;
     else
-      other->parent_->right_ = node;
+      other->Parent()->right_ = node;
 
     if (node == Root()) {
       // Если node является корнем дерева, то меняем ссылку на новый
       // корень
-      Root() = other;
+      SetRoot(other);
     } else {
-      if (node->parent_->left_ == node)
-        node->parent_->left_ = other;
+      if (node->Parent()->left_ == node)
+        node->Parent()->left_ = other;
       else
-        node->parent_->right_ = other;
+        node->Parent()->right_ = other;
     }
 
     // Свапаем всё, кроме key_, т.к. ключи должны остаться на своем месте в
     // дереве, а все остальное должно обменяться (см. описание алгоритма
     // удаления)
-    std::swap(node->parent_, other->parent_);
+    tree_node *node_parent = node->Parent();
+    node->SetParent(other->Parent());
+    other->SetParent(node_parent);
     std::swap(node->left_, other->left_);
     std::swap(node->right_, other->right_);
-    std::swap(node->color_, other->color_);
+    SwapColors(node, other);
 
     if (node->left_) {
       // При текущем алгоритме удаления у нас не может быть left_
       // заполнен, но в универсальном варианте надо проверять
-      node->left_->parent_ = node;
+      node->left_->SetParent(node);
     }
 
-    if (node->right_) node->right_->parent_ = node;
+    if (node->right_) node->right_->SetParent(node);
 
-    if (other->left_) other->left_->parent_ = other;
+    if (other->left_) other->left_->SetParent(other);
 
-    if (other->right_) other->right_->parent_ = other;
+    if (other->right_) other->right_->SetParent(other);
   }
 
   /**
@@ -1198,51 +1897,52 @@ class RedBlackTree {
    */
   void EraseBalancing(tree_node *deleted_node) noexcept {
     tree_node *check_node = deleted_node;
-    tree_node *parent = deleted_node->parent_;
+    tree_node *parent = deleted_node->Parent();
 
     // Проверку осуществляем в цикле, пока проверяемый узел черный
     // (необходимость зацикливания указана в описании случая 6.2)). Ну или
     // пока дерево не кончится
-    while (check_node != Root() && check_node->color_ == pBlack) {
+    while (check_node != Root() && check_node->Color() == pBlack) {
       if (check_node == parent->left_) {
         // Удаляемый элемент находится слева от родителя
         tree_node *sibling = parent->right_;
 
         // Случай 6.1
-        if (sibling->color_ == pRed) {
-          std::swap(sibling->color_, parent->color_);
+        if (sibling->Color() == pRed) {
+          SwapColors(sibling, parent);
           RotateLeft(parent);
-          parent = check_node->parent_;
+          parent = check_node->Parent();
           sibling = parent->right_;
         }
 
         // Случай 6.2
-        if (sibling->color_ == pBlack &&
-            (sibling->left_ == nullptr || sibling->left_->color_ == pBlack) &&
-            (sibling->right_ == nullptr || sibling->right_->color_ == pBlack)) {
-          sibling->color_ = pRed;
-          if (parent->color_ == pRed) {
-            parent->color_ = pBlack;
+        if (sibling->Color() == pBlack &&
+            (sibling->left_ == nullptr || sibling->left_->Color() == pBlack) &&
+            (sibling->right_ == nullptr ||
+             sibling->right_->Color() == pBlack)) {
+          sibling->SetColor(pRed);
+          if (parent->Color() == pRed) {
+            parent->SetColor(pBlack);
             // Балансировка завершена
             break;
           }
           // Идем балансировать parent
           check_node = parent;
-          parent = check_node->parent_;
+          parent = check_node->Parent();
         } else {
-          if (sibling->left_ != nullptr && sibling->left_->color_ == pRed &&
+          if (sibling->left_ != nullptr && sibling->left_->Color() == pRed &&
               (sibling->right_ == nullptr ||
-               sibling->right_->color_ == pBlack)) {
+               sibling->right_->Color() == pBlack)) {
             // Случай 6.3
-            std::swap(sibling->color_, sibling->left_->color_);
+            SwapColors(sibling, sibling->left_);
             RotateRight(sibling);
             sibling = parent->right_;
           }
 
           // Случай 6.4
-          sibling->right_->color_ = pBlack;
-          sibling->color_ = parent->color_;
-          parent->color_ = pBlack;
+          sibling->right_->SetColor(pBlack);
+          sibling->SetColor(parent->Color());
+          parent->SetColor(pBlack);
           RotateLeft(parent);
           // Балансировка завершена
           break;
@@ -1252,38 +1952,40 @@ class RedBlackTree {
         tree_node *sibling = parent->left_;
 
         // Случай 6.1
-        if (sibling->color_ == pRed) {
-          std::swap(sibling->color_, parent->color_);
+        if (sibling->Color() == pRed) {
+          SwapColors(sibling, parent);
           RotateRight(parent);
-          parent = check_node->parent_;
+          parent = check_node->Parent();
           sibling = parent->left_;
         }
 
         // Случай 6.2
-        if (sibling->color_ == pBlack &&
-            (sibling->left_ == nullptr || sibling->left_->color_ == pBlack) &&
-            (sibling->right_ == nullptr || sibling->right_->color_ == pBlack)) {
-          sibling->color_ = pRed;
-          if (parent->color_ == pRed) {
-            parent->color_ = pBlack;
+        if (sibling->Color() == pBlack &&
+            (sibling->left_ == nullptr || sibling->left_->Color() == pBlack) &&
+            (sibling->right_ == nullptr ||
+             sibling->right_->Color() == pBlack)) {
+          sibling->SetColor(pRed);
+          if (parent->Color() == pRed) {
+            parent->SetColor(pBlack);
             // Балансировка завершена
             break;
           }
           // Идем балансировать parent
           check_node = parent;
-          parent = check_node->parent_;
+          parent = check_node->Parent();
         } else {
-          if (sibling->right_ != nullptr && sibling->right_->color_ == pRed &&
-              (sibling->left_ == nullptr || sibling->left_->color_ == pBlack)) {
+          if (sibling->right_ != nullptr && sibling->right_->Color() == pRed &&
+              (sibling->left_ == nullptr ||
+               sibling->left_->Color() == pBlack)) {
             // Случай 6.3
-            std::swap(sibling->color_, sibling->right_->color_);
+            SwapColors(sibling, sibling->right_);
             RotateLeft(sibling);
             sibling = parent->left_;
           }
           // Случай 6.4
-          sibling->left_->color_ = pBlack;
-          sibling->color_ = parent->color_;
-          parent->color_ = pBlack;
+          sibling->left_->SetColor(pBlack);
+          sibling->SetColor(parent->Color());
+          parent->SetColor(pBlack);
           RotateRight(parent);
           // Балансировка завершена
           break;
@@ -1292,6 +1994,19 @@ class RedBlackTree {
     }
   }
 
+  /**
+   * @brief Обменивает цвета двух узлов.
+   *
+   * @note Цвет может храниться в отдельном поле или в бите указателя на
+   * родителя (в зависимости от раскладки), поэтому обмен идет через
+   * Color()/SetColor().
+   */
+  static void SwapColors(tree_node *first, tree_node *second) noexcept {
+    tree_color first_color = first->Color();
+    first->SetColor(second->Color());
+    second->SetColor(first_color);
+  }
+
   /**
    * @brief Находит узел с минимальным значением в дереве.
    *
@@ -1332,9 +2047,9 @@ class RedBlackTree {
   int ComputeBlackHeight(const tree_node *node) const noexcept {
     if (node == nullptr) return 0;
 
-    int left_height = ComputerBlackHeight(node->left_);
-    int right_height = ComputerBlackHeight(node->right_);
-    int add = node->color_ == pBlack ? 1 : 0;
+    int left_height = ComputeBlackHeight(node->left_);
+    int right_height = ComputeBlackHeight(node->right_);
+    int add = node->Color() == pBlack ? 1 : 0;
 
     // Возвращает -1, если дерево не является корректным:
     // 1) Если левое поддерево не является корректным
@@ -1359,9 +2074,10 @@ class RedBlackTree {
    * возвращает false, указывая на нарушение свойства красно-черного дерева.
    */
   bool CheckRedNodes(const tree_node *Node) const noexcept {
-    if (Node->color_ == pRed) {
-      if (Node->left_ != nullptr && Node->left_->color_ == pRed) return false;
-      if (Node->right_ != nullptr && Node->right_->color_ == pRed) return false;
+    if (Node->Color() == pRed) {
+      if (Node->left_ != nullptr && Node->left_->Color() == pRed) return false;
+      if (Node->right_ != nullptr && Node->right_->Color() == pRed)
+        return false;
     }
 
     if (Node->left_ != nullptr) {
@@ -1376,138 +2092,11 @@ class RedBlackTree {
   }
 
  private:
-  struct RedBlackTreeNode {
-    /**
-     * @brief Конструктор по умолчанию для узла.
-     *
-     * Инициализирует узел с пустыми ссылками на левый и правый потомки,
-     * ключом по умолчанию и красным цветом.
-     */
-    RedBlackTreeNode()
-        : parent_(nullptr),
-          left_(this),
-          right_(this),
-          key_(key_type{}),
-          color_(pRed) {}
-
-    /**
-     * @brief Конструктор для узла с заданным ключом.
-     *
-     * @param key Ключ, который будет присвоен узлу.
-     *
-     * Инициализирует узел с заданным ключом, пустыми ссылками на левый и правый
-     * потомки и красным цветом.
-     */
-    RedBlackTreeNode(const key_type &key)
-        : parent_(nullptr),
-          left_(nullptr),
-          right_(nullptr),
-          key_(key),
-          color_(pRed) {}
-
-    /**
-     * @brief Конструктор для узла с заданным ключом, использующим перемещение.
-     *
-     * @param key Ключ, который будет перемещен в узел.
-     *
-     * Инициализирует узел с перемещенным ключом, пустыми ссылками на левый и
-     * правый потомки и красным цветом.
-     */
-    RedBlackTreeNode(key_type &&key)
-        : parent_(nullptr),
-          left_(nullptr),
-          right_(nullptr),
-          key_(std::move(key)),
-          color_(pRed) {}
-
-    RedBlackTreeNode(key_type key, tree_color color)
-        : parent_(nullptr),
-          left_(nullptr),
-          right_(nullptr),
-          key_(key),
-          color_(color) {}
-
-    /**
-     * @brief Сброс узла к значениям по умолчанию.
-     *
-     * Сбрасывает ссылки на левый и правый потомки, родителя и цвет узла.
-     *
-     * @note Метод не выбрасывает исключения.
-     */
-    void ToDefault() noexcept {
-      left_ = nullptr;
-      right_ = nullptr;
-      parent_ = nullptr;
-      color_ = pRed;
-    }
-
-    /**
-     * @brief Получение следующего узла в порядке обхода дерева.
-     *
-     * @return Указатель на следующий узел в порядке обхода дерева.
-     *
-     * @note Метод не выбрасывает исключения.
-     */
-    tree_node *NextNode() const noexcept {
-      tree_node *node = const_cast<tree_node *>(this);
-      if (node->color_ == pRed &&
-          (node->parent_ == nullptr || node->parent_->parent_ == node)) {
-        node = node->left_;
-      } else if (node->right_ != nullptr) {
-        node = node->right_;
-        while (node->left_ != nullptr) node = node->left_;
-      } else {
-        tree_node *parent = node->parent_;
-
-        while (node == parent->right_) {
-          node = parent;
-          parent = parent->parent_;
-        }
-
-        if (node->right_ != parent) node = parent;
-      }
-
-      return node;
-    }
-
-    /**
-     * @brief Получение предыдущего узла в порядке обхода дерева.
-     *
-     * @return Указатель на предыдущий узел в порядке обхода дерева.
-     *
-     * @note Метод не выбрасывает исключения.
-     */
-    tree_node *PrevNode() const noexcept {
-      tree_node *node = const_cast<tree_node *>(this);
-      if (node->color_ == pRed &&
-          (node->parent_ == nullptr || node->parent_->parent_ == node)) {
-        node = node->right_;
-      } else if (node->left_ != nullptr) {
-        node = node->left_;
-        while (node->right_ != nullptr) node = node->right_;
-      } else {
-        tree_node *parent = node->parent_;
-        while (node == parent->left_) {
-          node = parent;
-          parent = parent_;
-        }
-
-        if (node->left_ != parent) node = parent;
-      }
-
-      return node;
-    }
-
-    tree_node *parent_;  // Указатель на родительский узел.
-    tree_node *left_;   // Указатель на левый потомок.
-    tree_node *right_;  // Указатель на правый потомок.
-    key_type key_;      // Ключ узла.
-    tree_color color_;  // Цвет узла.
-  };
-
   struct RedBlackTreeIterator {
     // Типы, используемые в итераторе
-    using tree_iterator = std::forward_iterator_tag;  // Категория итератора
+    using tree_type = RedBlackTree;  // Дерево, по которому идет итерация
+    using iterator_category =
+        std::bidirectional_iterator_tag;  // Категория итератора
     using difference_type =
         std::ptrdiff_t;  // Тип разницы между двумя итераторами
     using value_type =
@@ -1620,7 +2209,9 @@ class RedBlackTree {
 
   struct RedBlackTreeIteratorConst {
     // Типы, используемые в итераторе
-    using iterator_category = std::forward_iterator_tag;  // Категория итератора
+    using tree_type = RedBlackTree;  // Дерево, по которому идет итерация
+    using iterator_category =
+        std::bidirectional_iterator_tag;  // Категория итератора
     using difference_type =
         std::ptrdiff_t;  // Тип разницы между двумя итераторами
     using value_type =
@@ -1744,9 +2335,10 @@ class RedBlackTree {
     const tree_node *node_;
   };
 
+  using NodeAllocation = detail::NodeAllocation<tree_node, allocator_type>;
+
   tree_node *head_;
   size_type size_;
-  Comparator cmp_;
 };
 
 }  // namespace s21
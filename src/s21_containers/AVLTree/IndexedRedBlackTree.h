@@ -0,0 +1,826 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERS_AVLTREE_S21_INDEXEDREDBLACKTREE_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERS_AVLTREE_S21_INDEXEDREDBLACKTREE_H
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+#include "RedBlackTreeNode.h"
+
+namespace s21 {
+/**
+ * @brief Красно-черное дерево, все узлы которого лежат в одном непрерывном
+ * буфере s21::vector и ссылаются друг на друга 32-битными индексами.
+ *
+ * @details Отличия от RedBlackTree:
+ * - узлы не разбросаны по куче, поиск затрагивает меньше страниц памяти;
+ * - копирование дерева - это копирование одного буфера (для тривиально
+ * копируемых ключей std::copy сводится к memmove);
+ * - для тривиально копируемых ключей дерево можно записать в поток и прочитать
+ * обратно без преобразований (Save()/Load());
+ * - удаленные узлы не освобождаются, а попадают в список свободных ячеек и
+ * переиспользуются при следующих вставках.
+ *
+ * Ячейка 0 буфера - служебный черный NIL-узел (аналог T.nil из Кормена), он
+ * же используется как End(). Поэтому алгоритмы вставки и удаления написаны по
+ * Кормену, без отдельных проверок на nullptr.
+ *
+ * Итераторы хранят индекс узла, поэтому остаются валидными при росте буфера.
+ * Итератор на удаленный элемент становится недействительным.
+ *
+ * @tparam Key Тип ключа
+ * @tparam Comparator Функция сравнения ключей
+ */
+template <typename Key, typename Comparator = std::less<Key>>
+class IndexedRedBlackTree {
+ private:
+  template <bool IsConst>
+  struct IndexedRedBlackTreeIterator;
+
+ public:
+  using key_type = Key;
+  using reference = key_type &;
+  using const_reference = const key_type &;
+  using iterator = IndexedRedBlackTreeIterator<false>;
+  using const_iterator = IndexedRedBlackTreeIterator<true>;
+  using size_type = std::size_t;
+  using index_type = std::uint32_t;
+
+  using tree_type = IndexedRedBlackTree;
+  using tree_color = RedBlackTreeColor;
+
+  // Индекс служебного NIL-узла
+  static constexpr index_type kNil = 0;
+
+  struct IndexedRedBlackTreeNode {
+    key_type key_{};               // Ключ узла.
+    index_type parent_ = kNil;     // Индекс родительского узла.
+    index_type left_ = kNil;       // Индекс левого потомка.
+    index_type right_ = kNil;      // Индекс правого потомка.
+    std::uint8_t color_ = pBlack;  // Цвет узла (RedBlackTreeColor).
+  };
+
+  using tree_node = IndexedRedBlackTreeNode;
+
+  /**
+   * @brief Конструктор по умолчанию: в буфере только NIL-узел.
+   */
+  IndexedRedBlackTree() : root_(kNil), free_head_(kNil), size_(0U) {
+    nodes_.push_back(tree_node{});
+  }
+
+  /**
+   * @brief Конструктор копирования - копирует буфер узлов целиком, без обхода
+   * дерева и без выделения памяти под каждый узел.
+   *
+   * @param other Копируемое дерево
+   */
+  IndexedRedBlackTree(const tree_type &other) = default;
+
+  /**
+   * @brief Конструктор перемещения.
+   *
+   * @param other Перемещаемое дерево, после перемещения остается пустым.
+   */
+  IndexedRedBlackTree(tree_type &&other) noexcept : IndexedRedBlackTree() {
+    Swap(other);
+  }
+
+  /**
+   * @brief Оператор присваивания копированием (копирование буфера узлов).
+   */
+  tree_type &operator=(const tree_type &other) = default;
+
+  /**
+   * @brief Оператор присваивания перемещением.
+   */
+  tree_type &operator=(tree_type &&other) noexcept {
+    if (this != &other) {
+      Clear();
+      Swap(other);
+    }
+    return *this;
+  }
+
+  ~IndexedRedBlackTree() = default;
+
+  /**
+   * @brief Удаляет все элементы. Память буфера при этом сохраняется для
+   * последующих вставок.
+   */
+  void Clear() noexcept {
+    nodes_.clear();
+    nodes_.push_back(tree_node{});
+    root_ = kNil;
+    free_head_ = kNil;
+    size_ = 0;
+  }
+
+  size_type Size() const noexcept { return size_; }
+
+  bool Empty() const noexcept { return size_ == 0; }
+
+  /**
+   * @brief Максимальное количество элементов ограничено разрядностью индекса
+   * (ячейка 0 занята NIL-узлом).
+   */
+  size_type MaxSize() const noexcept {
+    return std::numeric_limits<index_type>::max() - 1U;
+  }
+
+  /**
+   * @brief Резервирует место под count элементов, чтобы вставки не
+   * перевыделяли буфер.
+   */
+  void Reserve(size_type count) {
+    if (count > MaxSize())
+      throw std::length_error(
+          "s21::IndexedRedBlackTree::Reserve Too many elements for 32-bit "
+          "indices");
+    nodes_.reserve(count + 1U);
+  }
+
+  /**
+   * @brief Количество ячеек буфера, включая NIL-узел и свободные ячейки.
+   */
+  size_type Capacity() const noexcept { return nodes_.size(); }
+
+  iterator Begin() noexcept { return iterator(this, Minimum(root_)); }
+
+  const_iterator Begin() const noexcept {
+    return const_iterator(this, Minimum(root_));
+  }
+
+  iterator End() noexcept { return iterator(this, kNil); }
+
+  const_iterator End() const noexcept { return const_iterator(this, kNil); }
+
+  /**
+   * @brief Вставляет элемент, даже если элемент с таким ключом уже есть (по
+   * верхней границе диапазона равных элементов).
+   */
+  iterator Insert(const key_type &key) { return Insert(key, false).first; }
+
+  /**
+   * @brief Вставляет элемент, если элемента с эквивалентным ключом еще нет.
+   *
+   * @return Пара из итератора на вставленный (или мешающий вставке) элемент и
+   * признака того, что вставка произошла.
+   */
+  std::pair<iterator, bool> InsertUnique(const key_type &key) {
+    return Insert(key, true);
+  }
+
+  iterator Find(const_reference key) {
+    iterator result = LowerBound(key);
+    if (result == End() || cmp_(key, *result)) return End();
+    return result;
+  }
+
+  const_iterator Find(const_reference key) const {
+    return const_cast<tree_type *>(this)->Find(key);
+  }
+
+  bool Contains(const_reference key) const { return Find(key) != End(); }
+
+  /**
+   * @brief Первый элемент, не меньший key.
+   */
+  iterator LowerBound(const_reference key) {
+    index_type node = root_;
+    index_type result = kNil;
+
+    while (node != kNil) {
+      if (!cmp_(At(node).key_, key)) {
+        result = node;
+        node = At(node).left_;
+      } else {
+        node = At(node).right_;
+      }
+    }
+
+    return iterator(this, result);
+  }
+
+  /**
+   * @brief Первый элемент, больший key.
+   */
+  iterator UpperBound(const_reference key) {
+    index_type node = root_;
+    index_type result = kNil;
+
+    while (node != kNil) {
+      if (cmp_(key, At(node).key_)) {
+        result = node;
+        node = At(node).left_;
+      } else {
+        node = At(node).right_;
+      }
+    }
+
+    return iterator(this, result);
+  }
+
+  /**
+   * @brief Удаляет элемент по итератору. Ячейка узла попадает в список
+   * свободных, индексы остальных узлов не меняются.
+   */
+  void Erase(iterator pos) noexcept {
+    if (pos.index_ == kNil) return;
+
+    index_type z = pos.index_;
+    index_type y = z;
+    index_type x = kNil;
+    std::uint8_t y_original_color = At(y).color_;
+
+    if (At(z).left_ == kNil) {
+      x = At(z).right_;
+      Transplant(z, x);
+    } else if (At(z).right_ == kNil) {
+      x = At(z).left_;
+      Transplant(z, x);
+    } else {
+      // Узел с двумя детьми заменяем минимальным узлом правого поддерева.
+      // Переносится сам узел, а не ключ, чтобы итераторы на него остались
+      // валидными.
+      y = Minimum(At(z).right_);
+      y_original_color = At(y).color_;
+      x = At(y).right_;
+
+      if (At(y).parent_ == z) {
+        At(x).parent_ = y;
+      } else {
+        Transplant(y, x);
+        At(y).right_ = At(z).right_;
+        At(At(y).right_).parent_ = y;
+      }
+
+      Transplant(z, y);
+      At(y).left_ = At(z).left_;
+      At(At(y).left_).parent_ = y;
+      At(y).color_ = At(z).color_;
+    }
+
+    if (y_original_color == pBlack) EraseBalancing(x);
+
+    FreeNode(z);
+    --size_;
+  }
+
+  void Swap(tree_type &other) noexcept {
+    nodes_.swap(other.nodes_);
+    std::swap(root_, other.root_);
+    std::swap(free_head_, other.free_head_);
+    std::swap(size_, other.size_);
+    std::swap(cmp_, other.cmp_);
+  }
+
+  /**
+   * @brief Записывает дерево в поток как есть: заголовок и буфер узлов.
+   *
+   * @details Доступно только для тривиально копируемых ключей. Формат
+   * зависит от платформы (порядок байт, размер ключа) - файл предназначен для
+   * чтения той же сборкой программы.
+   *
+   * @throw std::runtime_error при ошибке записи
+   */
+  void Save(std::ostream &out) const {
+    static_assert(std::is_trivially_copyable<key_type>::value,
+                  "s21::IndexedRedBlackTree::Save requires trivially copyable "
+                  "keys");
+
+    StorageHeader header{kStorageMagic,
+                         static_cast<std::uint32_t>(sizeof(tree_node)),
+                         static_cast<index_type>(nodes_.size()),
+                         root_,
+                         free_head_,
+                         static_cast<index_type>(size_)};
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(nodes_.data()),
+              static_cast<std::streamsize>(nodes_.size() * sizeof(tree_node)));
+
+    if (!out)
+      throw std::runtime_error(
+          "s21::IndexedRedBlackTree::Save Unable to write the tree");
+  }
+
+  /**
+   * @brief Читает дерево, записанное Save(), заменяя текущее содержимое.
+   *
+   * @details Буфер читается одним блоком. Чтобы поврежденный файл не привел
+   * к UB или бесконечному циклу при обходе и вставке, проверяется вся
+   * структура: индексы не выходят за границы буфера, от корня достижимо
+   * ровно size узлов без циклов, у каждого узла верная ссылка на родителя и
+   * допустимый цвет, NIL черный, а список свободных ячеек конечен и состоит
+   * из всех остальных ячеек. При ошибке текущее дерево не изменяется.
+   *
+   * @throw std::runtime_error если поток поврежден или записан другой сборкой
+   */
+  void Load(std::istream &in) {
+    static_assert(std::is_trivially_copyable<key_type>::value,
+                  "s21::IndexedRedBlackTree::Load requires trivially copyable "
+                  "keys");
+
+    StorageHeader header{};
+    in.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!in || header.magic != kStorageMagic ||
+        header.node_size != sizeof(tree_node) || header.node_count == 0 ||
+        header.root >= header.node_count ||
+        header.free_head >= header.node_count ||
+        header.size >= header.node_count)
+      throw std::runtime_error(
+          "s21::IndexedRedBlackTree::Load Invalid tree header");
+
+    s21::vector<tree_node> nodes(header.node_count);
+    in.read(reinterpret_cast<char *>(nodes.data()),
+            static_cast<std::streamsize>(header.node_count *
+                                         sizeof(tree_node)));
+    if (!in)
+      throw std::runtime_error(
+          "s21::IndexedRedBlackTree::Load Unexpected end of stream");
+
+    for (const tree_node &node : nodes) {
+      if (node.parent_ >= header.node_count ||
+          node.left_ >= header.node_count || node.right_ >= header.node_count)
+        throw std::runtime_error(
+            "s21::IndexedRedBlackTree::Load Node index is out of range");
+    }
+    CheckLinks(nodes, header);
+
+    nodes_.swap(nodes);
+    root_ = header.root;
+    free_head_ = header.free_head;
+    size_ = header.size;
+  }
+
+  /**
+   * @brief Проверяет свойства красно-черного дерева (аналог
+   * RedBlackTree::CheckTree()).
+   */
+  bool CheckTree() const noexcept {
+    if (At(kNil).color_ != pBlack) return false;
+    if (root_ == kNil) return size_ == 0;
+    if (At(root_).color_ != pBlack || At(root_).parent_ != kNil) return false;
+    if (!CheckRedNodes(root_)) return false;
+    return ComputeBlackHeight(root_) != -1;
+  }
+
+ private:
+  // Заголовок сохраненного дерева
+  struct StorageHeader {
+    std::uint32_t magic;
+    std::uint32_t node_size;
+    index_type node_count;
+    index_type root;
+    index_type free_head;
+    index_type size;
+  };
+
+  // "S21T"
+  static constexpr std::uint32_t kStorageMagic = 0x54313253U;
+
+  // Доступ к узлу без проверки границ (индексы внутри дерева всегда валидны)
+  tree_node &At(index_type index) noexcept { return nodes_.data()[index]; }
+
+  const tree_node &At(index_type index) const noexcept {
+    return nodes_.data()[index];
+  }
+
+  /**
+   * @brief Проверяет связи прочитанного буфера (см. Load()). Индексы уже
+   * проверены на выход за границы.
+   *
+   * @throw std::runtime_error если связи повреждены
+   */
+  static void CheckLinks(const s21::vector<tree_node> &nodes,
+                         const StorageHeader &header) {
+    auto fail = [](const char *what) {
+      throw std::runtime_error(std::string("s21::IndexedRedBlackTree::Load ") +
+                               what);
+    };
+    auto valid_color = [](std::uint8_t color) {
+      return color == pBlack || color == pRed;
+    };
+    const tree_node *at = nodes.data();
+    if (at[kNil].color_ != pBlack) fail("NIL node is not black");
+    if (header.root != kNil && at[header.root].parent_ != kNil)
+      fail("Root has a parent");
+
+    // Обход от корня: ячейка, встреченная второй раз, означает цикл
+    s21::vector<std::uint8_t> visited(header.node_count);
+    visited.data()[kNil] = 1U;
+    s21::vector<index_type> pending;
+    if (header.root != kNil) pending.push_back(header.root);
+    index_type reachable = 0;
+    while (!pending.empty()) {
+      index_type node = pending.back();
+      pending.pop_back();
+      if (visited.data()[node]) fail("Tree links form a cycle");
+      visited.data()[node] = 1U;
+      if (!valid_color(at[node].color_)) fail("Invalid node color");
+      if (++reachable > header.size) fail("Size does not match the tree");
+      for (index_type child : {at[node].left_, at[node].right_}) {
+        if (child == kNil) continue;
+        if (at[child].parent_ != node) fail("Broken parent link");
+        pending.push_back(child);
+      }
+    }
+    if (reachable != header.size) fail("Size does not match the tree");
+
+    // Свободные ячейки - ровно те, что не попали в дерево
+    index_type free_count = 0;
+    for (index_type cell = header.free_head; cell != kNil;
+         cell = at[cell].right_) {
+      if (visited.data()[cell]) fail("Free list overlaps live nodes");
+      visited.data()[cell] = 1U;
+      ++free_count;
+    }
+    if (free_count != header.node_count - 1U - header.size)
+      fail("Free list does not cover unused cells");
+  }
+
+  /**
+   * @brief Выделяет ячейку под новый узел: сначала из списка свободных, затем
+   * в конце буфера.
+   */
+  index_type AllocateNode(const key_type &key) {
+    tree_node node{key, kNil, kNil, kNil, pRed};
+
+    if (free_head_ != kNil) {
+      index_type index = free_head_;
+      free_head_ = At(index).right_;
+      At(index) = std::move(node);
+      return index;
+    }
+
+    if (nodes_.size() > MaxSize())
+      throw std::length_error(
+          "s21::IndexedRedBlackTree::Insert Too many elements for 32-bit "
+          "indices");
+
+    nodes_.push_back(std::move(node));
+    return static_cast<index_type>(nodes_.size() - 1U);
+  }
+
+  /**
+   * @brief Возвращает ячейку в список свободных. Ключ сбрасывается, чтобы
+   * освободить ресурсы, которыми он владеет.
+   */
+  void FreeNode(index_type index) noexcept {
+    At(index) = tree_node{};
+    At(index).right_ = free_head_;
+    free_head_ = index;
+  }
+
+  std::pair<iterator, bool> Insert(const key_type &key, bool unique_only) {
+    index_type parent = kNil;
+    index_type node = root_;
+
+    while (node != kNil) {
+      parent = node;
+      if (cmp_(key, At(node).key_)) {
+        node = At(node).left_;
+      } else if (unique_only && !cmp_(At(node).key_, key)) {
+        return {iterator(this, node), false};
+      } else {
+        node = At(node).right_;
+      }
+    }
+
+    // key может ссылаться на элемент этого же буфера, поэтому после
+    // AllocateNode() (возможное перевыделение) используем только копию ключа
+    // в новом узле.
+    index_type new_node = AllocateNode(key);
+    At(new_node).parent_ = parent;
+
+    if (parent == kNil) {
+      root_ = new_node;
+    } else if (cmp_(At(new_node).key_, At(parent).key_)) {
+      At(parent).left_ = new_node;
+    } else {
+      At(parent).right_ = new_node;
+    }
+
+    ++size_;
+    BalancingInsert(new_node);
+
+    return {iterator(this, new_node), true};
+  }
+
+  /**
+   * @brief Балансировка после вставки (случаи те же, что и в
+   * RedBlackTree::BalancingInsert()).
+   */
+  void BalancingInsert(index_type node) noexcept {
+    while (At(At(node).parent_).color_ == pRed) {
+      index_type parent = At(node).parent_;
+      index_type gparent = At(parent).parent_;
+
+      if (parent == At(gparent).left_) {
+        index_type uncle = At(gparent).right_;
+        if (At(uncle).color_ == pRed) {
+          At(parent).color_ = pBlack;
+          At(uncle).color_ = pBlack;
+          At(gparent).color_ = pRed;
+          node = gparent;
+        } else {
+          if (node == At(parent).right_) {
+            node = parent;
+            RotateLeft(node);
+            parent = At(node).parent_;
+          }
+          At(parent).color_ = pBlack;
+          At(gparent).color_ = pRed;
+          RotateRight(gparent);
+        }
+      } else {
+        index_type uncle = At(gparent).left_;
+        if (At(uncle).color_ == pRed) {
+          At(parent).color_ = pBlack;
+          At(uncle).color_ = pBlack;
+          At(gparent).color_ = pRed;
+          node = gparent;
+        } else {
+          if (node == At(parent).left_) {
+            node = parent;
+            RotateRight(node);
+            parent = At(node).parent_;
+          }
+          At(parent).color_ = pBlack;
+          At(gparent).color_ = pRed;
+          RotateLeft(gparent);
+        }
+      }
+    }
+
+    At(root_).color_ = pBlack;
+  }
+
+  /**
+   * @brief Балансировка после удаления черного узла (случаи те же, что и в
+   * RedBlackTree::EraseBalancing()).
+   *
+   * @param node Узел, занявший место удаленного (может быть NIL-узлом, его
+   * parent_ при этом выставлен в Transplant())
+   */
+  void EraseBalancing(index_type node) noexcept {
+    while (node != root_ && At(node).color_ == pBlack) {
+      index_type parent = At(node).parent_;
+
+      if (node == At(parent).left_) {
+        index_type sibling = At(parent).right_;
+
+        if (At(sibling).color_ == pRed) {
+          At(sibling).color_ = pBlack;
+          At(parent).color_ = pRed;
+          RotateLeft(parent);
+          sibling = At(parent).right_;
+        }
+
+        if (At(At(sibling).left_).color_ == pBlack &&
+            At(At(sibling).right_).color_ == pBlack) {
+          At(sibling).color_ = pRed;
+          node = parent;
+        } else {
+          if (At(At(sibling).right_).color_ == pBlack) {
+            At(At(sibling).left_).color_ = pBlack;
+            At(sibling).color_ = pRed;
+            RotateRight(sibling);
+            sibling = At(parent).right_;
+          }
+          At(sibling).color_ = At(parent).color_;
+          At(parent).color_ = pBlack;
+          At(At(sibling).right_).color_ = pBlack;
+          RotateLeft(parent);
+          node = root_;
+        }
+      } else {
+        index_type sibling = At(parent).left_;
+
+        if (At(sibling).color_ == pRed) {
+          At(sibling).color_ = pBlack;
+          At(parent).color_ = pRed;
+          RotateRight(parent);
+          sibling = At(parent).left_;
+        }
+
+        if (At(At(sibling).right_).color_ == pBlack &&
+            At(At(sibling).left_).color_ == pBlack) {
+          At(sibling).color_ = pRed;
+          node = parent;
+        } else {
+          if (At(At(sibling).left_).color_ == pBlack) {
+            At(At(sibling).right_).color_ = pBlack;
+            At(sibling).color_ = pRed;
+            RotateLeft(sibling);
+            sibling = At(parent).left_;
+          }
+          At(sibling).color_ = At(parent).color_;
+          At(parent).color_ = pBlack;
+          At(At(sibling).left_).color_ = pBlack;
+          RotateRight(parent);
+          node = root_;
+        }
+      }
+    }
+
+    At(node).color_ = pBlack;
+  }
+
+  /**
+   * @brief Ставит поддерево replace на место поддерева node.
+   */
+  void Transplant(index_type node, index_type replace) noexcept {
+    index_type parent = At(node).parent_;
+
+    if (parent == kNil) {
+      root_ = replace;
+    } else if (node == At(parent).left_) {
+      At(parent).left_ = replace;
+    } else {
+      At(parent).right_ = replace;
+    }
+
+    At(replace).parent_ = parent;
+  }
+
+  void RotateLeft(index_type node) noexcept {
+    index_type pivot = At(node).right_;
+
+    At(node).right_ = At(pivot).left_;
+    if (At(pivot).left_ != kNil) At(At(pivot).left_).parent_ = node;
+
+    index_type parent = At(node).parent_;
+    At(pivot).parent_ = parent;
+    if (parent == kNil) {
+      root_ = pivot;
+    } else if (node == At(parent).left_) {
+      At(parent).left_ = pivot;
+    } else {
+      At(parent).right_ = pivot;
+    }
+
+    At(pivot).left_ = node;
+    At(node).parent_ = pivot;
+  }
+
+  void RotateRight(index_type node) noexcept {
+    index_type pivot = At(node).left_;
+
+    At(node).left_ = At(pivot).right_;
+    if (At(pivot).right_ != kNil) At(At(pivot).right_).parent_ = node;
+
+    index_type parent = At(node).parent_;
+    At(pivot).parent_ = parent;
+    if (parent == kNil) {
+      root_ = pivot;
+    } else if (node == At(parent).right_) {
+      At(parent).right_ = pivot;
+    } else {
+      At(parent).left_ = pivot;
+    }
+
+    At(pivot).right_ = node;
+    At(node).parent_ = pivot;
+  }
+
+  index_type Minimum(index_type node) const noexcept {
+    if (node == kNil) return kNil;
+    while (At(node).left_ != kNil) node = At(node).left_;
+    return node;
+  }
+
+  index_type Maximum(index_type node) const noexcept {
+    if (node == kNil) return kNil;
+    while (At(node).right_ != kNil) node = At(node).right_;
+    return node;
+  }
+
+  index_type NextNode(index_type node) const noexcept {
+    if (node == kNil) return kNil;
+    if (At(node).right_ != kNil) return Minimum(At(node).right_);
+
+    index_type parent = At(node).parent_;
+    while (parent != kNil && node == At(parent).right_) {
+      node = parent;
+      parent = At(parent).parent_;
+    }
+
+    return parent;
+  }
+
+  index_type PrevNode(index_type node) const noexcept {
+    // Декремент End() дает последний элемент
+    if (node == kNil) return Maximum(root_);
+    if (At(node).left_ != kNil) return Maximum(At(node).left_);
+
+    index_type parent = At(node).parent_;
+    while (parent != kNil && node == At(parent).left_) {
+      node = parent;
+      parent = At(parent).parent_;
+    }
+
+    return parent;
+  }
+
+  bool CheckRedNodes(index_type node) const noexcept {
+    if (node == kNil) return true;
+    if (At(node).color_ == pRed && (At(At(node).left_).color_ == pRed ||
+                                    At(At(node).right_).color_ == pRed))
+      return false;
+    return CheckRedNodes(At(node).left_) && CheckRedNodes(At(node).right_);
+  }
+
+  int ComputeBlackHeight(index_type node) const noexcept {
+    if (node == kNil) return 0;
+
+    int left_height = ComputeBlackHeight(At(node).left_);
+    int right_height = ComputeBlackHeight(At(node).right_);
+
+    if (left_height == -1 || right_height == -1 || left_height != right_height)
+      return -1;
+
+    return left_height + (At(node).color_ == pBlack ? 1 : 0);
+  }
+
+  template <bool IsConst>
+  struct IndexedRedBlackTreeIterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = key_type;
+    using pointer = std::conditional_t<IsConst, const key_type *, key_type *>;
+    using reference =
+        std::conditional_t<IsConst, const key_type &, key_type &>;
+    using tree_pointer =
+        std::conditional_t<IsConst, const tree_type *, tree_type *>;
+
+    IndexedRedBlackTreeIterator() = delete;
+
+    IndexedRedBlackTreeIterator(tree_pointer tree, index_type index)
+        : tree_(tree), index_(index) {}
+
+    /**
+     * @brief Неконстантный итератор неявно приводится к константному.
+     */
+    template <bool OtherConst,
+              typename = std::enable_if_t<IsConst && !OtherConst>>
+    IndexedRedBlackTreeIterator(
+        const IndexedRedBlackTreeIterator<OtherConst> &other)
+        : tree_(other.tree_), index_(other.index_) {}
+
+    reference operator*() const noexcept { return tree_->At(index_).key_; }
+
+    pointer operator->() const noexcept { return &tree_->At(index_).key_; }
+
+    IndexedRedBlackTreeIterator &operator++() noexcept {
+      index_ = tree_->NextNode(index_);
+      return *this;
+    }
+
+    IndexedRedBlackTreeIterator operator++(int) noexcept {
+      IndexedRedBlackTreeIterator tmp{*this};
+      ++(*this);
+      return tmp;
+    }
+
+    IndexedRedBlackTreeIterator &operator--() noexcept {
+      index_ = tree_->PrevNode(index_);
+      return *this;
+    }
+
+    IndexedRedBlackTreeIterator operator--(int) noexcept {
+      IndexedRedBlackTreeIterator tmp{*this};
+      --(*this);
+      return tmp;
+    }
+
+    bool operator==(const IndexedRedBlackTreeIterator &other) const noexcept {
+      return index_ == other.index_;
+    }
+
+    bool operator!=(const IndexedRedBlackTreeIterator &other) const noexcept {
+      return index_ != other.index_;
+    }
+
+    tree_pointer tree_;  // Дерево, в буфере которого лежит узел.
+    index_type index_;   // Индекс узла в буфере.
+  };
+
+  s21::vector<tree_node> nodes_;  // Буфер узлов, ячейка 0 - NIL-узел.
+  index_type root_;               // Индекс корня.
+  index_type free_head_;  // Начало списка свободных ячеек (связь по right_).
+  size_type size_;        // Количество элементов.
+  Comparator cmp_;
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,428 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERS_AVLTREE_S21_REDBLACKTREENODE_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERS_AVLTREE_S21_REDBLACKTREENODE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+enum RedBlackTreeColor { pBlack, pRed };
+
+/**
+ * @brief Раскладка узла по умолчанию: цвет хранится в отдельном поле после
+ * ключа.
+ */
+struct RedBlackTreeDefaultLayout {};
+
+/**
+ * @brief Компактная раскладка узла: цвет хранится в младшем бите указателя на
+ * родителя.
+ *
+ * @details Узел содержит указатели, поэтому его адрес всегда выровнен минимум
+ * на 2 байта и младший бит указателя на родителя свободен. Отдельное поле
+ * color_ (вместе с выравниванием после ключа) исчезает, и для ключей размером
+ * 8 байт узел уменьшается с 40 до 32 байт.
+ */
+struct RedBlackTreeCompactLayout {};
+
+/**
+ * @brief Раскладка узла для строковых ключей: рядом с ключом хранятся его
+ * первые 8 байт в виде числа (префикс), цвет - как в компактной раскладке.
+ *
+ * @details При поиске префикс искомого ключа вычисляется один раз, и
+ * сравнение с узлом начинается со сравнения чисел. Байты строки (обычно в
+ * куче) читаются, только если префиксы совпали. Префикс лежит в той же
+ * кэш-линии, что и указатели узла; для std::string узел занимает 64 байта,
+ * как и в раскладке по умолчанию.
+ *
+ * Подходит для ключей, для которых определен detail::KeyPrefix (строки и
+ * пары со строкой в first, как в s21::map), и компараторов, упорядочивающих
+ * строки побайтно (std::less). Выигрыш есть, когда ключи различаются уже в
+ * первых 8 байтах; у ключей с общим началом (URL с одной схемой и хостом)
+ * префиксы почти всегда совпадают.
+ */
+struct RedBlackTreePrefixLayout {};
+
+namespace detail {
+
+/**
+ * @brief Префикс ключа для RedBlackTreePrefixLayout: первые 8 байт строки
+ * в порядке big-endian, недостающие байты - нули. Если префиксы двух строк
+ * различаются, они упорядочены так же, как сами строки.
+ */
+template <class Key, class = void>
+struct KeyPrefix;
+
+template <>
+struct KeyPrefix<std::string_view> {
+  static std::uint64_t Of(std::string_view key) noexcept {
+    std::uint64_t prefix = 0;
+    std::size_t size = std::min<std::size_t>(key.size(), 8U);
+    for (std::size_t i = 0; i < 8U; ++i) {
+      unsigned char byte =
+          i < size ? static_cast<unsigned char>(key[i]) : 0U;
+      prefix = (prefix << 8U) | byte;
+    }
+    return prefix;
+  }
+};
+
+template <class Allocator>
+struct KeyPrefix<std::basic_string<char, std::char_traits<char>, Allocator>> {
+  static std::uint64_t Of(
+      const std::basic_string<char, std::char_traits<char>, Allocator>
+          &key) noexcept {
+    return KeyPrefix<std::string_view>::Of(
+        std::string_view(key.data(), key.size()));
+  }
+};
+
+template <class First, class Second>
+struct KeyPrefix<std::pair<First, Second>> {
+  static std::uint64_t Of(const std::pair<First, Second> &key) noexcept {
+    return KeyPrefix<std::remove_const_t<First>>::Of(key.first);
+  }
+};
+
+/**
+ * @brief Согласован ли компаратор с порядком префиксов (сравнивает строки
+ * побайтно как unsigned char). Обертки над компаратором ключа (как
+ * MapValueComparator) объявляют его как wrapped_compare.
+ */
+template <class Compare, class = void>
+struct PrefixOrdered : std::false_type {};
+
+template <class Allocator>
+struct PrefixOrdered<
+    std::less<std::basic_string<char, std::char_traits<char>, Allocator>>>
+    : std::true_type {};
+
+template <>
+struct PrefixOrdered<std::less<std::string_view>> : std::true_type {};
+
+template <>
+struct PrefixOrdered<std::less<>> : std::true_type {};
+
+template <class Compare>
+struct PrefixOrdered<Compare, std::void_t<typename Compare::wrapped_compare>>
+    : PrefixOrdered<typename Compare::wrapped_compare> {};
+
+}  // namespace detail
+
+/**
+ * @brief Общая для всех раскладок часть узла: обход дерева в порядке
+ * возрастания ключей.
+ *
+ * @details Наследник (Node) должен предоставлять поля left_, right_ и методы
+ * Parent(), SetParent(), Color(), SetColor().
+ *
+ * @tparam Node Конкретный тип узла (CRTP)
+ */
+template <typename Node>
+struct RedBlackTreeNodeBase {
+  /**
+   * @brief Сброс узла к значениям по умолчанию.
+   *
+   * Сбрасывает ссылки на левый и правый потомки, родителя и цвет узла.
+   *
+   * @note Метод не выбрасывает исключения.
+   */
+  void ToDefault() noexcept {
+    Node *self = static_cast<Node *>(this);
+    self->left_ = nullptr;
+    self->right_ = nullptr;
+    self->SetParent(nullptr);
+    self->SetColor(pRed);
+  }
+
+  /**
+   * @brief Получение следующего узла в порядке обхода дерева.
+   *
+   * @return Указатель на следующий узел в порядке обхода дерева.
+   *
+   * @note Метод не выбрасывает исключения.
+   */
+  Node *NextNode() const noexcept {
+    Node *node = const_cast<Node *>(static_cast<const Node *>(this));
+    if (node->Color() == pRed &&
+        (node->Parent() == nullptr || node->Parent()->Parent() == node)) {
+      node = node->left_;
+    } else if (node->right_ != nullptr) {
+      node = node->right_;
+      while (node->left_ != nullptr) node = node->left_;
+    } else {
+      Node *parent = node->Parent();
+
+      while (node == parent->right_) {
+        node = parent;
+        parent = parent->Parent();
+      }
+
+      if (node->right_ != parent) node = parent;
+    }
+
+    return node;
+  }
+
+  /**
+   * @brief Получение предыдущего узла в порядке обхода дерева.
+   *
+   * @return Указатель на предыдущий узел в порядке обхода дерева.
+   *
+   * @note Метод не выбрасывает исключения.
+   */
+  Node *PrevNode() const noexcept {
+    Node *node = const_cast<Node *>(static_cast<const Node *>(this));
+    if (node->Color() == pRed &&
+        (node->Parent() == nullptr || node->Parent()->Parent() == node)) {
+      node = node->right_;
+    } else if (node->left_ != nullptr) {
+      node = node->left_;
+      while (node->right_ != nullptr) node = node->right_;
+    } else {
+      Node *parent = node->Parent();
+      while (node == parent->left_) {
+        node = parent;
+        parent = parent->Parent();
+      }
+
+      if (node->left_ != parent) node = parent;
+    }
+
+    return node;
+  }
+};
+
+/**
+ * @brief Узел красно-черного дерева с раскладкой по умолчанию.
+ *
+ * @tparam Key Тип ключа
+ * @tparam Layout Политика раскладки узла
+ */
+template <typename Key, typename Layout = RedBlackTreeDefaultLayout>
+struct RedBlackTreeNode
+    : RedBlackTreeNodeBase<RedBlackTreeNode<Key, Layout>> {
+  using key_type = Key;
+
+  /**
+   * @brief Конструктор по умолчанию для узла.
+   *
+   * Инициализирует узел с пустыми ссылками на левый и правый потомки,
+   * ключом по умолчанию и красным цветом.
+   */
+  RedBlackTreeNode()
+      : parent_(nullptr),
+        left_(this),
+        right_(this),
+        key_(key_type{}),
+        color_(pRed) {}
+
+  /**
+   * @brief Конструктор для узла с заданным ключом.
+   *
+   * @param key Ключ, который будет присвоен узлу.
+   *
+   * Инициализирует узел с заданным ключом, пустыми ссылками на левый и правый
+   * потомки и красным цветом.
+   */
+  RedBlackTreeNode(const key_type &key)
+      : parent_(nullptr),
+        left_(nullptr),
+        right_(nullptr),
+        key_(key),
+        color_(pRed) {}
+
+  /**
+   * @brief Конструктор для узла с заданным ключом, использующим перемещение.
+   *
+   * @param key Ключ, который будет перемещен в узел.
+   *
+   * Инициализирует узел с перемещенным ключом, пустыми ссылками на левый и
+   * правый потомки и красным цветом.
+   */
+  RedBlackTreeNode(key_type &&key)
+      : parent_(nullptr),
+        left_(nullptr),
+        right_(nullptr),
+        key_(std::move(key)),
+        color_(pRed) {}
+
+  /**
+   * @brief Конструктор для узла с заданными ключом и цветом.
+   *
+   * @param key Ключ, который будет перемещен в узел.
+   * @param color Цвет узла.
+   */
+  RedBlackTreeNode(key_type key, RedBlackTreeColor color)
+      : parent_(nullptr),
+        left_(nullptr),
+        right_(nullptr),
+        key_(std::move(key)),
+        color_(color) {}
+
+  RedBlackTreeNode *Parent() const noexcept { return parent_; }
+  void SetParent(RedBlackTreeNode *parent) noexcept { parent_ = parent; }
+  RedBlackTreeColor Color() const noexcept { return color_; }
+  void SetColor(RedBlackTreeColor color) noexcept { color_ = color; }
+
+  RedBlackTreeNode *parent_;  // Указатель на родительский узел.
+  RedBlackTreeNode *left_;    // Указатель на левый потомок.
+  RedBlackTreeNode *right_;   // Указатель на правый потомок.
+  key_type key_;              // Ключ узла.
+  RedBlackTreeColor color_;   // Цвет узла.
+};
+
+/**
+ * @brief Указатель на родителя с цветом узла в младшем бите: общая часть
+ * узлов компактной и префиксной раскладок.
+ *
+ * @details Узел содержит указатели, поэтому его адрес выровнен минимум на 2
+ * байта и младший бит указателя на родителя свободен.
+ *
+ * @tparam Node Конкретный тип узла (CRTP)
+ */
+template <typename Node>
+struct RedBlackTreeTaggedParent : RedBlackTreeNodeBase<Node> {
+  explicit RedBlackTreeTaggedParent(RedBlackTreeColor color) noexcept
+      : parent_color_(static_cast<std::uintptr_t>(color)) {}
+
+  Node *Parent() const noexcept {
+    return reinterpret_cast<Node *>(parent_color_ & ~kColorMask);
+  }
+
+  void SetParent(Node *parent) noexcept {
+    parent_color_ =
+        reinterpret_cast<std::uintptr_t>(parent) | (parent_color_ & kColorMask);
+  }
+
+  RedBlackTreeColor Color() const noexcept {
+    return static_cast<RedBlackTreeColor>(parent_color_ & kColorMask);
+  }
+
+  void SetColor(RedBlackTreeColor color) noexcept {
+    parent_color_ = (parent_color_ & ~kColorMask) |
+                    static_cast<std::uintptr_t>(color);
+  }
+
+  // Младший бит - цвет узла, остальные биты - указатель на родителя.
+  std::uintptr_t parent_color_;
+
+ private:
+  static constexpr std::uintptr_t kColorMask = 1U;
+};
+
+/**
+ * @brief Узел красно-черного дерева с компактной раскладкой: цвет упакован в
+ * младший бит указателя на родителя.
+ *
+ * @tparam Key Тип ключа
+ */
+template <typename Key>
+struct RedBlackTreeNode<Key, RedBlackTreeCompactLayout>
+    : RedBlackTreeTaggedParent<
+          RedBlackTreeNode<Key, RedBlackTreeCompactLayout>> {
+  using key_type = Key;
+  using base_type = RedBlackTreeTaggedParent<RedBlackTreeNode>;
+
+  /**
+   * @brief Узел-заголовок дерева: потомки указывают на сам узел.
+   */
+  RedBlackTreeNode()
+      : base_type(pRed), left_(this), right_(this), key_(key_type{}) {}
+
+  /**
+   * @brief Красный узел с копией ключа.
+   */
+  RedBlackTreeNode(const key_type &key)
+      : base_type(pRed), left_(nullptr), right_(nullptr), key_(key) {}
+
+  /**
+   * @brief Красный узел с перемещенным ключом.
+   */
+  RedBlackTreeNode(key_type &&key)
+      : base_type(pRed),
+        left_(nullptr),
+        right_(nullptr),
+        key_(std::move(key)) {}
+
+  /**
+   * @brief Узел с заданными ключом (перемещается) и цветом.
+   */
+  RedBlackTreeNode(key_type key, RedBlackTreeColor color)
+      : base_type(color),
+        left_(nullptr),
+        right_(nullptr),
+        key_(std::move(key)) {}
+
+  RedBlackTreeNode *left_;   // Указатель на левый потомок.
+  RedBlackTreeNode *right_;  // Указатель на правый потомок.
+  key_type key_;             // Ключ узла.
+};
+
+/**
+ * @brief Узел красно-черного дерева с префиксом ключа (см.
+ * RedBlackTreePrefixLayout).
+ *
+ * @tparam Key Тип ключа
+ */
+template <typename Key>
+struct RedBlackTreeNode<Key, RedBlackTreePrefixLayout>
+    : RedBlackTreeTaggedParent<
+          RedBlackTreeNode<Key, RedBlackTreePrefixLayout>> {
+  using key_type = Key;
+  using base_type = RedBlackTreeTaggedParent<RedBlackTreeNode>;
+
+  /**
+   * @brief Узел-заголовок дерева: потомки указывают на сам узел.
+   */
+  RedBlackTreeNode()
+      : base_type(pRed),
+        left_(this),
+        right_(this),
+        prefix_(0),
+        key_(key_type{}) {}
+
+  /**
+   * @brief Красный узел с копией ключа.
+   */
+  RedBlackTreeNode(const key_type &key)
+      : base_type(pRed),
+        left_(nullptr),
+        right_(nullptr),
+        prefix_(detail::KeyPrefix<key_type>::Of(key)),
+        key_(key) {}
+
+  /**
+   * @brief Красный узел с перемещенным ключом.
+   */
+  RedBlackTreeNode(key_type &&key)
+      : base_type(pRed),
+        left_(nullptr),
+        right_(nullptr),
+        prefix_(detail::KeyPrefix<key_type>::Of(key)),
+        key_(std::move(key)) {}
+
+  /**
+   * @brief Узел с заданными ключом (перемещается) и цветом. Префикс
+   * вычисляется до перемещения: prefix_ объявлен раньше key_.
+   */
+  RedBlackTreeNode(key_type key, RedBlackTreeColor color)
+      : base_type(color),
+        left_(nullptr),
+        right_(nullptr),
+        prefix_(detail::KeyPrefix<key_type>::Of(key)),
+        key_(std::move(key)) {}
+
+  RedBlackTreeNode *left_;   // Указатель на левый потомок.
+  RedBlackTreeNode *right_;  // Указатель на правый потомок.
+  std::uint64_t prefix_;     // Первые 8 байт ключа (KeyPrefix).
+  key_type key_;             // Ключ узла.
+};
+
+}  // namespace s21
+
+#endif
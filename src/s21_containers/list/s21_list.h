@@ -5,8 +5,17 @@
 #include <iterator>
 #include <limits>
 
+#include "../policy/s21_storage_policy.h"
+
 namespace s21 {
-template <typename Type>
+/**
+ * @brief Двусвязный список с фиктивным узлом-головой.
+ *
+ * @tparam Type Тип элементов
+ * @tparam Storage Политика хранения list_policy<Allocator> (см.
+ * s21_storage_policy.h)
+ */
+template <typename Type, typename Storage = list_policy<>>
 class list {
  private:
   struct ListNode;
@@ -29,13 +38,16 @@ class list {
 
   // Внутренний класс узла списка
   using node_type = ListNode;
+  // Аллокатор узлов из политики хранения
+  using allocator_type =
+      typename Storage::template allocator_type<node_type>;
 
   /**
    * @brief Конструктор по умолчанию для списка.
    * Создает пустой список без элементов.
    * @note Инициализирует голову списка как новый узел с пустым значением.
    */
-  list() : head_(new node_type{}), size_(0U) {}
+  list() : head_(CreateNode()), size_(0U) {}
 
   /**
    * @brief Конструктор списка с заданным количеством элементов.
@@ -137,7 +149,7 @@ class list {
    */
   ~list() {
     clear();
-    delete head_;
+    DestroyNode(head_);
     head_ = nullptr;
   }
 
@@ -259,7 +271,7 @@ class list {
    * списку перед указанным итератором.
    */
   iterator insert(iterator pos, const_reference value) {
-    node_type *new_node = new node_type(value);
+    node_type *new_node = CreateNode(value);
     pos.node_->AttachPrev(new_node);
     ++size_;
 
@@ -275,7 +287,7 @@ class list {
   void erase(iterator pos) noexcept {
     if (pos != end()) {
       pos.node_->UnAttach();
-      delete pos.node_;
+      DestroyNode(pos.node_);
       --size_;
     }
   }
@@ -478,7 +490,7 @@ class list {
     node_type *new_node;
 
     for (auto item : {std::forward<Args>(args)...}) {
-      new_node = new node_type(std::move(item));
+      new_node = CreateNode(std::move(item));
       it_current.node_->AttachPrev(new_node);
       ++size_;
     }
@@ -615,6 +627,17 @@ class list {
     }
   }
 
+  // Узлы создаются и удаляются только через аллокатор политики хранения
+  template <typename... Args>
+  static node_type *CreateNode(Args &&...args) {
+    return detail::NodeAllocation<node_type, allocator_type>::Create(
+        std::forward<Args>(args)...);
+  }
+
+  static void DestroyNode(node_type *node) noexcept {
+    detail::NodeAllocation<node_type, allocator_type>::Destroy(node);
+  }
+
   struct ListNode {
     /**
      * @brief Конструктор по умолчанию для создания пустого узла.
@@ -6,7 +6,17 @@
 #include "../AVLTree/AVLTree.h"
 
 namespace s21 {
-template <class Key, class Type>
+/**
+ * @brief Словарь на красно-черном дереве.
+ *
+ * @tparam Key Тип ключа
+ * @tparam Type Тип значения
+ * @tparam Compare Функция сравнения ключей; компаратор без состояния не
+ * увеличивает размер контейнера
+ * @tparam Storage Политика хранения дерева (см. s21_storage_policy.h)
+ */
+template <class Key, class Type, class Compare = std::less<Key>,
+          class Storage = tree_policy<>>
 class map {
  public:
   // Тип ключа элемента (Key — параметр шаблона)
@@ -19,19 +29,44 @@ class map {
   using reference = value_type &;
   // Тип константной ссылки на элемент
   using const_reference = const value_type &;
+  // Функция сравнения ключей
+  using key_compare = Compare;
 
   // Компаратор. Для словаря у нас элементы дерева будут считаться равными,
   // если у них равны ключи, значение пары ключ-значение при этом ни на что не
   // влияет.
-  struct MapValueComparator {
-    bool operator()(const_reference value1,
-                    const_reference value2) const noexcept {
-      return value1.first < value2.first;
+  struct MapValueComparator : private detail::EmptyBaseHolder<key_compare> {
+    // Компаратор ключей (нужен, например, RedBlackTreePrefixLayout)
+    using wrapped_compare = key_compare;
+
+    MapValueComparator() = default;
+    explicit MapValueComparator(const key_compare &comp)
+        : detail::EmptyBaseHolder<key_compare>(comp) {}
+
+    bool operator()(const_reference value1, const_reference value2) const {
+      return KeyComp()(value1.first, value2.first);
+    }
+
+    const key_compare &KeyComp() const noexcept { return this->Get(); }
+  };
+
+  // Сравнение элемента дерева с ключом для пакетного поиска (find_many),
+  // чтобы не собирать для каждого ключа пару value_type(key, mapped_type{}).
+  struct MapKeyComparator {
+    bool operator()(const_reference value, const key_type &key) const {
+      return comp_(value.first, key);
     }
+    bool operator()(const key_type &key, const_reference value) const {
+      return comp_(key, value.first);
+    }
+
+    const key_compare &comp_;
   };
 
+  // Функция сравнения элементов: сравнивает ключи пар
+  using value_compare = MapValueComparator;
   // Внутренний класс для дерева
-  using tree_type = RedBlackTree<value_type, MapValueComparator>;
+  using tree_type = RedBlackTree<value_type, MapValueComparator, Storage>;
   // Внутренний класс для итератора
   using iterator = typename tree_type::iterator;
   // Внутренний класс для константного итератора
@@ -44,6 +79,14 @@ class map {
    */
   map() : tree_(new tree_type{}) {}
 
+  /**
+   * @brief Создает пустой словарь с заданной функцией сравнения ключей.
+   *
+   * @param comp Функция сравнения ключей
+   */
+  explicit map(const key_compare &comp)
+      : tree_(new tree_type(MapValueComparator(comp))) {}
+
   /**
    * @brief Конструктор списка инициализаторов, создает словарь,
    * инициализированный с помощью std::initializer_list.
@@ -56,6 +99,24 @@ class map {
     }
   }
 
+  /**
+   * @brief Конструктор из диапазона пар с политикой выполнения.
+   *
+   * @details Пары сортируются по ключу (при s21::execution::par -
+   * параллельно), из пар с одинаковым ключом остается первая (как при
+   * последовательных insert()), и сбалансированное дерево строится за
+   * линейное время. Подробнее см. Build() в реализации дерева.
+   *
+   * @param policy Политика выполнения (s21::execution::seq или par)
+   * @param first, last Диапазон пар ключ-значение
+   */
+  template <typename Policy, typename InputIt,
+            typename =
+                std::enable_if_t<execution::is_execution_policy_v<Policy>>>
+  map(Policy &&policy, InputIt first, InputIt last) : map() {
+    tree_->Build(policy, first, last, true);
+  }
+
   /**
    * @brief Конструктор копирования (Copy Constructor). Создает словарь путем
    * копирования данных из объекта other.
@@ -132,7 +193,7 @@ class map {
    * @return const mapped_type&
    */
   const mapped_type &at(const key_type &key) const {
-    return const_cast<map<Key, Type> *>(this)->at(key);
+    return const_cast<map *>(this)->at(key);
   }
 
   /**
@@ -224,6 +285,16 @@ class map {
    */
   size_type max_size() const noexcept { return tree_->MaxSize(); }
 
+  /**
+   * @brief Функция сравнения ключей.
+   */
+  key_compare key_comp() const { return tree_->KeyComp().KeyComp(); }
+
+  /**
+   * @brief Функция сравнения элементов (пар) по ключам.
+   */
+  value_compare value_comp() const { return tree_->KeyComp(); }
+
   /**
    * @brief Удаляет содержимое контейнера (все элементы). Контейнер при этом
    * остается консистентным.
@@ -287,6 +358,39 @@ class map {
     return {result, false};
   }
 
+  /**
+   * @brief Вставляет пакет элементов [first, last). Элементы с ключами, уже
+   * присутствующими в словаре, не вставляются (из одинаковых ключей внутри
+   * пакета вставляется первый), как при вызове insert() для каждого.
+   *
+   * @details Пакет сортируется и вставляется за один проход по дереву: поиск
+   * места каждого следующего ключа начинается от предыдущего вставленного
+   * узла, а не от корня (см. InsertBatch() в реализации дерева).
+   *
+   * @param first, last Диапазон пар ключ-значение
+   * @return size_type Количество вставленных элементов
+   */
+  template <typename InputIt>
+  size_type insert_batch(InputIt first, InputIt last) {
+    return tree_->InsertBatch(first, last, true);
+  }
+
+  /**
+   * @brief Пакетный аналог insert_or_assign() (upsert): новые ключи
+   * вставляются, для существующих присваивается значение из пакета. Из
+   * одинаковых ключей внутри пакета побеждает последний.
+   *
+   * @param first, last Диапазон пар ключ-значение
+   * @return size_type Количество вставленных (новых) элементов
+   */
+  template <typename InputIt>
+  size_type insert_or_assign_batch(InputIt first, InputIt last) {
+    return tree_->UpsertBatch(first, last,
+                              [](reference existing, value_type &&incoming) {
+                                existing.second = std::move(incoming.second);
+                              });
+  }
+
   /**
    * @brief Удаляет элемент на позиции pos. Ссылки и итераторы на стертые
    * элементы становятся недействительными. Другие ссылки и итераторы не
@@ -328,6 +432,39 @@ class map {
     return !(it_search == end());
   }
 
+  /**
+   * @brief Пакетный поиск: для каждого ключа из [keys_first, keys_last)
+   * записывает в out итератор на элемент с этим ключом или end().
+   *
+   * @details Поиски идут группами с чередованием спусков и упреждающей
+   * загрузкой узлов (см. FindMany() в реализации дерева), поэтому на больших
+   * словарях это заметно быстрее цикла из отдельных поисков.
+   *
+   * @param keys_first, keys_last Диапазон искомых ключей (forward-итераторы)
+   * @param out Итератор вывода для результатов
+   * @return OutputIt Итератор вывода за последним записанным результатом
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt keys_first, ForwardIt keys_last, OutputIt out) {
+    return tree_->FindMany(keys_first, keys_last, out,
+                           MapKeyComparator{tree_->KeyComp().KeyComp()});
+  }
+
+  /**
+   * @brief Пакетная проверка наличия ключей, аналог find_many(), записывающий
+   * в out значения bool.
+   *
+   * @param keys_first, keys_last Диапазон проверяемых ключей
+   * @param out Итератор вывода для результатов
+   * @return OutputIt Итератор вывода за последним записанным результатом
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt keys_first, ForwardIt keys_last,
+                         OutputIt out) const {
+    return tree_->ContainsMany(keys_first, keys_last, out,
+                               MapKeyComparator{tree_->KeyComp().KeyComp()});
+  }
+
   /**
    * @brief Размещает новые элементы args в контейнер, если контейнер ещё не
    * содержит элемент с эквивалентным ключом.
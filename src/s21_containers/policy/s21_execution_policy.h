@@ -0,0 +1,346 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERS_POLICY_S21_EXECUTION_POLICY_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERS_POLICY_S21_EXECUTION_POLICY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../thread_pool/s21_thread_pool.h"
+
+namespace s21 {
+namespace execution {
+
+/**
+ * @brief Политика последовательного выполнения: алгоритм выполняется в
+ * вызывающем потоке (аналог std::execution::seq).
+ */
+class sequenced_policy {};
+
+/**
+ * @brief Политика параллельного выполнения на пуле потоков (аналог
+ * std::execution::par). По умолчанию используется thread_pool::global(),
+ * другой пул задается через par.on(pool).
+ */
+class parallel_policy {
+ public:
+  constexpr parallel_policy() noexcept : pool_(nullptr) {}
+  explicit parallel_policy(thread_pool &pool) noexcept : pool_(&pool) {}
+
+  parallel_policy on(thread_pool &pool) const noexcept {
+    return parallel_policy(pool);
+  }
+
+  thread_pool &pool() const {
+    return pool_ ? *pool_ : thread_pool::global();
+  }
+
+ private:
+  thread_pool *pool_;
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+
+template <typename T>
+struct is_execution_policy : std::false_type {};
+template <>
+struct is_execution_policy<sequenced_policy> : std::true_type {};
+template <>
+struct is_execution_policy<parallel_policy> : std::true_type {};
+
+template <typename T>
+inline constexpr bool is_execution_policy_v =
+    is_execution_policy<std::remove_cv_t<std::remove_reference_t<T>>>::value;
+
+}  // namespace execution
+
+namespace detail {
+
+using size_type = std::size_t;
+
+// Меньше стольких элементов на часть делить диапазон не имеет смысла:
+// накладные расходы на задачу станут сравнимы с самой работой
+inline constexpr size_type kMinChunkSize = 2048U;
+// На сколько частей в среднем делим работу на один поток пула: запас частей
+// позволяет выровнять нагрузку перехватом задач
+inline constexpr size_type kChunksPerThread = 4U;
+
+template <typename It>
+inline constexpr bool is_random_access_v = std::is_base_of_v<
+    std::random_access_iterator_tag,
+    typename std::iterator_traits<It>::iterator_category>;
+
+// Итератор красно-черного дерева: умеет делить диапазон по поддеревьям
+template <typename It, typename = void>
+struct is_tree_iterator : std::false_type {};
+template <typename It>
+struct is_tree_iterator<It, std::void_t<decltype(It::tree_type::SplitRange(
+                                std::declval<It>(), std::declval<It>()))>>
+    : std::true_type {};
+
+template <typename It>
+inline constexpr bool is_splittable_v =
+    is_random_access_v<It> || is_tree_iterator<It>::value;
+
+template <typename Policy>
+inline constexpr bool is_parallel_v =
+    std::is_same_v<std::remove_cv_t<std::remove_reference_t<Policy>>,
+                   execution::parallel_policy>;
+
+template <typename Policy, typename T>
+using enable_if_policy_t =
+    std::enable_if_t<execution::is_execution_policy_v<Policy>, T>;
+
+// Рекурсивно делит диапазон дерева пополам depth раз
+template <typename It>
+void SplitTreeRange(It first, It last, int depth, std::vector<It> &bounds) {
+  It mid = depth > 0 ? It::tree_type::SplitRange(first, last) : last;
+  if (mid == last) {
+    bounds.push_back(last);
+    return;
+  }
+  SplitTreeRange(first, mid, depth - 1, bounds);
+  SplitTreeRange(mid, last, depth - 1, bounds);
+}
+
+/**
+ * @brief Делит [first, last) на части для параллельной обработки.
+ *
+ * @return Границы частей: first, ..., last (частей на одну меньше).
+ * Диапазон с произвольным доступом делится на равные части, диапазон дерева -
+ * по поддеревьям, остальные диапазоны не делятся.
+ */
+template <typename It>
+std::vector<It> SplitRange(It first, It last, size_type parts) {
+  std::vector<It> bounds{first};
+  if constexpr (is_random_access_v<It>) {
+    size_type size = static_cast<size_type>(last - first);
+    parts = std::max<size_type>(1, std::min(parts, size / kMinChunkSize));
+    for (size_type i = 1; i <= parts; ++i)
+      bounds.push_back(first + static_cast<std::ptrdiff_t>(size * i / parts));
+  } else if constexpr (is_tree_iterator<It>::value) {
+    int depth = 0;
+    while ((size_type{1} << depth) < parts) ++depth;
+    SplitTreeRange(first, last, depth, bounds);
+  } else {
+    (void)parts;
+    bounds.push_back(last);
+  }
+  return bounds;
+}
+
+template <typename It>
+std::vector<It> SplitRange(thread_pool &pool, It first, It last) {
+  return SplitRange(first, last, pool.size() * kChunksPerThread);
+}
+
+// Смещение начала каждой части от first (последний элемент - общий размер)
+template <typename It>
+std::vector<size_type> ChunkOffsets(thread_pool &pool,
+                                    const std::vector<It> &bounds) {
+  size_type chunks = bounds.size() - 1;
+  std::vector<size_type> offsets(chunks + 1, 0U);
+  if constexpr (is_random_access_v<It>) {
+    for (size_type i = 1; i <= chunks; ++i)
+      offsets[i] = static_cast<size_type>(bounds[i] - bounds[0]);
+  } else {
+    pool.parallel_for(chunks, [&](size_type i) {
+      offsets[i + 1] =
+          static_cast<size_type>(std::distance(bounds[i], bounds[i + 1]));
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  }
+  return offsets;
+}
+
+/**
+ * @brief Сколько элементов первой из двух отсортированных последовательностей
+ * a[0, na) и b[0, nb) попадает в первые k элементов их устойчивого слияния.
+ *
+ * @details Бинарный поиск по "пути слияния" (merge path): позволяет разбить
+ * одно слияние на независимые части по выходным позициям.
+ */
+template <typename It, typename Compare>
+size_type MergeSplit(It a, size_type na, It b, size_type nb, size_type k,
+                     Compare &comp) {
+  size_type lo = k > nb ? k - nb : 0;
+  size_type hi = std::min(k, na);
+  while (lo < hi) {
+    size_type i = lo + (hi - lo) / 2;
+    size_type j = k - i;
+    // Достаточно ли взять i элементов из a: следующий из a должен быть
+    // строго больше последнего взятого из b
+    if (j == 0 || comp(b[j - 1], a[i])) {
+      hi = i;
+    } else {
+      lo = i + 1;
+    }
+  }
+  return lo;
+}
+
+/**
+ * @brief Выполняет fn(i) для i из [0, count): параллельно на пуле политики
+ * или последовательно для sequenced_policy.
+ */
+template <typename Policy, typename Fn>
+void ForEachIndex(const Policy &policy, size_type count, Fn &&fn) {
+  if constexpr (is_parallel_v<Policy>) {
+    policy.pool().parallel_for(count, fn);
+  } else {
+    (void)policy;
+    for (size_type i = 0; i < count; ++i) fn(i);
+  }
+}
+
+/**
+ * @brief Сливает отсортированные подряд идущие части [offsets[i],
+ * offsets[i + 1]) диапазона first в одну отсортированную последовательность.
+ *
+ * @details Части сливаются попарно раундами через буфер на n элементов;
+ * каждое слияние делится на независимые куски по выходным позициям через
+ * MergeSplit(), так что при параллельной политике параллельны и последние
+ * раунды. Слияние устойчиво: из равных элементов раньше идут элементы из
+ * частей с меньшим номером.
+ */
+template <typename Policy, typename RandomIt, typename Compare>
+void MergeRuns(const Policy &policy, RandomIt first,
+               std::vector<size_type> offsets, Compare comp) {
+  using value_type = typename std::iterator_traits<RandomIt>::value_type;
+  if (offsets.size() <= 2) return;
+  RandomIt last = first + static_cast<std::ptrdiff_t>(offsets.back());
+  size_type size = offsets.back();
+  std::vector<value_type> buffer(std::make_move_iterator(first),
+                                 std::make_move_iterator(last));
+  // Исходные данные теперь в buffer; слияния идут из src в dst
+  bool in_buffer = true;
+  size_type piece = size;
+  if constexpr (is_parallel_v<Policy>)
+    piece = std::max(kMinChunkSize, size / (policy.pool().size() * 2 + 1));
+
+  while (offsets.size() > 2) {
+    struct MergeTask {
+      size_type lo, mid, hi;  // Сливаемые части [lo, mid) и [mid, hi).
+      size_type out_lo, out_hi;  // Выходные позиции относительно lo.
+    };
+    std::vector<MergeTask> tasks;
+    std::vector<size_type> next_offsets{0};
+    for (size_type i = 0; i + 1 < offsets.size(); i += 2) {
+      size_type lo = offsets[i];
+      size_type mid = offsets[i + 1];
+      size_type hi = i + 2 < offsets.size() ? offsets[i + 2] : mid;
+      for (size_type k = 0; k < hi - lo || k == 0; k += piece)
+        tasks.push_back({lo, mid, hi, k, std::min(k + piece, hi - lo)});
+      next_offsets.push_back(hi);
+    }
+
+    auto merge = [&](auto src, auto dst) {
+      ForEachIndex(policy, tasks.size(), [&](size_type t) {
+        const MergeTask &task = tasks[t];
+        auto a = src + static_cast<std::ptrdiff_t>(task.lo);
+        auto b = src + static_cast<std::ptrdiff_t>(task.mid);
+        size_type na = task.mid - task.lo;
+        size_type nb = task.hi - task.mid;
+        size_type i_lo = MergeSplit(a, na, b, nb, task.out_lo, comp);
+        size_type i_hi = MergeSplit(a, na, b, nb, task.out_hi, comp);
+        size_type j_lo = task.out_lo - i_lo;
+        size_type j_hi = task.out_hi - i_hi;
+        std::merge(std::make_move_iterator(a + i_lo),
+                   std::make_move_iterator(a + i_hi),
+                   std::make_move_iterator(b + j_lo),
+                   std::make_move_iterator(b + j_hi),
+                   dst + static_cast<std::ptrdiff_t>(task.lo + task.out_lo),
+                   comp);
+      });
+    };
+    if (in_buffer) {
+      merge(buffer.begin(), first);
+    } else {
+      merge(first, buffer.begin());
+    }
+    in_buffer = !in_buffer;
+    offsets.swap(next_offsets);
+  }
+
+  if (in_buffer) {
+    std::vector<typename std::vector<value_type>::iterator> parts{
+        buffer.begin(), buffer.end()};
+    if constexpr (is_parallel_v<Policy>)
+      parts = SplitRange(policy.pool(), buffer.begin(), buffer.end());
+    ForEachIndex(policy, parts.size() - 1, [&](size_type i) {
+      std::move(parts[i], parts[i + 1], first + (parts[i] - buffer.begin()));
+    });
+  }
+}
+
+/**
+ * @brief Параллельная сортировка слиянием: части сортируются std::sort (или
+ * std::stable_sort), затем сливаются MergeRuns(). Слияние устойчиво, так что
+ * при stable сортировка устойчива целиком.
+ */
+template <typename RandomIt, typename Compare>
+void ParallelSort(thread_pool &pool, RandomIt first, RandomIt last,
+                  Compare comp, bool stable) {
+  auto sort_chunk = [&comp, stable](RandomIt lo, RandomIt hi) {
+    if (stable) {
+      std::stable_sort(lo, hi, comp);
+    } else {
+      std::sort(lo, hi, comp);
+    }
+  };
+  std::vector<RandomIt> bounds = SplitRange(pool, first, last);
+  size_type chunks = bounds.size() - 1;
+  if (chunks < 2) {
+    sort_chunk(first, last);
+    return;
+  }
+  pool.parallel_for(chunks, [&](size_type i) {
+    sort_chunk(bounds[i], bounds[i + 1]);
+  });
+
+  std::vector<size_type> offsets(chunks + 1);
+  for (size_type i = 0; i <= chunks; ++i)
+    offsets[i] = static_cast<size_type>(bounds[i] - first);
+  MergeRuns(execution::parallel_policy(pool), first, std::move(offsets), comp);
+}
+
+/**
+ * @brief Сколько уровней рекурсивного деления пополам нужно, чтобы занять
+ * все потоки пула политики (0 для sequenced_policy).
+ */
+template <typename Policy>
+int ParallelDepth(const Policy &policy) {
+  int depth = 0;
+  if constexpr (is_parallel_v<Policy>) {
+    size_type parts = policy.pool().size() * kChunksPerThread;
+    while ((size_type{1} << depth) < parts) ++depth;
+  } else {
+    (void)policy;
+  }
+  return depth;
+}
+
+/**
+ * @brief Устойчивая сортировка [first, last): ParallelSort() при
+ * параллельной политике, иначе std::stable_sort.
+ */
+template <typename Policy, typename RandomIt, typename Compare>
+void StableSort(const Policy &policy, RandomIt first, RandomIt last,
+                Compare comp) {
+  if constexpr (is_parallel_v<Policy>) {
+    ParallelSort(policy.pool(), first, last, comp, true);
+  } else {
+    (void)policy;
+    std::stable_sort(first, last, comp);
+  }
+}
+
+}  // namespace detail
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,200 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERS_POLICY_S21_POOL_ALLOCATOR_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERS_POLICY_S21_POOL_ALLOCATOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace s21 {
+namespace detail {
+
+/**
+ * @brief Пул блоков одного размера для узловых контейнеров.
+ *
+ * @details У каждого потока свой список свободных блоков, поэтому выделение
+ * и освобождение - это одна операция над односвязным списком, без
+ * блокировок. Блоки нарезаются из кусков по kChunkBlocks штук. Лишние
+ * свободные блоки (и все блоки завершающегося потока) возвращаются в общий
+ * список под мьютексом, откуда их забирают другие потоки.
+ *
+ * Куски памяти не возвращаются системе: блок может освободить другой поток
+ * или статический объект уже после завершения main(). Общее состояние
+ * достижимо из статического указателя, поэтому средства поиска утечек его
+ * не считают утечкой.
+ *
+ * @tparam Size Размер блока
+ * @tparam Align Выравнивание блока
+ */
+template <std::size_t Size, std::size_t Align>
+class NodePool {
+ public:
+  static void *Allocate() {
+    Local &local = local_;
+    if (local.head_ == nullptr) Refill(local);
+    FreeBlock *block = local.head_;
+    local.head_ = block->next_;
+    --local.count_;
+    return block;
+  }
+
+  static void Deallocate(void *pointer) noexcept {
+    Local &local = local_;
+    FreeBlock *block = static_cast<FreeBlock *>(pointer);
+    block->next_ = local.head_;
+    local.head_ = block;
+    if (++local.count_ > kMaxLocalBlocks) Flush(local);
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock *next_;
+  };
+
+  // Тривиально разрушаемый: освобождать блоки можно и после деструкторов
+  // thread_local объектов потока
+  struct Local {
+    FreeBlock *head_;
+    std::size_t count_;
+  };
+
+  // Возвращает блоки завершающегося потока в общий список
+  struct ThreadExit {
+    ~ThreadExit() { Flush(local_); }
+  };
+
+  struct Shared {
+    std::mutex mutex_;
+    FreeBlock *head_ = nullptr;
+    std::size_t count_ = 0;
+    std::vector<void *> chunks_;
+  };
+
+  static constexpr std::size_t kAlign = std::max(Align, alignof(FreeBlock));
+  static constexpr std::size_t kBlockSize =
+      (std::max(Size, sizeof(FreeBlock)) + kAlign - 1) / kAlign * kAlign;
+  static constexpr std::size_t kChunkBlocks = 256;
+  static constexpr std::size_t kMaxLocalBlocks = 4 * kChunkBlocks;
+
+  static Shared &GetShared() {
+    static Shared *shared = new Shared;
+    return *shared;
+  }
+
+  // Забирает пачку блоков из общего списка или нарезает новый кусок
+  static void Refill(Local &local) {
+    static thread_local ThreadExit thread_exit;
+    (void)thread_exit;
+    Shared &shared = GetShared();
+    std::lock_guard<std::mutex> lock(shared.mutex_);
+    if (shared.head_ != nullptr) {
+      FreeBlock *last = shared.head_;
+      std::size_t taken = 1;
+      while (taken < kChunkBlocks && last->next_ != nullptr) {
+        last = last->next_;
+        ++taken;
+      }
+      local.head_ = shared.head_;
+      shared.head_ = last->next_;
+      last->next_ = nullptr;
+      shared.count_ -= taken;
+      local.count_ = taken;
+      return;
+    }
+    shared.chunks_.reserve(shared.chunks_.size() + 1);
+    unsigned char *chunk = static_cast<unsigned char *>(::operator new(
+        kChunkBlocks * kBlockSize, std::align_val_t(kAlign)));
+    shared.chunks_.push_back(chunk);
+    for (std::size_t i = kChunkBlocks; i-- > 0;) {
+      FreeBlock *block = reinterpret_cast<FreeBlock *>(chunk + i * kBlockSize);
+      block->next_ = local.head_;
+      local.head_ = block;
+    }
+    local.count_ = kChunkBlocks;
+  }
+
+  static void Flush(Local &local) noexcept {
+    if (local.head_ == nullptr) return;
+    FreeBlock *last = local.head_;
+    while (last->next_ != nullptr) last = last->next_;
+    Shared &shared = GetShared();
+    std::lock_guard<std::mutex> lock(shared.mutex_);
+    last->next_ = shared.head_;
+    shared.head_ = local.head_;
+    shared.count_ += local.count_;
+    local.head_ = nullptr;
+    local.count_ = 0;
+  }
+
+  static thread_local Local local_;
+};
+
+template <std::size_t Size, std::size_t Align>
+thread_local typename NodePool<Size, Align>::Local
+    NodePool<Size, Align>::local_ = {nullptr, 0};
+
+}  // namespace detail
+
+/**
+ * @brief Аллокатор узлов на основе пула блоков фиксированного размера.
+ *
+ * @details Одиночные объекты (узлы деревьев и списков) берутся из пула
+ * detail::NodePool, общего для всех типов одного размера и выравнивания;
+ * массивы выделяются обычным operator new. Аллокатор не имеет состояния и
+ * все его экземпляры равны, поэтому контейнеры могут передавать узлы друг
+ * другу (merge(), splice()).
+ *
+ * Память узлов не возвращается системе до завершения программы; пул
+ * подходит для контейнеров, которые часто вставляют и удаляют элементы.
+ *
+ * @tparam T Тип объектов
+ */
+template <class T>
+class pool_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  pool_allocator() noexcept = default;
+
+  template <class U>
+  pool_allocator(const pool_allocator<U> &) noexcept {}
+
+  [[nodiscard]] T *allocate(size_type n) {
+    if (n == 1) return static_cast<T *>(Pool::Allocate());
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *pointer, size_type n) noexcept {
+    if (n == 1) {
+      Pool::Deallocate(pointer);
+    } else {
+      std::allocator<T>().deallocate(pointer, n);
+    }
+  }
+
+  template <class U>
+  friend bool operator==(const pool_allocator &,
+                         const pool_allocator<U> &) noexcept {
+    return true;
+  }
+
+  template <class U>
+  friend bool operator!=(const pool_allocator &,
+                         const pool_allocator<U> &) noexcept {
+    return false;
+  }
+
+ private:
+  using Pool = detail::NodePool<sizeof(T), alignof(T)>;
+};
+
+}  // namespace s21
+
+#endif
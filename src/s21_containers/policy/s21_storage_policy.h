@@ -0,0 +1,173 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERS_POLICY_S21_STORAGE_POLICY_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERS_POLICY_S21_STORAGE_POLICY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include "../AVLTree/RedBlackTreeNode.h"
+#include "s21_pool_allocator.h"
+
+namespace s21 {
+
+/**
+ * @brief Стратегия роста вектора: новая емкость равна старой, умноженной на
+ * Num / Den (но не меньше требуемой).
+ *
+ * @tparam Num Числитель множителя
+ * @tparam Den Знаменатель множителя
+ */
+template <std::size_t Num, std::size_t Den>
+struct growth_factor {
+  static_assert(Num > Den && Den > 0,
+                "s21::growth_factor: the factor must be greater than 1");
+
+  static constexpr std::size_t next(std::size_t capacity,
+                                    std::size_t required) noexcept {
+    return std::max(required,
+                    capacity / Den * Num + capacity % Den * Num / Den);
+  }
+};
+
+// Удвоение: меньше перевыделений, но до половины памяти может простаивать
+using growth_double = growth_factor<2, 1>;
+// Рост в 1.5 раза: память освобожденных буферов может быть переиспользована
+using growth_one_and_half = growth_factor<3, 2>;
+
+/**
+ * @brief Политика хранения для RedBlackTree (а значит, set, map и multiset).
+ *
+ * @tparam Layout Раскладка узла (см. RedBlackTreeNode.h)
+ * @tparam Allocator Шаблон аллокатора узлов (std::allocator или
+ * s21::pool_allocator)
+ */
+template <class Layout = RedBlackTreeDefaultLayout,
+          template <class> class Allocator = std::allocator>
+struct tree_policy {
+  using layout_type = Layout;
+  template <class T>
+  using allocator_type = Allocator<T>;
+};
+
+/**
+ * @brief Политика хранения для s21::list.
+ *
+ * @tparam Allocator Шаблон аллокатора узлов
+ */
+template <template <class> class Allocator = std::allocator>
+struct list_policy {
+  template <class T>
+  using allocator_type = Allocator<T>;
+};
+
+/**
+ * @brief Политика хранения для s21::vector.
+ *
+ * @tparam Growth Стратегия роста (growth_double, growth_one_and_half или
+ * тип со статической функцией next(capacity, required))
+ * @tparam Allocator Шаблон аллокатора буфера
+ */
+template <class Growth = growth_double,
+          template <class> class Allocator = std::allocator>
+struct vector_policy {
+  using growth_type = Growth;
+  template <class T>
+  using allocator_type = Allocator<T>;
+};
+
+/**
+ * @brief Приводит параметр хранения дерева к tree_policy: политика с
+ * layout_type используется как есть, а тег раскладки (как раньше,
+ * RedBlackTreeCompactLayout) означает tree_policy<тег>.
+ */
+template <class Storage, class = void>
+struct tree_policy_traits {
+  using type = tree_policy<Storage>;
+};
+
+template <class Storage>
+struct tree_policy_traits<Storage,
+                          std::void_t<typename Storage::layout_type>> {
+  using type = Storage;
+};
+
+namespace detail {
+
+/**
+ * @brief Хранит объект без состояния (компаратор) как пустой базовый класс,
+ * чтобы он не занимал памяти в содержащем классе (empty base optimization).
+ * Объекты с состоянием и final-классы хранятся обычным полем.
+ *
+ * @tparam T Тип хранимого объекта
+ */
+template <class T, bool = std::is_empty_v<T> && !std::is_final_v<T>>
+class EmptyBaseHolder {
+ public:
+  EmptyBaseHolder() = default;
+  explicit EmptyBaseHolder(const T &value) : value_(value) {}
+
+  T &Get() noexcept { return value_; }
+  const T &Get() const noexcept { return value_; }
+
+ private:
+  T value_{};
+};
+
+template <class T>
+class EmptyBaseHolder<T, true> : private T {
+ public:
+  EmptyBaseHolder() = default;
+  explicit EmptyBaseHolder(const T &value) : T(value) {}
+
+  T &Get() noexcept { return *this; }
+  const T &Get() const noexcept { return *this; }
+};
+
+/**
+ * @brief Создание и удаление узлов контейнера через аллокатор политики.
+ *
+ * @details Контейнеры переносят узлы друг другу (merge(), splice(), обмен
+ * деревьями), поэтому поддерживаются только аллокаторы без состояния, все
+ * экземпляры которых равны: аллокатор создается на месте и не занимает
+ * памяти в контейнере.
+ *
+ * @tparam Node Тип узла
+ * @tparam Allocator Аллокатор узлов
+ */
+template <class Node, class Allocator>
+struct NodeAllocation {
+  using traits = std::allocator_traits<Allocator>;
+
+  static_assert(traits::is_always_equal::value &&
+                    std::is_default_constructible_v<Allocator>,
+                "s21 containers require a stateless, always-equal allocator");
+
+  template <class... Args>
+  static Node *Create(Args &&...args) {
+    Allocator allocator;
+    Node *node = traits::allocate(allocator, 1);
+    if constexpr (std::is_nothrow_constructible_v<Node, Args...>) {
+      traits::construct(allocator, node, std::forward<Args>(args)...);
+    } else {
+      try {
+        traits::construct(allocator, node, std::forward<Args>(args)...);
+      } catch (...) {
+        traits::deallocate(allocator, node, 1);
+        throw;
+      }
+    }
+    return node;
+  }
+
+  static void Destroy(Node *node) noexcept {
+    Allocator allocator;
+    traits::destroy(allocator, node);
+    traits::deallocate(allocator, node, 1);
+  }
+};
+
+}  // namespace detail
+}  // namespace s21
+
+#endif
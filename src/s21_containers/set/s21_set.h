@@ -13,15 +13,24 @@ namespace s21 {
  * Множество - это коллекция уникальных элементов. В этом классе реализованы
  * основные операции над множеством: вставка, удаление, поиск, проверка наличия
  * элемента и другие.
+ *
+ * @tparam Key Тип элементов множества
+ * @tparam Compare Функция сравнения ключей; компаратор без состояния не
+ * увеличивает размер контейнера
+ * @tparam Storage Политика хранения дерева: tree_policy<Layout, Allocator>
+ * или тег раскладки узла (см. s21_storage_policy.h)
  */
-template <class Key>
+template <class Key, class Compare = std::less<Key>,
+          class Storage = tree_policy<>>
 class set {
  public:
   using key_type = Key;
   using value_type = key_type;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using tree_type = RedBlackTree<value_type>;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using tree_type = RedBlackTree<value_type, key_compare, Storage>;
   using iterator = typename tree_type::iterator;
   using const_iterator = typename tree_type::const_iterator;
   using size_type = std::size_t;
@@ -32,6 +41,13 @@ class set {
    */
   set() : tree_(new tree_type{}) {}
 
+  /**
+   * @brief Создает пустой set с заданной функцией сравнения.
+   *
+   * @param comp Функция сравнения ключей
+   */
+  explicit set(const key_compare &comp) : tree_(new tree_type(comp)) {}
+
   /**
    * @brief Конструктор из инициализатора.
    * @param items Инициализатор, содержащий элементы для добавления в набор.
@@ -40,6 +56,23 @@ class set {
     for (auto item : items) insert(item);
   }
 
+  /**
+   * @brief Конструктор из диапазона с политикой выполнения.
+   *
+   * Элементы сортируются (при s21::execution::par - параллельно), дубликаты
+   * удаляются, и сбалансированное дерево строится за линейное время вместо
+   * n вставок с балансировкой.
+   *
+   * @param policy Политика выполнения (s21::execution::seq или par).
+   * @param first, last Диапазон элементов.
+   */
+  template <typename Policy, typename InputIt,
+            typename =
+                std::enable_if_t<execution::is_execution_policy_v<Policy>>>
+  set(Policy &&policy, InputIt first, InputIt last) : set() {
+    tree_->Build(policy, first, last, true);
+  }
+
   /**
    * @brief Конструктор копирования.
    * @param other Ссылка на другой объект типа set для копирования.
@@ -156,6 +189,16 @@ class set {
    */
   size_type max_size() const noexcept { return tree_->MaxSize(); }
 
+  /**
+   * @brief Функция сравнения ключей.
+   */
+  key_compare key_comp() const { return tree_->KeyComp(); }
+
+  /**
+   * @brief Функция сравнения элементов (для множества совпадает с key_comp()).
+   */
+  value_compare value_comp() const { return tree_->KeyComp(); }
+
  public:
   /**
    * @brief Очищает набор от всех элементов.
@@ -180,6 +223,21 @@ class set {
     return tree_->InsertUnique(value);
   }
 
+  /**
+   * @brief Вставляет пакет элементов в набор.
+   *
+   * Элементы, уже присутствующие в наборе, не вставляются. Пакет сортируется
+   * и вставляется за один проход по дереву: поиск места каждого следующего
+   * элемента начинается от предыдущего вставленного, а не от корня.
+   *
+   * @param first, last Диапазон вставляемых элементов.
+   * @return Количество вставленных элементов.
+   */
+  template <typename InputIt>
+  size_type insert_batch(InputIt first, InputIt last) {
+    return tree_->InsertBatch(first, last, true);
+  }
+
   /**
    * @brief Удаляет элемент из набора по указанному итератору.
    *
@@ -209,6 +267,27 @@ class set {
    */
   void merge(set &other) noexcept { tree_->MergeUnique(*other.tree_); }
 
+  /**
+   * @brief Сливает в набор сразу несколько наборов (k-way слияние).
+   *
+   * Узлы переходят из наборов [first, last) в текущий без перевыделения;
+   * элементы, уже присутствующие в результате, остаются в своих наборах, как
+   * и при merge(). В отличие от k вызовов merge() работает за
+   * O(n log k) и при s21::execution::par выполняется параллельно.
+   *
+   * @param policy Политика выполнения (s21::execution::seq или par).
+   * @param first, last Диапазон наборов-источников (например, вектор
+   * наборов или массив из указателя и количества).
+   */
+  template <typename Policy, typename ForwardIt,
+            typename =
+                std::enable_if_t<execution::is_execution_policy_v<Policy>>>
+  void merge_all(Policy &&policy, ForwardIt first, ForwardIt last) {
+    std::vector<tree_type *> sources;
+    for (; first != last; ++first) sources.push_back((*first).tree_);
+    tree_->MergeAll(policy, sources, true);
+  }
+
  public:
   /**
    * @brief Нахождение элемента по ключу.
@@ -248,10 +327,42 @@ class set {
    * @return `true`, если элемент с заданным ключом присутствует в наборе, и
    * `false` в противном случае.
    */
-  bool contains(const key_type &key) {
+  bool contains(const key_type &key) const noexcept {
     return tree_->Find(key) != tree_->End();
   }
 
+  /**
+   * @brief Пакетный поиск ключей.
+   *
+   * Для каждого ключа из [keys_first, keys_last) записывает в out итератор,
+   * который вернул бы find(). Поиски идут группами с чередованием спусков и
+   * упреждающей загрузкой узлов, поэтому на больших наборах это заметно
+   * быстрее цикла из find().
+   *
+   * @param keys_first, keys_last Диапазон искомых ключей (forward-итераторы).
+   * @param out Итератор вывода для результатов.
+   * @return Итератор вывода за последним записанным результатом.
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt keys_first, ForwardIt keys_last, OutputIt out) {
+    return tree_->FindMany(keys_first, keys_last, out);
+  }
+
+  /**
+   * @brief Пакетная проверка наличия ключей.
+   *
+   * Аналог find_many(), записывающий в out значения bool.
+   *
+   * @param keys_first, keys_last Диапазон проверяемых ключей.
+   * @param out Итератор вывода для результатов.
+   * @return Итератор вывода за последним записанным результатом.
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt keys_first, ForwardIt keys_last,
+                         OutputIt out) const {
+    return tree_->ContainsMany(keys_first, keys_last, out);
+  }
+
  public:
   /**
    * @brief Вставляет множество элементов в набор.
@@ -1,6 +1,16 @@
 // RedBlackTreeTest.cpp
+#include <cstdint>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "AVLTree/AVLTree.h"
+#include "AVLTree/IndexedRedBlackTree.h"
 #include "gtest/gtest.h"
+#include "thread_pool/s21_thread_pool.h"
 
 using namespace s21;
 
@@ -29,4 +39,410 @@ TEST(RedBlackTreeTest, MergeTrees) {
   ASSERT_EQ(tree1.GetRoot()->right_->left_->key_, 3);
   ASSERT_EQ(tree1.GetRoot()->right_->right_->key_, 5);
   ASSERT_EQ(tree1.GetRoot()->right_->right_->right_->key_, 6);
-}
\ No newline at end of file
+}
+TEST(RedBlackTreeTest, CompactLayoutNodeSize) {
+  using default_tree = RedBlackTree<std::uint64_t>;
+  using compact_tree = RedBlackTree<std::uint64_t, std::less<std::uint64_t>,
+                                    RedBlackTreeCompactLayout>;
+
+  ASSERT_LT(sizeof(compact_tree::tree_node), sizeof(default_tree::tree_node));
+  ASSERT_EQ(sizeof(compact_tree::tree_node), 4 * sizeof(void *));
+}
+
+TEST(RedBlackTreeTest, StoragePolicyTraits) {
+  using tagged = RedBlackTree<int, std::less<int>, RedBlackTreeCompactLayout>;
+  using pooled =
+      RedBlackTree<int, std::less<int>,
+                   tree_policy<RedBlackTreeCompactLayout, pool_allocator>>;
+
+  EXPECT_TRUE((std::is_same_v<tagged::layout_type, RedBlackTreeCompactLayout>));
+  EXPECT_TRUE((std::is_same_v<tagged::allocator_type,
+                              std::allocator<tagged::tree_node>>));
+  EXPECT_TRUE((std::is_same_v<pooled::tree_node, tagged::tree_node>));
+  EXPECT_TRUE((std::is_same_v<pooled::allocator_type,
+                              pool_allocator<pooled::tree_node>>));
+}
+
+TEST(RedBlackTreeTest, EmptyComparatorTakesNoSpace) {
+  struct Modulo {
+    bool operator()(int lhs, int rhs) const { return lhs % base < rhs % base; }
+    int base;
+  };
+  EXPECT_EQ(sizeof(RedBlackTree<int>), 2 * sizeof(void *));
+  EXPECT_EQ(sizeof(RedBlackTree<int, std::greater<int>>), 2 * sizeof(void *));
+  EXPECT_GT(sizeof(RedBlackTree<int, Modulo>), 2 * sizeof(void *));
+}
+
+TEST(RedBlackTreeTest, PrefixLayoutMatchesStdSet) {
+  using prefix_tree = RedBlackTree<std::string, std::less<std::string>,
+                                   RedBlackTreePrefixLayout>;
+  ASSERT_EQ(sizeof(prefix_tree::tree_node),
+            4 * sizeof(void *) + sizeof(std::string));
+
+  // Короткие ключи, общие префиксы, нулевые и "отрицательные" байты
+  std::vector<std::string> keys = {"",         "a",        "ab",
+                                   "abcdefgh", "abcdefgz", "abcdefgh1",
+                                   "abcdefgh0", "z",       "\xff\x01",
+                                   "\x7f",     "https://a", "https://b"};
+  keys.push_back(std::string("ab\0c", 4));
+  keys.push_back(std::string("ab\0", 3));
+  prefix_tree tree;
+  std::set<std::string> expected;
+  for (int round = 0; round < 2; ++round) {
+    for (const std::string &key : keys) {
+      EXPECT_EQ(tree.InsertUnique(key).second, expected.insert(key).second);
+    }
+  }
+  ASSERT_EQ(tree.Size(), expected.size());
+  auto expected_it = expected.begin();
+  for (auto it = tree.Begin(); it != tree.End(); ++it, ++expected_it)
+    EXPECT_EQ(*it, *expected_it);
+  for (const std::string &key : {std::string("abcdefg"), std::string("ab"),
+                                 std::string("https://"), std::string("zz")}) {
+    auto lower = tree.LowerBound(key);
+    auto expected_lower = expected.lower_bound(key);
+    if (expected_lower == expected.end()) {
+      EXPECT_TRUE(lower == tree.End());
+    } else {
+      EXPECT_EQ(*lower, *expected_lower);
+    }
+    EXPECT_EQ(tree.Find(key) != tree.End(), expected.count(key) == 1);
+  }
+}
+
+TEST(RedBlackTreeTest, CompactLayoutInsertErase) {
+  RedBlackTree<int, std::less<int>, RedBlackTreeCompactLayout> tree;
+  std::set<int> orig;
+
+  unsigned seed = 21;
+  for (int i = 0; i < 2000; ++i) {
+    seed = seed * 1103515245U + 12345U;
+    int value = static_cast<int>(seed % 500U);
+    tree.InsertUnique(value);
+    orig.insert(value);
+  }
+  ASSERT_TRUE(tree.CheckTree());
+
+  for (int value = 0; value < 500; value += 3) {
+    auto it = tree.Find(value);
+    if (it != tree.End()) tree.Erase(it);
+    orig.erase(value);
+  }
+  ASSERT_TRUE(tree.CheckTree());
+  ASSERT_EQ(tree.Size(), orig.size());
+
+  auto orig_it = orig.begin();
+  for (auto it = tree.Begin(); it != tree.End(); ++it, ++orig_it)
+    ASSERT_EQ(*it, *orig_it);
+
+  auto last = tree.End();
+  --last;
+  ASSERT_EQ(*last, *orig.rbegin());
+}
+
+TEST(RedBlackTreeTest, CompactLayoutCopy) {
+  RedBlackTree<int, std::less<int>, RedBlackTreeCompactLayout> tree;
+  for (int i = 0; i < 100; ++i) tree.Insert(i % 10);
+
+  RedBlackTree<int, std::less<int>, RedBlackTreeCompactLayout> copy(tree);
+  ASSERT_TRUE(copy.CheckTree());
+  ASSERT_EQ(copy.Size(), tree.Size());
+
+  auto it = tree.Begin();
+  for (auto copy_it = copy.Begin(); copy_it != copy.End(); ++copy_it, ++it)
+    ASSERT_EQ(*copy_it, *it);
+}
+
+TEST(IndexedRedBlackTreeTest, InsertFindErase) {
+  IndexedRedBlackTree<int> tree;
+  std::set<int> orig;
+
+  unsigned seed = 7;
+  for (int i = 0; i < 3000; ++i) {
+    seed = seed * 1103515245U + 12345U;
+    int value = static_cast<int>(seed % 1000U);
+    auto result = tree.InsertUnique(value);
+    ASSERT_EQ(result.second, orig.insert(value).second);
+    ASSERT_EQ(*result.first, value);
+  }
+  ASSERT_TRUE(tree.CheckTree());
+  ASSERT_EQ(tree.Size(), orig.size());
+
+  for (int value = 0; value < 1000; value += 2) {
+    auto it = tree.Find(value);
+    ASSERT_EQ(it != tree.End(), orig.count(value) == 1);
+    tree.Erase(it);
+    orig.erase(value);
+    ASSERT_TRUE(tree.CheckTree());
+  }
+  ASSERT_EQ(tree.Size(), orig.size());
+
+  auto orig_it = orig.begin();
+  for (auto it = tree.Begin(); it != tree.End(); ++it, ++orig_it)
+    ASSERT_EQ(*it, *orig_it);
+
+  auto last = tree.End();
+  --last;
+  ASSERT_EQ(*last, *orig.rbegin());
+  ASSERT_EQ(*tree.LowerBound(500), *orig.lower_bound(500));
+  ASSERT_EQ(*tree.UpperBound(501), *orig.upper_bound(501));
+}
+
+TEST(IndexedRedBlackTreeTest, ErasedSlotsAreReused) {
+  IndexedRedBlackTree<int> tree;
+  for (int i = 0; i < 100; ++i) tree.Insert(i);
+  std::size_t capacity = tree.Capacity();
+
+  for (int i = 0; i < 100; i += 2) tree.Erase(tree.Find(i));
+  for (int i = 0; i < 50; ++i) tree.Insert(1000 + i);
+
+  ASSERT_EQ(tree.Capacity(), capacity);
+  ASSERT_EQ(tree.Size(), 100U);
+  ASSERT_TRUE(tree.CheckTree());
+}
+
+TEST(IndexedRedBlackTreeTest, IteratorsSurviveGrowth) {
+  IndexedRedBlackTree<std::string> tree;
+  auto first = tree.Insert("m");
+  for (int i = 0; i < 500; ++i) tree.Insert(std::to_string(i));
+
+  ASSERT_EQ(*first, "m");
+  ASSERT_EQ(*tree.Find("m"), "m");
+}
+
+TEST(IndexedRedBlackTreeTest, CopyAndMove) {
+  IndexedRedBlackTree<int> tree;
+  for (int i = 0; i < 50; ++i) tree.Insert(i % 7);
+
+  IndexedRedBlackTree<int> copy(tree);
+  ASSERT_EQ(copy.Size(), tree.Size());
+  ASSERT_TRUE(copy.CheckTree());
+  auto it = tree.Begin();
+  for (auto copy_it = copy.Begin(); copy_it != copy.End(); ++copy_it, ++it)
+    ASSERT_EQ(*copy_it, *it);
+
+  IndexedRedBlackTree<int> moved(std::move(copy));
+  ASSERT_EQ(moved.Size(), tree.Size());
+  ASSERT_TRUE(copy.Empty());
+
+  copy = moved;
+  ASSERT_EQ(copy.Size(), tree.Size());
+  copy.Clear();
+  ASSERT_TRUE(copy.Empty());
+  ASSERT_EQ(copy.Begin(), copy.End());
+}
+
+TEST(IndexedRedBlackTreeTest, SaveLoad) {
+  IndexedRedBlackTree<long> tree;
+  for (long i = 0; i < 200; ++i) tree.InsertUnique((i * 37) % 101);
+  tree.Erase(tree.Find(5));
+
+  std::stringstream stream;
+  tree.Save(stream);
+
+  IndexedRedBlackTree<long> loaded;
+  loaded.Load(stream);
+  ASSERT_EQ(loaded.Size(), tree.Size());
+  ASSERT_TRUE(loaded.CheckTree());
+  auto it = tree.Begin();
+  for (auto loaded_it = loaded.Begin(); loaded_it != loaded.End();
+       ++loaded_it, ++it)
+    ASSERT_EQ(*loaded_it, *it);
+
+  loaded.Insert(5);
+  ASSERT_EQ(loaded.Size(), tree.Size() + 1);
+}
+
+TEST(IndexedRedBlackTreeTest, LoadRejectsGarbage) {
+  IndexedRedBlackTree<int> tree;
+  tree.Insert(1);
+  std::stringstream stream("definitely not a tree");
+  ASSERT_THROW(tree.Load(stream), std::runtime_error);
+  ASSERT_EQ(tree.Size(), 1U);
+}
+
+namespace {
+
+using IndexedTree = IndexedRedBlackTree<int>;
+
+// Сохраняет дерево с ключами 1..7 и удаленным 4, портит буфер узлов
+// функцией corrupt и проверяет, что Load() отказывается его читать
+template <typename Corrupt>
+void ExpectLoadRejects(Corrupt corrupt) {
+  IndexedTree tree;
+  for (int i = 1; i <= 7; ++i) tree.Insert(i);
+  tree.Erase(tree.Find(4));
+  std::stringstream saved;
+  tree.Save(saved);
+  std::string image = saved.str();
+  std::size_t count = 8;  // NIL, 7 узлов; ячейка ключа 4 свободна
+  auto *nodes = reinterpret_cast<IndexedTree::tree_node *>(
+      &image[image.size() - count * sizeof(IndexedTree::tree_node)]);
+  corrupt(nodes);
+
+  IndexedTree loaded;
+  loaded.Insert(100);
+  std::stringstream stream(image);
+  ASSERT_THROW(loaded.Load(stream), std::runtime_error);
+  ASSERT_EQ(loaded.Size(), 1U);
+  ASSERT_EQ(*loaded.Begin(), 100);
+}
+
+}  // namespace
+
+TEST(IndexedRedBlackTreeTest, LoadRejectsCorruptLinks) {
+  // Ячейка i + 1 хранит ключ i + 1, ячейка 4 - в списке свободных
+  // Цикл: левый потомок листа указывает на корень поддерева
+  ExpectLoadRejects([](IndexedTree::tree_node *nodes) {
+    for (int i = 1; i <= 7; ++i) {
+      if (i != 4 && nodes[i].left_ == IndexedTree::kNil &&
+          nodes[nodes[i].parent_].parent_ != IndexedTree::kNil) {
+        nodes[i].left_ = nodes[i].parent_;
+        return;
+      }
+    }
+  });
+  // Список свободных ячеек ссылается на живой узел
+  ExpectLoadRejects(
+      [](IndexedTree::tree_node *nodes) { nodes[4].right_ = 1; });
+  // Список свободных ячеек замкнут в цикл
+  ExpectLoadRejects(
+      [](IndexedTree::tree_node *nodes) { nodes[4].right_ = 4; });
+  // Неверная ссылка на родителя и недопустимый цвет
+  ExpectLoadRejects([](IndexedTree::tree_node *nodes) {
+    nodes[1].parent_ = nodes[1].parent_ == 2 ? 3 : 2;
+  });
+  ExpectLoadRejects([](IndexedTree::tree_node *nodes) { nodes[1].color_ = 7; });
+  ExpectLoadRejects(
+      [](IndexedTree::tree_node *nodes) { nodes[0].color_ = pRed; });
+}
+
+TEST(IndexedRedBlackTreeTest, LoadRejectsWrongSize) {
+  IndexedTree tree;
+  for (int i = 1; i <= 7; ++i) tree.Insert(i);
+  std::stringstream saved;
+  tree.Save(saved);
+  std::string image = saved.str();
+  // Поле size - последнее в заголовке, сразу перед буфером узлов
+  std::size_t size_offset = image.size() -
+                            8U * sizeof(IndexedTree::tree_node) -
+                            sizeof(std::uint32_t);
+  std::uint32_t wrong_size = 6;
+  image.replace(size_offset, sizeof(wrong_size),
+                reinterpret_cast<const char *>(&wrong_size),
+                sizeof(wrong_size));
+
+  IndexedTree loaded;
+  std::stringstream stream(image);
+  ASSERT_THROW(loaded.Load(stream), std::runtime_error);
+  ASSERT_TRUE(loaded.Empty());
+}
+
+TEST(RedBlackTreeTest, BuildFromUnsorted) {
+  s21::thread_pool pool(4);
+  for (std::size_t size : {0U, 1U, 2U, 3U, 7U, 8U, 1000U, 100000U}) {
+    std::vector<int> keys(size);
+    for (std::size_t i = 0; i < size; ++i)
+      keys[i] = static_cast<int>((i * 7919) % (size / 2 + 1));
+    std::set<int> expected(keys.begin(), keys.end());
+
+    s21::RedBlackTree<int> unique_tree;
+    unique_tree.Insert(-1);
+    unique_tree.Build(s21::execution::par.on(pool), keys.begin(), keys.end(),
+                      true);
+    EXPECT_TRUE(unique_tree.CheckTree());
+    ASSERT_EQ(unique_tree.Size(), expected.size());
+    auto expected_it = expected.begin();
+    for (auto it = unique_tree.Begin(); it != unique_tree.End(); ++it)
+      EXPECT_EQ(*it, *expected_it++);
+
+    s21::RedBlackTree<int, std::less<int>, s21::RedBlackTreeCompactLayout>
+        multi_tree;
+    multi_tree.Build(s21::execution::seq, keys.begin(), keys.end(), false);
+    EXPECT_TRUE(multi_tree.CheckTree());
+    EXPECT_EQ(multi_tree.Size(), size);
+  }
+}
+
+namespace {
+
+// Сравнение, которое бросает исключение на сравнении номер *limit
+struct ThrowingLess {
+  int *limit;
+  template <typename T>
+  bool operator()(const T &lhs, const T &rhs) const {
+    if (--*limit == 0) throw std::runtime_error("comparator failed");
+    return Key(lhs) < Key(rhs);
+  }
+  static const std::string &Key(const std::string &key) { return key; }
+  template <typename T>
+  static const std::string &Key(const std::pair<const std::string, T> &item) {
+    return item.first;
+  }
+};
+
+std::vector<std::string> LongKeys(int count, int step) {
+  std::vector<std::string> keys;
+  for (int i = 0; i < count; ++i)
+    keys.push_back(std::string(40, 'k') + std::to_string((i * step) % 17));
+  return keys;
+}
+
+}  // namespace
+
+// Утечки узлов при исключениях ловит LeakSanitizer (сборка с ASan)
+TEST(RedBlackTreeTest, BatchInsertSurvivesThrowingComparator) {
+  std::vector<std::string> keys = LongKeys(24, 5);
+  for (int fail_at = 1; fail_at < 400; fail_at += 3) {
+    for (bool unique_only : {true, false}) {
+      int limit = -1;
+      RedBlackTree<std::string, ThrowingLess> tree(ThrowingLess{&limit});
+      for (const std::string &key : LongKeys(6, 3)) tree.Insert(key);
+      limit = fail_at;
+      try {
+        tree.InsertBatch(keys.begin(), keys.end(), unique_only);
+      } catch (const std::runtime_error &) {
+      }
+      limit = -1;
+      ASSERT_TRUE(tree.CheckTree());
+      std::size_t count = 0;
+      for (auto it = tree.Begin(); it != tree.End(); ++it) ++count;
+      ASSERT_EQ(count, tree.Size());
+    }
+  }
+}
+
+TEST(RedBlackTreeTest, UpsertBatchSurvivesThrowingAssign) {
+  using item = std::pair<const std::string, int>;
+  std::vector<item> items;
+  for (const std::string &key : LongKeys(20, 7)) items.emplace_back(key, 1);
+  for (int fail_at = 1; fail_at < 300; fail_at += 5) {
+    int limit = -1;
+    RedBlackTree<item, ThrowingLess> tree(ThrowingLess{&limit});
+    tree.Insert(item(items[3].first, 0));
+    limit = fail_at;
+    int assigns = 0;
+    try {
+      tree.UpsertBatch(items.begin(), items.end(), [&](item &to, item &&from) {
+        if (++assigns == 2) throw std::runtime_error("assign failed");
+        to.second = from.second;
+      });
+    } catch (const std::runtime_error &) {
+    }
+    limit = -1;
+    ASSERT_TRUE(tree.CheckTree());
+  }
+
+  // Build сортирует указатели на узлы, если ключ нельзя присваивать
+  for (int fail_at = 1; fail_at < 200; fail_at += 7) {
+    int limit = -1;
+    RedBlackTree<item, ThrowingLess> tree(ThrowingLess{&limit});
+    limit = fail_at;
+    try {
+      tree.Build(execution::seq, items.begin(), items.end(), true);
+    } catch (const std::runtime_error &) {
+    }
+    limit = -1;
+    ASSERT_TRUE(tree.CheckTree());
+  }
+}
@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+// Только заголовки основной библиотеки: параллельные конструкторы должны
+// собираться без s21_containersplus
+#include "../s21_containers.h"
+
+TEST(ExecutionPolicyTest, CoreContainersBuildInParallel) {
+  std::vector<int> keys;
+  for (int i = 0; i < 50000; ++i) keys.push_back((i * 7919) % 10007);
+
+  s21::set<int> set(s21::execution::par, keys.begin(), keys.end());
+  EXPECT_EQ(set.size(), 10007U);
+  EXPECT_EQ(*set.begin(), 0);
+
+  s21::thread_pool pool(2);
+  std::vector<std::pair<int, int>> items;
+  for (int key : keys) items.emplace_back(key, -key);
+  s21::map<int, int> map(s21::execution::par.on(pool), items.begin(),
+                         items.end());
+  EXPECT_EQ(map.size(), 10007U);
+  EXPECT_EQ(map.at(42), -42);
+
+  s21::RedBlackTree<int> tree;
+  tree.Build(s21::execution::par, keys.begin(), keys.end(), false);
+  EXPECT_EQ(tree.Size(), keys.size());
+  EXPECT_TRUE(tree.CheckTree());
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <string>
 
 #include "list/s21_list.h"
 
@@ -434,4 +435,18 @@ TEST(List, Insert_Many_Front) {
   EXPECT_EQ(*our_it, 1);
   ++our_it;
   EXPECT_EQ(*our_it, 2);
-}
\ No newline at end of file
+}
+TEST(ListTest, PoolAllocatorPolicy) {
+  using pooled_list =
+      s21::list<std::string, s21::list_policy<s21::pool_allocator>>;
+  pooled_list list1 = {"b", "d"};
+  pooled_list list2 = {"a", "c", "e"};
+  list1.merge(list2);
+  EXPECT_TRUE(list2.empty());
+  list1.push_front("0");
+  list1.pop_back();
+  pooled_list copy(list1);
+  std::string joined;
+  for (const std::string &item : copy) joined += item;
+  EXPECT_EQ(joined, "0abcd");
+}
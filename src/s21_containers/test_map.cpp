@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <list>
 #include <map>
+#include <string>
+#include <vector>
 
 #include "map/s21_map.h"
+#include "thread_pool/s21_thread_pool.h"
 
 TEST(map, ConstructorDefaultMap) {
   s21::map<int, char> my_empty_map;
@@ -229,4 +234,124 @@ TEST(map, MergeMap) {
     EXPECT_TRUE((*my_it).first == (*orig_it).first);
     EXPECT_TRUE((*my_it).second == (*orig_it).second);
   }
-}
\ No newline at end of file
+}
+TEST(map, CompactLayoutMap) {
+  s21::map<int, int, std::less<int>, s21::RedBlackTreeCompactLayout> my_map =
+      {{3, 30}, {1, 10}, {2, 20}};
+  my_map[4] = 40;
+  my_map.insert_or_assign(1, 11);
+  EXPECT_EQ(my_map.size(), 4U);
+  EXPECT_EQ(my_map.at(1), 11);
+  EXPECT_EQ(my_map.at(4), 40);
+  EXPECT_TRUE(my_map.contains(2));
+  EXPECT_FALSE(my_map.contains(5));
+}
+TEST(map, FindManyMap) {
+  s21::map<int, int> my_map;
+  for (int i = 0; i < 500; i += 2) my_map.insert(i, i * 10);
+  std::vector<int> keys = {498, 1, 0, 250, 251, -1, 600, 100, 3, 4, 6};
+  std::vector<s21::map<int, int>::iterator> found(keys.size(), my_map.end());
+  bool present[11];
+  my_map.find_many(keys.begin(), keys.end(), found.begin());
+  my_map.contains_many(keys.begin(), keys.end(), present);
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(present[i], my_map.contains(keys[i]));
+    if (present[i]) {
+      EXPECT_EQ((*found[i]).second, keys[i] * 10);
+    } else {
+      EXPECT_TRUE(found[i] == my_map.end());
+    }
+  }
+}
+TEST(map, InsertBatchMap) {
+  s21::map<int, int> my_map = {{1, 1}, {5, 5}};
+  std::vector<std::pair<int, int>> batch = {
+      {4, 40}, {5, 50}, {2, 20}, {4, 41}, {9, 90}, {0, 0}};
+  EXPECT_EQ(my_map.insert_batch(batch.begin(), batch.end()), 4U);
+  EXPECT_EQ(my_map.size(), 6U);
+  EXPECT_EQ(my_map.at(5), 5);
+  EXPECT_EQ(my_map.at(4), 40);
+
+  std::vector<std::pair<int, int>> update = {
+      {4, 400}, {7, 70}, {4, 401}, {1, 10}};
+  EXPECT_EQ(my_map.insert_or_assign_batch(update.begin(), update.end()), 1U);
+  EXPECT_EQ(my_map.size(), 7U);
+  EXPECT_EQ(my_map.at(4), 401);
+  EXPECT_EQ(my_map.at(1), 10);
+  EXPECT_EQ(my_map.at(7), 70);
+
+  std::map<int, int> orig_map;
+  s21::map<int, int> big_map;
+  std::vector<std::pair<int, int>> random_batch;
+  for (int i = 0; i < 3000; ++i)
+    random_batch.emplace_back((i * 4241) % 2048, i);
+  big_map.insert_or_assign_batch(random_batch.begin(), random_batch.end());
+  for (auto &item : random_batch) orig_map[item.first] = item.second;
+  ASSERT_EQ(big_map.size(), orig_map.size());
+  auto orig_it = orig_map.begin();
+  for (auto it = big_map.begin(); it != big_map.end(); ++it, ++orig_it) {
+    EXPECT_EQ((*it).first, orig_it->first);
+    EXPECT_EQ((*it).second, orig_it->second);
+  }
+}
+TEST(map, ParallelBuildMap) {
+  std::vector<std::pair<int, int>> items;
+  for (int i = 0; i < 30000; ++i) items.emplace_back((i * 17) % 9973, i);
+  s21::map<int, int> my_map(s21::execution::par, items.begin(), items.end());
+  std::map<int, int> orig_map(items.begin(), items.end());
+  ASSERT_EQ(my_map.size(), orig_map.size());
+  // Из одинаковых ключей остается первый, как в std::map
+  for (auto &item : orig_map) EXPECT_EQ(my_map.at(item.first), item.second);
+  std::list<std::pair<int, int>> list_items = {{2, 1}, {1, 1}, {2, 2}};
+  s21::map<int, int> small_map(s21::execution::seq, list_items.begin(),
+                               list_items.end());
+  EXPECT_EQ(small_map.size(), 2U);
+  EXPECT_EQ(small_map.at(2), 1);
+}
+// Компаратор с состоянием: сравнивает ключи по модулю
+struct ModuloLess {
+  int modulo;
+  bool operator()(int lhs, int rhs) const {
+    return lhs % modulo < rhs % modulo;
+  }
+};
+
+TEST(map, CustomCompareMap) {
+  s21::map<int, int, ModuloLess> my_map(ModuloLess{10});
+  my_map.insert(13, 1);
+  my_map.insert(27, 2);
+  EXPECT_FALSE(my_map.insert(23, 3).second);
+  my_map[5] = 4;
+  EXPECT_EQ(my_map.size(), 3U);
+  EXPECT_EQ(my_map.at(33), 1);
+  EXPECT_TRUE(my_map.contains(45));
+  s21::map<int, int, ModuloLess> copy = my_map;
+  EXPECT_EQ(copy.key_comp().modulo, 10);
+  EXPECT_EQ((*copy.begin()).first, 13);
+  std::vector<int> keys = {3, 4, 7};
+  std::vector<bool> found;
+  copy.contains_many(keys.begin(), keys.end(), std::back_inserter(found));
+  EXPECT_EQ(found, (std::vector<bool>{true, false, true}));
+}
+
+TEST(map, PrefixLayoutMap) {
+  s21::map<std::string, int, std::less<std::string>,
+           s21::RedBlackTreePrefixLayout>
+      my_map;
+  std::map<std::string, int> orig_map;
+  for (int i = 0; i < 300; ++i) {
+    std::string key = "https://host/" + std::to_string(i * 7919 % 1000);
+    if (i % 3 == 0) key = key.substr(8);
+    my_map[key] = i;
+    orig_map[key] = i;
+  }
+  EXPECT_EQ(my_map.size(), orig_map.size());
+  auto orig_it = orig_map.begin();
+  for (auto it = my_map.begin(); it != my_map.end(); ++it, ++orig_it) {
+    EXPECT_EQ((*it).first, orig_it->first);
+    EXPECT_EQ((*it).second, orig_it->second);
+  }
+  EXPECT_TRUE(my_map.contains("host/0"));
+  EXPECT_FALSE(my_map.contains("https://host/"));
+  EXPECT_EQ(my_map.at("https://host/919"), 1);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "policy/s21_pool_allocator.h"
+#include "policy/s21_storage_policy.h"
+
+TEST(PoolAllocatorTest, ReusesFreedBlocks) {
+  s21::pool_allocator<std::uint64_t> allocator;
+  std::uint64_t *first = allocator.allocate(1);
+  *first = 42;
+  allocator.deallocate(first, 1);
+  std::uint64_t *second = allocator.allocate(1);
+  EXPECT_EQ(first, second);
+  allocator.deallocate(second, 1);
+
+  // Типы одного размера делят пул
+  s21::pool_allocator<double> rebound(allocator);
+  EXPECT_TRUE(rebound == allocator);
+  double *third = rebound.allocate(1);
+  EXPECT_EQ(static_cast<void *>(third), static_cast<void *>(first));
+  rebound.deallocate(third, 1);
+
+  std::uint64_t *array = allocator.allocate(16);
+  for (int i = 0; i < 16; ++i) array[i] = i;
+  allocator.deallocate(array, 16);
+}
+
+TEST(PoolAllocatorTest, DistinctBlocks) {
+  s21::pool_allocator<std::uint32_t> allocator;
+  std::vector<std::uint32_t *> blocks;
+  for (std::uint32_t i = 0; i < 2000; ++i) {
+    blocks.push_back(allocator.allocate(1));
+    *blocks.back() = i;
+  }
+  std::set<std::uint32_t *> unique(blocks.begin(), blocks.end());
+  EXPECT_EQ(unique.size(), blocks.size());
+  for (std::uint32_t i = 0; i < 2000; ++i) EXPECT_EQ(*blocks[i], i);
+  for (std::uint32_t *block : blocks) allocator.deallocate(block, 1);
+}
+
+TEST(PoolAllocatorTest, FreedByAnotherThread) {
+  s21::pool_allocator<std::uint64_t> allocator;
+  std::vector<std::uint64_t *> blocks;
+  for (int round = 0; round < 4; ++round) {
+    std::thread producer([&] {
+      for (int i = 0; i < 3000; ++i) blocks.push_back(allocator.allocate(1));
+    });
+    producer.join();
+    for (std::uint64_t *block : blocks) allocator.deallocate(block, 1);
+    blocks.clear();
+  }
+  std::uint64_t *block = allocator.allocate(1);
+  *block = 1;
+  allocator.deallocate(block, 1);
+}
+
+TEST(GrowthPolicyTest, NextCapacity) {
+  EXPECT_EQ(s21::growth_double::next(0, 1), 1);
+  EXPECT_EQ(s21::growth_double::next(8, 9), 16);
+  EXPECT_EQ(s21::growth_double::next(8, 100), 100);
+  EXPECT_EQ(s21::growth_one_and_half::next(1, 2), 2);
+  EXPECT_EQ(s21::growth_one_and_half::next(9, 10), 13);
+  EXPECT_EQ((s21::growth_factor<5, 4>::next(100, 101)), 125);
+}
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "set/s21_set.h"
+#include "thread_pool/s21_thread_pool.h"
 
 TEST(set, ConstructorDefaultSet) {
   s21::set<char> my_empty_set;
@@ -167,4 +168,118 @@ TEST(set, ContainsSet) {
   s21::set<double> orig_set = {2.1, 2.2, 2.3, 2.4, 2.5, 2.6};
   EXPECT_EQ(my_set.contains(2), orig_set.contains(2));
   EXPECT_EQ(my_set.contains(2.1), orig_set.contains(2.1));
-}
\ No newline at end of file
+}
+TEST(set, CompactLayoutSet) {
+  s21::set<int, std::less<int>, s21::RedBlackTreeCompactLayout> my_set = {
+      5, 1, 4, 2, 3};
+  std::set<int> orig_set = {5, 1, 4, 2, 3};
+  my_set.erase(my_set.find(4));
+  orig_set.erase(orig_set.find(4));
+  EXPECT_EQ(my_set.size(), orig_set.size());
+  auto orig_it = orig_set.begin();
+  for (auto my_it = my_set.begin(); my_it != my_set.end(); ++my_it, ++orig_it)
+    EXPECT_EQ(*my_it, *orig_it);
+}
+TEST(set, FindManySet) {
+  s21::set<int> my_set;
+  for (int i = 0; i < 1000; i += 3) my_set.insert(i);
+  std::vector<int> keys;
+  for (int i = -5; i < 1010; ++i) keys.push_back((i * 37) % 1010);
+  std::vector<s21::set<int>::iterator> found;
+  std::vector<bool> present;
+  my_set.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+  my_set.contains_many(keys.begin(), keys.end(), std::back_inserter(present));
+  ASSERT_EQ(found.size(), keys.size());
+  ASSERT_EQ(present.size(), keys.size());
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_TRUE(found[i] == my_set.find(keys[i]));
+    EXPECT_EQ(present[i], my_set.contains(keys[i]));
+  }
+  s21::set<int> empty_set;
+  empty_set.contains_many(keys.begin(), keys.begin() + 3, present.begin());
+  EXPECT_FALSE(present[0] || present[1] || present[2]);
+}
+TEST(set, InsertBatchSet) {
+  s21::set<int> my_set = {10, 20, 30};
+  std::set<int> orig_set = {10, 20, 30};
+  std::vector<int> batch;
+  for (int i = 0; i < 2000; ++i) batch.push_back((i * 7919) % 1000);
+  batch.push_back(20);
+  EXPECT_EQ(my_set.insert_batch(batch.begin(), batch.end()), 997U);
+  orig_set.insert(batch.begin(), batch.end());
+  ASSERT_EQ(my_set.size(), orig_set.size());
+  auto orig_it = orig_set.begin();
+  for (auto my_it = my_set.begin(); my_it != my_set.end(); ++my_it, ++orig_it)
+    EXPECT_EQ(*my_it, *orig_it);
+  // Второй пакет целиком из существующих ключей
+  EXPECT_EQ(my_set.insert_batch(batch.begin(), batch.begin() + 100), 0U);
+  EXPECT_EQ(my_set.size(), orig_set.size());
+}
+TEST(set, ParallelBuildSet) {
+  std::vector<int> keys;
+  for (int i = 0; i < 50000; ++i) keys.push_back((i * 31) % 20011);
+  s21::set<int> my_set(s21::execution::par, keys.begin(), keys.end());
+  std::set<int> orig_set(keys.begin(), keys.end());
+  ASSERT_EQ(my_set.size(), orig_set.size());
+  auto orig_it = orig_set.begin();
+  for (auto my_it = my_set.begin(); my_it != my_set.end(); ++my_it, ++orig_it)
+    EXPECT_EQ(*my_it, *orig_it);
+  my_set.insert(-5);
+  EXPECT_TRUE(my_set.contains(-5));
+}
+TEST(set, MergeAllSet) {
+  s21::thread_pool pool(3);
+  std::vector<s21::set<int>> shards(12);
+  std::set<int> orig_set = {1000000};
+  s21::set<int> my_set = {1000000};
+  for (int i = 0; i < 30000; ++i) {
+    int key = (i * 7) % 25000;
+    shards[i % shards.size()].insert(key);
+    orig_set.insert(key);
+  }
+  std::size_t total = 0;
+  for (auto &shard : shards) total += shard.size();
+
+  my_set.merge_all(s21::execution::par.on(pool), shards.begin(), shards.end());
+  ASSERT_EQ(my_set.size(), orig_set.size());
+  auto orig_it = orig_set.begin();
+  for (auto my_it = my_set.begin(); my_it != my_set.end(); ++my_it, ++orig_it)
+    EXPECT_EQ(*my_it, *orig_it);
+  // Дубликаты остаются в источниках, ничего не теряется
+  std::size_t left = 0;
+  for (auto &shard : shards) {
+    left += shard.size();
+    for (int key : shard) EXPECT_TRUE(my_set.contains(key));
+    shard.insert(-1);
+    EXPECT_TRUE(shard.contains(-1));
+  }
+  EXPECT_EQ(left + my_set.size(), total + 1);
+}
+TEST(set, StoragePolicySet) {
+  using pooled = s21::tree_policy<s21::RedBlackTreeCompactLayout,
+                                  s21::pool_allocator>;
+  s21::set<int, std::less<int>, pooled> my_set = {5, 1, 4};
+  s21::set<int, std::less<int>, pooled> other = {2, 3, 4};
+  my_set.merge(other);
+  EXPECT_EQ(my_set.size(), 5);
+  EXPECT_EQ(other.size(), 1);
+  for (int i = 0; i < 1000; ++i) my_set.insert(i);
+  for (int i = 0; i < 1000; i += 2) my_set.erase(my_set.find(i));
+  EXPECT_EQ(my_set.size(), 500);
+  EXPECT_TRUE(my_set.contains(999));
+  EXPECT_FALSE(my_set.contains(4));
+}
+TEST(set, CustomCompareSet) {
+  s21::set<int, std::greater<int>> my_set = {3, 1, 4, 1, 5, 9, 2, 6};
+  std::set<int, std::greater<int>> orig_set = {3, 1, 4, 1, 5, 9, 2, 6};
+  s21::set<int, std::greater<int>> other = {7, 4, 8};
+  my_set.merge(other);
+  orig_set.insert({7, 8});
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(my_set.size(), orig_set.size());
+  auto orig_it = orig_set.begin();
+  for (auto my_it = my_set.begin(); my_it != my_set.end(); ++my_it, ++orig_it)
+    EXPECT_EQ(*my_it, *orig_it);
+  EXPECT_TRUE(my_set.contains(7));
+  EXPECT_TRUE(my_set.key_comp()(2, 1));
+}
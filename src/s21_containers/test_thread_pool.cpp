@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "thread_pool/s21_thread_pool.h"
+
+TEST(ThreadPoolTest, Size) {
+  s21::thread_pool pool(3);
+  EXPECT_EQ(pool.size(), 3U);
+  s21::thread_pool zero(0);
+  EXPECT_EQ(zero.size(), 1U);
+}
+
+TEST(ThreadPoolTest, Submit) {
+  s21::thread_pool pool(2);
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 100; ++i)
+    results.push_back(pool.submit([i] { return i * i; }));
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(results[i].get(), i * i);
+}
+
+TEST(ThreadPoolTest, SubmitException) {
+  s21::thread_pool pool(1);
+  auto result = pool.submit([]() -> int { throw std::runtime_error("fail"); });
+  EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, ParallelFor) {
+  s21::thread_pool pool(4);
+  std::vector<int> data(1000, 0);
+  pool.parallel_for(data.size(), [&data](std::size_t i) { data[i] = 1; });
+  for (int value : data) EXPECT_EQ(value, 1);
+}
+
+TEST(ThreadPoolTest, NestedParallelFor) {
+  s21::thread_pool pool(2);
+  std::atomic<int> counter{0};
+  // Вложенные ожидания не должны блокировать пул
+  pool.parallel_for(8, [&](std::size_t) {
+    pool.parallel_for(8, [&](std::size_t) { ++counter; });
+  });
+  EXPECT_EQ(counter.load(), 64);
+}
+
+TEST(ThreadPoolTest, ParallelForException) {
+  s21::thread_pool pool(2);
+  std::atomic<int> counter{0};
+  EXPECT_THROW(pool.parallel_for(10,
+                                 [&](std::size_t i) {
+                                   ++counter;
+                                   if (i == 5) throw std::logic_error("five");
+                                 }),
+               std::logic_error);
+  // Исключение пробрасывается только после завершения всех вызовов
+  EXPECT_EQ(counter.load(), 10);
+}
+
+TEST(ThreadPoolTest, DestructorRunsPendingTasks) {
+  std::atomic<int> counter{0};
+  {
+    s21::thread_pool pool(2);
+    for (int i = 0; i < 50; ++i) pool.submit([&counter] { ++counter; });
+  }
+  EXPECT_EQ(counter.load(), 50);
+}
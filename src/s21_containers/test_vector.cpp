@@ -1,5 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "./vector/s21_vector.h"  // Предполагается, что ваш класс вектора называется "your_vector_class"
 
 using namespace s21;
@@ -524,6 +529,179 @@ TEST(VectorTest, InsertManyBack) {
   EXPECT_EQ(vec[4], 5);
   EXPECT_EQ(vec[5], 6);
 }
+// Считает живые экземпляры, чтобы проверить, что вектор уничтожает все
+// созданные им элементы
+struct VectorCounted {
+  static inline int alive = 0;
+  VectorCounted(int v = 0) : value(v) { ++alive; }
+  VectorCounted(const VectorCounted &other) : value(other.value) { ++alive; }
+  VectorCounted &operator=(const VectorCounted &) = default;
+  ~VectorCounted() { --alive; }
+  int value;
+};
+
+TEST(VectorTest, DestroysElements) {
+  {
+    s21::vector<VectorCounted> vec(3);
+    EXPECT_EQ(VectorCounted::alive, 3);
+    vec.reserve(10);
+    EXPECT_EQ(VectorCounted::alive, 3);
+    vec.push_back(VectorCounted(4));
+    vec.insert(vec.begin(), VectorCounted(5));
+    EXPECT_EQ(VectorCounted::alive, 5);
+    vec.erase(vec.begin() + 1);
+    vec.pop_back();
+    EXPECT_EQ(VectorCounted::alive, 3);
+    s21::vector<VectorCounted> copy(vec);
+    EXPECT_EQ(VectorCounted::alive, 6);
+    copy.clear();
+    EXPECT_EQ(VectorCounted::alive, 3);
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.capacity(), 3);
+    EXPECT_EQ(vec[0].value, 5);
+  }
+  EXPECT_EQ(VectorCounted::alive, 0);
+}
+
+TEST(VectorTest, PushBackOwnElement) {
+  s21::vector<std::string> vec = {"first"};
+  for (int i = 0; i < 10; ++i) vec.push_back(vec[0]);
+  vec.insert(vec.begin() + 1, vec.back());
+  EXPECT_EQ(vec.size(), 12);
+  for (const std::string &item : vec) EXPECT_EQ(item, "first");
+}
+
+TEST(VectorTest, GrowthPolicy) {
+  s21::vector<int, s21::vector_policy<s21::growth_one_and_half>> vec;
+  std::vector<std::size_t> capacities;
+  for (int i = 0; i < 20; ++i) {
+    vec.push_back(i);
+    if (capacities.empty() || capacities.back() != vec.capacity())
+      capacities.push_back(vec.capacity());
+  }
+  EXPECT_EQ(capacities, (std::vector<std::size_t>{1, 2, 3, 4, 6, 9, 13, 19,
+                                                  28}));
+  for (int i = 0; i < 20; ++i) EXPECT_EQ(vec[i], i);
+}
+
+TEST(VectorTest, PoolAllocatorPolicy) {
+  using pooled = s21::vector_policy<s21::growth_double, s21::pool_allocator>;
+  s21::vector<std::string, pooled> vec = {"a", "b"};
+  vec.push_back("c");
+  s21::vector<std::string, pooled> copy = vec;
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_EQ(copy.capacity(), vec.capacity());
+  EXPECT_EQ(copy[2], "c");
+}
+
+TEST(VectorTest, EraseRange) {
+  s21::vector<int> v = {1, 2, 3, 4, 5, 6};
+  auto it = v.erase(v.begin() + 1, v.begin() + 4);
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(v[0], 1);
+  EXPECT_EQ(v[2], 6);
+  it = v.erase(v.begin() + 1, v.begin() + 1);
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(v.size(), 3);
+  it = v.erase(v.begin(), v.end());
+  EXPECT_TRUE(v.empty());
+  EXPECT_TRUE(it == v.end());
+  EXPECT_THROW(v.erase(v.begin(), v.begin() + 1), std::out_of_range);
+}
+
+TEST(VectorTest, EraseIf) {
+  s21::vector<int> v;
+  for (int i = 0; i < 100; ++i) v.push_back(i);
+  EXPECT_EQ(s21::erase_if(v, [](int x) { return x % 3 != 0; }), 66);
+  ASSERT_EQ(v.size(), 34);
+  for (int i = 0; i < 34; ++i) EXPECT_EQ(v[i], 3 * i);
+  EXPECT_EQ(s21::erase_if(v, [](int) { return false; }), 0);
+
+  {
+    s21::vector<VectorCounted> counted(10);
+    for (int i = 0; i < 10; ++i) counted[i].value = i;
+    EXPECT_EQ(s21::erase_if(counted,
+                            [](const VectorCounted &x) { return x.value < 7; }),
+              7);
+    EXPECT_EQ(VectorCounted::alive, 3);
+    EXPECT_EQ(counted[0].value, 7);
+    counted.erase(counted.begin(), counted.begin() + 2);
+    EXPECT_EQ(VectorCounted::alive, 1);
+  }
+  EXPECT_EQ(VectorCounted::alive, 0);
+}
+
+TEST(VectorTest, Resize) {
+  s21::vector<std::string> v = {"a", "b", "c"};
+  v.resize(5);
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(v[2], "c");
+  EXPECT_EQ(v[4], "");
+  v.resize(2);
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v[1], "b");
+  v.shrink_to_fit();
+  v.resize(40, v[0]);
+  EXPECT_EQ(v.size(), 40);
+  EXPECT_EQ(v[39], "a");
+  std::size_t capacity = v.capacity();
+  v.resize(30);
+  v.resize(35, "z");
+  EXPECT_EQ(v[29], "a");
+  EXPECT_EQ(v[34], "z");
+  EXPECT_EQ(v.capacity(), capacity);
+  v.resize(0);
+  EXPECT_TRUE(v.empty());
+
+  {
+    s21::vector<VectorCounted> counted(4);
+    counted.resize(1);
+    EXPECT_EQ(VectorCounted::alive, 1);
+    counted.resize(6, VectorCounted(3));
+    EXPECT_EQ(VectorCounted::alive, 6);
+    EXPECT_EQ(counted[5].value, 3);
+  }
+  EXPECT_EQ(VectorCounted::alive, 0);
+}
+
+TEST(VectorTest, Assign) {
+  s21::vector<std::string> v = {"a", "b", "c", "d"};
+  std::vector<std::string> source = {"x", "y"};
+  v.assign(source.begin(), source.end());
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v[1], "y");
+  EXPECT_EQ(v.capacity(), 4);
+  source = {"1", "2", "3"};
+  v.assign(source.begin(), source.end());
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[2], "3");
+  EXPECT_EQ(v.capacity(), 4);
+  source.assign(10, "q");
+  v.assign(source.begin(), source.end());
+  EXPECT_EQ(v.size(), 10);
+  EXPECT_EQ(v[9], "q");
+  v.assign(v.begin() + 8, v.end());
+  EXPECT_EQ(v.size(), 2);
+
+  std::istringstream input("4 5 6");
+  s21::vector<int> numbers = {1};
+  numbers.assign(std::istream_iterator<int>(input),
+                 std::istream_iterator<int>());
+  EXPECT_EQ(numbers.size(), 3);
+  EXPECT_EQ(numbers[2], 6);
+}
+
+TEST(VectorTest, EmplaceBack) {
+  s21::vector<std::string> v;
+  EXPECT_EQ(v.emplace_back(3, 'a'), "aaa");
+  v.emplace_back("b");
+  // Аргумент - элемент этого же вектора, который переедет при росте
+  v.emplace_back(v[0]);
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[2], "aaa");
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ws_deque/s21_ws_deque.h"
+
+TEST(WsDequeTest, OwnerLifoThiefFifo) {
+  s21::ws_deque<int> deque;
+  EXPECT_TRUE(deque.empty());
+  EXPECT_FALSE(deque.pop().has_value());
+  EXPECT_FALSE(deque.steal().has_value());
+  for (int i = 1; i <= 4; ++i) deque.push(i);
+  EXPECT_EQ(deque.size(), 4U);
+  EXPECT_EQ(deque.pop().value(), 4);
+  EXPECT_EQ(deque.steal().value(), 1);
+  EXPECT_EQ(deque.steal().value(), 2);
+  EXPECT_EQ(deque.pop().value(), 3);
+  EXPECT_FALSE(deque.pop().has_value());
+  EXPECT_FALSE(deque.steal().has_value());
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST(WsDequeTest, Growth) {
+  s21::ws_deque<int> deque(2);
+  EXPECT_EQ(deque.capacity(), 2U);
+  // Сдвигаем начало, чтобы элементы при росте переносились через границу
+  deque.push(0);
+  EXPECT_EQ(deque.steal().value(), 0);
+  for (int i = 1; i <= 1000; ++i) deque.push(i);
+  EXPECT_GE(deque.capacity(), 1000U);
+  EXPECT_EQ(deque.size(), 1000U);
+  for (int i = 1; i <= 500; ++i) EXPECT_EQ(deque.steal().value(), i);
+  for (int i = 1000; i > 500; --i) EXPECT_EQ(deque.pop().value(), i);
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST(WsDequeTest, ConcurrentStealTakesEachOnce) {
+  s21::ws_deque<int> deque(4);
+  const int kItems = 100000, kThieves = 3;
+  std::vector<std::atomic<int>> taken(kItems);
+  std::atomic<bool> done{false};
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&] {
+      while (!done.load() || !deque.empty()) {
+        if (auto item = deque.steal()) ++taken[*item];
+      }
+    });
+  }
+  for (int i = 0; i < kItems; ++i) {
+    deque.push(i);
+    // Владелец тоже забирает часть элементов, в том числе последний
+    if (i % 3 == 0) {
+      if (auto item = deque.pop()) ++taken[*item];
+    }
+  }
+  while (auto item = deque.pop()) ++taken[*item];
+  done = true;
+  for (auto &thief : thieves) thief.join();
+  for (int i = 0; i < kItems; ++i) ASSERT_EQ(taken[i].load(), 1) << i;
+}
@@ -0,0 +1,294 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERS_THREAD_POOL_S21_THREAD_POOL_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERS_THREAD_POOL_S21_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../ws_deque/s21_ws_deque.h"
+
+namespace s21 {
+
+/**
+ * @brief Пул потоков с перехватом работы (work stealing).
+ *
+ * @details У каждого рабочего потока свой дек задач без блокировок
+ * (s21::ws_deque). Задачи, созданные внутри рабочего потока, кладутся в его
+ * собственный дек, и поток берет их с того же конца (LIFO) - это свежие
+ * задачи, данные которых еще в кэше. Когда свой дек пуст, поток забирает
+ * самую старую задачу из дека другого потока (FIFO) - обычно это крупная,
+ * еще не разделенная часть работы. Задачи извне пула попадают в общую
+ * очередь под мьютексом, из которой их забирает любой свободный поток.
+ *
+ * Поток, ожидающий завершения своих подзадач (parallel_for()), не
+ * блокируется, а сам выполняет задачи из очередей, поэтому вложенный
+ * параллелизм не приводит к взаимной блокировке.
+ */
+class thread_pool {
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * @brief Создает пул из threads рабочих потоков (по умолчанию - по числу
+   * аппаратных потоков, но не меньше одного).
+   */
+  explicit thread_pool(size_type threads = DefaultThreadCount())
+      : pending_(0U), stop_(false) {
+    if (threads == 0) threads = 1;
+    queues_.reserve(threads);
+    for (size_type i = 0; i < threads; ++i)
+      queues_.push_back(std::make_unique<ws_deque<task_type *>>());
+    threads_.reserve(threads);
+    try {
+      for (size_type i = 0; i < threads; ++i)
+        threads_.emplace_back([this, i] { WorkerLoop(i); });
+    } catch (...) {
+      Stop();
+      throw;
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  /**
+   * @brief Дожидается выполнения всех поставленных задач и останавливает
+   * потоки.
+   */
+  ~thread_pool() { Stop(); }
+
+  size_type size() const noexcept { return threads_.size(); }
+
+  /**
+   * @brief Ставит задачу f() в очередь.
+   *
+   * @return std::future с результатом задачи (или ее исключением)
+   */
+  template <typename F>
+  std::future<std::invoke_result_t<std::decay_t<F>>> submit(F &&f) {
+    using result_type = std::invoke_result_t<std::decay_t<F>>;
+    // std::function требует копируемый объект, поэтому packaged_task
+    // храним через shared_ptr
+    auto task = std::make_shared<std::packaged_task<result_type()>>(
+        std::forward<F>(f));
+    std::future<result_type> result = task->get_future();
+    Push([task] { (*task)(); });
+    return result;
+  }
+
+  /**
+   * @brief Ставит задачу f() в очередь без std::future (например, для
+   * возобновления сопрограмм). f не должна выбрасывать исключений.
+   */
+  template <typename F>
+  void post(F &&f) {
+    Push(task_type(std::forward<F>(f)));
+  }
+
+  /**
+   * @brief Выполняет fn(i) для всех i из [0, count) и дожидается завершения.
+   *
+   * @details fn(0) выполняется в вызывающем потоке, остальные - задачами
+   * пула. Пока задачи не завершены, вызывающий поток выполняет задачи из
+   * очередей. Если какие-то вызовы выбросили исключение, после завершения
+   * всех вызовов пробрасывается первое из них. Если не удалось поставить
+   * задачу в очередь, пробрасывается это исключение - тоже только после
+   * завершения уже поставленных задач.
+   */
+  template <typename Fn>
+  void parallel_for(size_type count, Fn &&fn) {
+    if (count == 0) return;
+    if (count == 1) {
+      fn(size_type{0});
+      return;
+    }
+
+    struct State {
+      std::atomic<size_type> remaining;
+      std::mutex error_mutex;
+      std::exception_ptr error;
+
+      void Run(Fn &fn, size_type index) noexcept {
+        try {
+          fn(index);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(error_mutex);
+          if (!error) error = std::current_exception();
+        }
+      }
+    };
+    auto state = std::make_shared<State>();
+    state->remaining = count - 1;
+    auto wait = [this, &state] {
+      while (state->remaining.load(std::memory_order_acquire) != 0) {
+        if (!run_pending_task()) std::this_thread::yield();
+      }
+    };
+
+    size_type submitted = 1;
+    try {
+      for (; submitted < count; ++submitted) {
+        Push([state, &fn, i = submitted] {
+          state->Run(fn, i);
+          state->remaining.fetch_sub(1, std::memory_order_acq_rel);
+        });
+      }
+    } catch (...) {
+      // Поставленные задачи ссылаются на fn: исключение не должно покинуть
+      // функцию, пока они не завершатся
+      state->remaining.fetch_sub(count - submitted, std::memory_order_acq_rel);
+      wait();
+      throw;
+    }
+    state->Run(fn, 0);
+
+    wait();
+    if (state->error) std::rethrow_exception(state->error);
+  }
+
+  /**
+   * @brief Выполняет в текущем потоке одну задачу из очередей пула, если
+   * она есть.
+   *
+   * @return true, если задача была выполнена
+   */
+  bool run_pending_task() {
+    size_type index = CurrentWorkerIndex();
+    task_type *task = index < queues_.size() ? PopLocal(index) : nullptr;
+    if (!task) task = Steal(index);
+    if (!task) task = PopInjected();
+    if (!task) return false;
+    std::unique_ptr<task_type> owner(task);
+    (*task)();
+    return true;
+  }
+
+  /**
+   * @brief Общий пул библиотеки, используемый параллельными алгоритмами по
+   * умолчанию. Создается при первом обращении.
+   */
+  static thread_pool &global() {
+    static thread_pool pool;
+    return pool;
+  }
+
+  static size_type DefaultThreadCount() noexcept {
+    size_type threads = std::thread::hardware_concurrency();
+    return threads == 0 ? 1 : threads;
+  }
+
+ private:
+  using task_type = std::function<void()>;
+
+  void Push(task_type task) {
+    auto node = std::make_unique<task_type>(std::move(task));
+    size_type index = CurrentWorkerIndex();
+    // Счетчик увеличиваем до того, как задачу можно забрать (иначе он мог бы
+    // уйти в минус) и до захвата sleep_mutex_: потоки проверяют его под этим
+    // мьютексом, поэтому пробуждение не теряется
+    pending_.fetch_add(1, std::memory_order_release);
+    try {
+      if (index < queues_.size()) {
+        queues_[index]->push(node.get());
+      } else {
+        std::lock_guard<std::mutex> lock(injected_mutex_);
+        injected_.push_back(node.get());
+      }
+    } catch (...) {
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      throw;
+    }
+    node.release();
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    wake_.notify_one();
+  }
+
+  // Берет самую свежую задачу из своего дека
+  task_type *PopLocal(size_type index) {
+    std::optional<task_type *> task = queues_[index]->pop();
+    if (!task) return nullptr;
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    return *task;
+  }
+
+  // Забирает самую старую задачу из чужого дека. Неудачная попытка из-за
+  // гонки с другим потоком не повторяется: свободный поток все равно
+  // вернется сюда, пока pending_ не равен нулю
+  task_type *Steal(size_type thief) {
+    size_type count = queues_.size();
+    size_type start = thief < count ? thief + 1 : 0;
+    for (size_type i = 0; i < count; ++i) {
+      std::optional<task_type *> task = queues_[(start + i) % count]->steal();
+      if (!task) continue;
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      return *task;
+    }
+    return nullptr;
+  }
+
+  // Берет самую старую задачу, поставленную извне пула
+  task_type *PopInjected() {
+    std::lock_guard<std::mutex> lock(injected_mutex_);
+    if (injected_.empty()) return nullptr;
+    task_type *task = injected_.front();
+    injected_.pop_front();
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    return task;
+  }
+
+  void WorkerLoop(size_type index) {
+    current_pool_ = this;
+    current_index_ = index;
+    while (true) {
+      if (run_pending_task()) continue;
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      wake_.wait(lock, [this] {
+        return stop_ || pending_.load(std::memory_order_acquire) != 0;
+      });
+      if (stop_ && pending_.load(std::memory_order_acquire) == 0) return;
+    }
+  }
+
+  void Stop() noexcept {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread &thread : threads_)
+      if (thread.joinable()) thread.join();
+  }
+
+  // Номер рабочего потока этого пула, выполняющего вызов, или size(), если
+  // вызов идет извне пула
+  size_type CurrentWorkerIndex() const noexcept {
+    return current_pool_ == this ? current_index_ : queues_.size();
+  }
+
+  // Деки рабочих потоков: кладет и берет с нижнего конца только владелец
+  std::vector<std::unique_ptr<ws_deque<task_type *>>> queues_;
+  std::mutex injected_mutex_;
+  std::deque<task_type *> injected_;  // Задачи, поставленные извне пула.
+  std::vector<std::thread> threads_;
+  std::atomic<size_type> pending_;  // Количество задач во всех очередях.
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_;  // Защищен sleep_mutex_.
+
+  static inline thread_local thread_pool *current_pool_ = nullptr;
+  static inline thread_local size_type current_index_ = 0;
+};
+
+}  // namespace s21
+
+#endif
@@ -4,13 +4,20 @@
 #include <algorithm>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "../policy/s21_storage_policy.h"
+
 namespace s21 {
 // Определяем, чтобы работать с разными типами данных
-template <typename T>
+// Storage - политика хранения vector_policy<Growth, Allocator>: стратегия
+// роста емкости и аллокатор буфера (см. s21_storage_policy.h)
+template <typename T, typename Storage = vector_policy<>>
 class vector {
  public:
   // Создаём псевдоним шаблона(синоним)
@@ -24,6 +31,9 @@ class vector {
   using size_type = std::size_t;
   // целое число, разница между двумя указателями
   using difference_type = std::ptrdiff_t;
+  // Аллокатор буфера и стратегия роста из политики хранения
+  using allocator_type = typename Storage::template allocator_type<T>;
+  using growth_type = typename Storage::growth_type;
 
  public:
   // Конструктор без параметров
@@ -38,11 +48,16 @@ class vector {
    *@param size - размер вектора
    */
   explicit vector(size_type size) {
-    size_ = size;
-    capacity_ = size;
-    buffer_ = nullptr;
     if (size > 0) {
-      buffer_ = new value_type[capacity_];
+      buffer_ = Allocate(size);
+      capacity_ = size;
+      try {
+        std::uninitialized_value_construct_n(buffer_, size);
+      } catch (...) {
+        Deallocate(buffer_, capacity_);
+        throw;
+      }
+      size_ = size;
     }
   }
   /**
@@ -52,25 +67,13 @@ class vector {
    *
    */
   vector(std::initializer_list<value_type> const &init)
-      : size_{init.size()},
-        capacity_(init.size()),
-        buffer_{new value_type[capacity_]} {
-    std::copy(init.begin(), init.end(), buffer_);
-  }
+      : vector(init.begin(), init.end(), init.size()) {}
   /**
    * @brief Конструктор копирования - копируем все из rhs
    * @param rhs - Объект их которого копируем
    *
    */
-  vector(const vector &rhs) {
-    size_ = rhs.size_;
-    capacity_ = rhs.capacity_;
-    buffer_ = nullptr;
-    if (size_ > 0) {
-      buffer_ = new value_type[capacity_];
-    }
-    std::copy(rhs.begin(), rhs.end(), buffer_);
-  }
+  vector(const vector &rhs) : vector(rhs.begin(), rhs.end(), rhs.capacity_) {}
 
   /**
    * @brief Конструктор перемещения - перемещаем все из rhs
@@ -85,7 +88,7 @@ class vector {
   /**
    * @brief Деструктор - чистим всю память
    */
-  ~vector() { delete[] buffer_; }
+  ~vector() { Release(); }
   /**
    * @brief Оператор присваивания перемещением
    *
@@ -95,10 +98,7 @@ class vector {
   constexpr vector &operator=(vector &&rhs) noexcept {
     if (this != &rhs) {
       this->swap(rhs);
-      if (rhs.buffer_ != nullptr) delete[] rhs.buffer_;
-      rhs.size_ = 0;
-      rhs.capacity_ = 0;
-      rhs.buffer_ = nullptr;
+      rhs.Release();
     }
     return *this;
   }
@@ -113,14 +113,9 @@ class vector {
   constexpr vector &operator=(const vector &rhs) {
     // Проверка самоприсваивания
     if (this != &rhs) {
-      delete[] buffer_;
-
-      if (rhs.size_ > 0) {
-        buffer_ = new value_type[rhs.capacity_];
-        std::copy(rhs.begin(), rhs.end(), buffer_);
-      }
-      size_ = rhs.size_;
-      capacity_ = rhs.capacity_;
+      // Сначала копия: при исключении текущий вектор не меняется
+      vector copy(rhs);
+      swap(copy);
     }
 
     return *this;
@@ -335,7 +330,10 @@ class vector {
   /**
    * @brief Удаляет все элементы из контейнера. После вызова size равен нулю
    */
-  constexpr void clear() noexcept { size_ = 0; }
+  constexpr void clear() noexcept {
+    std::destroy(begin(), end());
+    size_ = 0;
+  }
 
   /**
    * @brief Вставляет элементы в указанное место в контейнере
@@ -351,13 +349,7 @@ class vector {
           "s21::vector::insert Unable to insert into a position out of "
           "range of begin() to end()");
 
-    if (size_ == capacity_) ReallocVector(size_ ? size_ * 2 : 1);
-
-    std::copy(begin() + index, end(), begin() + index + 1);
-    *(buffer_ + index) = std::move(value);
-
-    ++size_;
-    return begin() + index;
+    return EmplaceAt(index, std::move(value));
   }
 
   /**
@@ -374,13 +366,7 @@ class vector {
           "s21::vector::insert Unable to insert into a position out of "
           "range of begin() to end()");
 
-    if (size_ == capacity_) ReallocVector(size_ ? size_ * 2 : 1);
-
-    std::copy(begin() + index, end(), begin() + index + 1);
-    *(buffer_ + index) = value;
-
-    ++size_;
-    return begin() + index;
+    return EmplaceAt(index, value);
   }
 
   /**
@@ -396,35 +382,62 @@ class vector {
           "s21::vector::erase Unable to erase a position out of range of "
           "begin() to end()");
 
-    std::copy(begin(), const_cast<iterator>(pos), buffer_);
-    std::copy(const_cast<iterator>(pos) + 1, end(), buffer_ + index);
-
-    --size_;
+    std::move(begin() + index + 1, end(), begin() + index);
+    pop_back();
     return begin() + index;
   }
 
   /**
-   * @brief Добавляет элемент в конец контейнера
+   * @brief Удаляет элементы [first, last). Хвост за last сдвигается один
+   * раз, освободившиеся в конце элементы уничтожаются
    *
-   * @param value Значение добавляемого элемента
+   * @param first итератор на первый удаляемый элемент
+   * @param last итератор за последним удаляемым элементом
+   * @return Итератор, следующий за последним удаленным элементом
    */
-  constexpr void push_back(const_reference value) {
-    if (size_ == capacity_) reserve(size_ ? size_ * 2 : 1);
+  constexpr iterator erase(const_iterator first, const_iterator last) {
+    size_type from = first - begin();
+    size_type to = last - begin();
+    if (from > to || to > size_)
+      throw std::out_of_range(
+          "s21::vector::erase Unable to erase a range out of range of "
+          "begin() to end()");
 
-    buffer_[size_] = value;
-    ++size_;
+    if (from != to) {
+      iterator new_end = std::move(begin() + to, end(), begin() + from);
+      std::destroy(new_end, end());
+      size_ = new_end - begin();
+    }
+    return begin() + from;
   }
 
+  /**
+   * @brief Добавляет элемент в конец контейнера
+   *
+   * @param value Значение добавляемого элемента
+   */
+  constexpr void push_back(const_reference value) { EmplaceAt(size_, value); }
+
   /**
    * @brief Добавляет элемент в конец контейнера
    *
    * @param value Значение добавляемого элемента
    */
   constexpr void push_back(value_type &&value) {
-    if (size_ == capacity_) reserve(size_ ? size_ * 2 : 1);
+    EmplaceAt(size_, std::move(value));
+  }
 
-    buffer_[size_] = std::move(value);
-    ++size_;
+  /**
+   * @brief Создает элемент в конце контейнера прямо из аргументов
+   * конструктора, без промежуточной копии
+   *
+   * @param args аргументы для пересылки конструктору элемента (могут
+   * ссылаться на элементы этого же вектора)
+   * @return Ссылка на созданный элемент
+   */
+  template <typename... Args>
+  constexpr reference emplace_back(Args &&...args) {
+    return *EmplaceAt(size_, std::forward<Args>(args)...);
   }
 
   /**
@@ -433,11 +446,82 @@ class vector {
    * недействительными
    */
   constexpr void pop_back() {
-    if (size_ != 0)
+    if (size_ != 0) {
       // throw std::length_error(
       //     "s21::vector::pop_back Calling pop_back on an empty container "
       //     "results in UB");
       --size_;
+      std::destroy_at(buffer_ + size_);
+    }
+  }
+
+  /**
+   * @brief Изменяет размер контейнера на count: лишние элементы в конце
+   * уничтожаются, недостающие создаются value-инициализацией
+   *
+   * @param count новый размер
+   */
+  constexpr void resize(size_type count) {
+    if (count <= size_) {
+      std::destroy(begin() + count, end());
+    } else {
+      if (count > capacity_) ReallocVector(NextCapacity(count));
+      std::uninitialized_value_construct(end(), begin() + count);
+    }
+    size_ = count;
+  }
+
+  /**
+   * @brief Изменяет размер контейнера на count, добавляя копии value
+   *
+   * @param count новый размер
+   * @param value значение новых элементов (может быть элементом вектора)
+   */
+  constexpr void resize(size_type count, const_reference value) {
+    if (count <= size_) {
+      std::destroy(begin() + count, end());
+    } else if (count > capacity_) {
+      // Копия до перевыделения: value может ссылаться на элемент вектора
+      value_type copy(value);
+      ReallocVector(NextCapacity(count));
+      std::uninitialized_fill(end(), begin() + count, copy);
+    } else {
+      std::uninitialized_fill(end(), begin() + count, value);
+    }
+    size_ = count;
+  }
+
+  /**
+   * @brief Заменяет содержимое копиями элементов [first, last). Если они
+   * помещаются в текущую емкость, память не перевыделяется: существующие
+   * элементы переприсваиваются, а лишние уничтожаются
+   *
+   * @param first начало диапазона (не из этого же вектора, если диапазон
+   * длиннее size())
+   * @param last конец диапазона
+   */
+  template <typename InputIt>
+  constexpr void assign(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      size_type count = std::distance(first, last);
+      if (count > capacity_) {
+        vector tmp(first, last, count);
+        swap(tmp);
+      } else if (count <= size_) {
+        iterator new_end = std::copy(first, last, begin());
+        std::destroy(new_end, end());
+        size_ = count;
+      } else {
+        InputIt middle = std::next(first, size_);
+        std::copy(first, middle, begin());
+        std::uninitialized_copy(middle, last, end());
+        size_ = count;
+      }
+    } else {
+      clear();
+      for (; first != last; ++first) push_back(*first);
+    }
   }
 
   /**
@@ -463,9 +547,13 @@ class vector {
   constexpr iterator insert(const_iterator pos, Args &&...args) {
     iterator ret = nullptr;
     auto id = pos - begin();
-    reserve(capacity_ + sizeof...(args));
+    // Копии создаются до reserve(): аргументы могут ссылаться на элементы
+    // этого же вектора
+    std::initializer_list<value_type> items = {
+        value_type(std::forward<Args>(args))...};
+    reserve(size_ + items.size());
 
-    for (auto &&item : {std::forward<Args>(args)...}) {
+    for (auto &&item : items) {
       ret = insert(begin() + id++, item);
     }
     return ret;
@@ -479,26 +567,151 @@ class vector {
    */
   template <typename... Args>
   constexpr iterator push_back(Args &&...args) {
-    for (auto &&item : {std::forward<Args>(args)...}) {
+    for (auto &&item : {value_type(std::forward<Args>(args))...}) {
       push_back(item);
     }
     return end() - 1;
   }
 
  private:
+  using allocator_traits = std::allocator_traits<allocator_type>;
+
+  static_assert(allocator_traits::is_always_equal::value &&
+                    std::is_default_constructible_v<allocator_type>,
+                "s21::vector requires a stateless, always-equal allocator");
+
   size_type size_ = 0;
   size_type capacity_ = 0;
   iterator buffer_ = nullptr;
+
+  // Копирует [first, last) в новый буфер на capacity элементов
+  template <typename InputIt>
+  vector(InputIt first, InputIt last, size_type capacity) {
+    if (capacity == 0) return;
+    buffer_ = Allocate(capacity);
+    capacity_ = capacity;
+    try {
+      size_ = std::uninitialized_copy(first, last, buffer_) - buffer_;
+    } catch (...) {
+      Deallocate(buffer_, capacity_);
+      throw;
+    }
+  }
+
+  // Память буфера выделяется аллокатором политики; элементы в ней создаются
+  // и уничтожаются только в [0, size_)
+  static iterator Allocate(size_type count) {
+    allocator_type allocator;
+    return allocator_traits::allocate(allocator, count);
+  }
+
+  static void Deallocate(iterator buffer, size_type count) noexcept {
+    if (buffer == nullptr) return;
+    allocator_type allocator;
+    allocator_traits::deallocate(allocator, buffer, count);
+  }
+
+  // Уничтожает элементы и освобождает буфер
+  void Release() noexcept {
+    clear();
+    Deallocate(buffer_, capacity_);
+    buffer_ = nullptr;
+    capacity_ = 0;
+  }
+
+  // Емкость после роста, достаточная для required элементов
+  size_type NextCapacity(size_type required) const {
+    if (required > max_size())
+      throw std::length_error(
+          "s21::vector Vector size can't be larger than "
+          "Vector<T>::max_size()");
+    return std::min(growth_type::next(capacity_, required), max_size());
+  }
+
+  // Переносит элементы [first, last) в неинициализированную память out:
+  // перемещением, если оно не бросает исключений, иначе копированием
+  static iterator Relocate(iterator first, iterator last, iterator out) {
+    if constexpr (std::is_nothrow_move_constructible_v<value_type> ||
+                  !std::is_copy_constructible_v<value_type>) {
+      return std::uninitialized_move(first, last, out);
+    } else {
+      return std::uninitialized_copy(first, last, out);
+    }
+  }
+
+  // Создает элемент из args перед позицией index
+  template <typename... Args>
+  iterator EmplaceAt(size_type index, Args &&...args) {
+    if (size_ == capacity_) {
+      // Новый элемент создается раньше переноса: args могут ссылаться на
+      // элементы этого же вектора
+      size_type new_capacity = NextCapacity(size_ + 1);
+      iterator tmp = Allocate(new_capacity);
+      iterator moved = tmp;
+      try {
+        ::new (static_cast<void *>(tmp + index))
+            value_type(std::forward<Args>(args)...);
+        try {
+          moved = Relocate(begin(), begin() + index, tmp);
+          Relocate(begin() + index, end(), tmp + index + 1);
+        } catch (...) {
+          std::destroy(tmp, moved);
+          std::destroy_at(tmp + index);
+          throw;
+        }
+      } catch (...) {
+        Deallocate(tmp, new_capacity);
+        throw;
+      }
+      std::destroy(begin(), end());
+      Deallocate(buffer_, capacity_);
+      buffer_ = tmp;
+      capacity_ = new_capacity;
+    } else if (index == size_) {
+      ::new (static_cast<void *>(end()))
+          value_type(std::forward<Args>(args)...);
+    } else {
+      value_type value(std::forward<Args>(args)...);
+      ::new (static_cast<void *>(end())) value_type(std::move(back()));
+      std::move_backward(begin() + index, end() - 1, end());
+      buffer_[index] = std::move(value);
+    }
+    ++size_;
+    return begin() + index;
+  }
+
   void ReallocVector(size_type new_capacity) {
-    iterator tmp = new value_type[new_capacity];
-    for (size_type i = 0; i < size_; ++i) {
-      tmp[i] = std::move(buffer_[i]);
+    iterator tmp = new_capacity > 0 ? Allocate(new_capacity) : nullptr;
+    try {
+      Relocate(begin(), end(), tmp);
+    } catch (...) {
+      Deallocate(tmp, new_capacity);
+      throw;
     }
-    delete[] buffer_;
+    std::destroy(begin(), end());
+    Deallocate(buffer_, capacity_);
     buffer_ = tmp;
     capacity_ = new_capacity;
   }
 };
+
+/**
+ * @brief Удаляет из вектора элементы, для которых pred возвращает true.
+ * Оставшиеся элементы сдвигаются за один проход, каждый не больше одного
+ * раза, а не хвост после каждого удаленного, как при erase() в цикле
+ *
+ * @param vec вектор
+ * @param pred унарный предикат
+ * @return Число удаленных элементов
+ */
+template <typename T, typename Storage, typename Pred>
+typename vector<T, Storage>::size_type erase_if(vector<T, Storage> &vec,
+                                                Pred pred) {
+  auto new_end = std::remove_if(vec.begin(), vec.end(), pred);
+  typename vector<T, Storage>::size_type erased = vec.end() - new_end;
+  vec.erase(new_end, vec.end());
+  return erased;
+}
 }  // namespace s21
 
 #endif
\ No newline at end of file
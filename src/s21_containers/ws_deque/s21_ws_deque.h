@@ -0,0 +1,190 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERS_WS_DEQUE_S21_WS_DEQUE_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERS_WS_DEQUE_S21_WS_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace s21 {
+
+/**
+ * @brief Дек для перехвата работы (алгоритм Chase-Lev) без блокировок.
+ *
+ * @details С нижним концом работает только поток-владелец: push() и pop()
+ * (LIFO). Остальные потоки забирают элементы с верхнего конца через
+ * steal() (FIFO). Владелец синхронизируется с "ворами" только когда в деке
+ * остался один элемент, поэтому push() и pop() почти всегда обходятся без
+ * атомарных операций чтение-изменение-запись.
+ *
+ * Элементы хранятся в кольцевом буфере, который удваивается при
+ * заполнении. "Вор" может еще читать старый буфер, поэтому старые буферы
+ * освобождаются только в деструкторе (их суммарный размер меньше
+ * текущего буфера).
+ *
+ * Реализация по статье N. M. Lê, A. Pop, A. Cohen, F. Zappa Nardelli
+ * "Correct and Efficient Work-Stealing for Weak Memory Models" (2013).
+ *
+ * @tparam T Тип элементов. Должен быть тривиально копируемым: "вор" читает
+ * ячейку одновременно с тем, как ее могут перезаписать. Для сложных
+ * объектов храните указатели.
+ */
+template <class T>
+class ws_deque {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "s21::ws_deque requires a trivially copyable type");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  /**
+   * @brief Создает пустой дек с буфером на capacity элементов (округляется
+   * вверх до степени двойки).
+   */
+  explicit ws_deque(size_type capacity = 64) : top_(0), bottom_(0) {
+    size_type size = 1;
+    while (size < capacity) size *= 2;
+    buffers_.push_back(std::make_unique<Buffer>(size));
+    buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+  }
+
+  ws_deque(const ws_deque &) = delete;
+  ws_deque &operator=(const ws_deque &) = delete;
+
+  ~ws_deque() = default;
+
+  /**
+   * @brief Кладет элемент в нижний конец. Вызывает только владелец.
+   */
+  void push(value_type value) {
+    index_type b = bottom_.load(std::memory_order_relaxed);
+    index_type t = top_.load(std::memory_order_acquire);
+    Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+    if (b - t >= static_cast<index_type>(buffer->size())) {
+      buffer = Grow(buffer, t, b);
+    }
+    buffer->Put(b, value);
+    // Элемент должен стать виден раньше нового bottom_
+    bottom_.store(b + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Забирает элемент с нижнего конца (последний добавленный).
+   * Вызывает только владелец.
+   *
+   * @return Элемент или std::nullopt, если дек пуст
+   */
+  std::optional<value_type> pop() {
+    index_type b = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer *buffer = buffer_.load(std::memory_order_relaxed);
+    // Уменьшение bottom_ и чтение top_ должны быть упорядочены между собой:
+    // иначе владелец и "вор" могут забрать один и тот же элемент
+    bottom_.store(b, std::memory_order_seq_cst);
+    index_type t = top_.load(std::memory_order_seq_cst);
+    if (t > b) {
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return std::nullopt;
+    }
+    std::optional<value_type> result = buffer->Get(b);
+    if (t == b) {
+      // Последний элемент: соревнуемся с "ворами" за top_
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed))
+        result.reset();
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Забирает элемент с верхнего конца (самый старый). Может
+   * вызываться из любого потока.
+   *
+   * @return Элемент или std::nullopt, если дек пуст или элемент перехватил
+   * другой поток (в этом случае можно повторить попытку)
+   */
+  std::optional<value_type> steal() {
+    index_type t = top_.load(std::memory_order_seq_cst);
+    index_type b = bottom_.load(std::memory_order_seq_cst);
+    if (t >= b) return std::nullopt;
+    Buffer *buffer = buffer_.load(std::memory_order_acquire);
+    value_type value = buffer->Get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed))
+      return std::nullopt;
+    return value;
+  }
+
+  /**
+   * @brief Количество элементов. При одновременной работе других потоков -
+   * приблизительное.
+   */
+  size_type size() const noexcept {
+    index_type b = bottom_.load(std::memory_order_relaxed);
+    index_type t = top_.load(std::memory_order_relaxed);
+    return b > t ? static_cast<size_type>(b - t) : 0;
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  /**
+   * @brief Размер текущего буфера. Вызывает только владелец.
+   */
+  size_type capacity() const noexcept {
+    return buffer_.load(std::memory_order_relaxed)->size();
+  }
+
+ private:
+  using index_type = std::ptrdiff_t;
+
+  // Кольцевой буфер. Ячейки атомарные, чтобы одновременные чтение "вором"
+  // и запись владельцем не были гонкой данных
+  class Buffer {
+   public:
+    explicit Buffer(size_type size)
+        : mask_(size - 1), cells_(new std::atomic<value_type>[size]) {}
+
+    size_type size() const noexcept { return mask_ + 1; }
+
+    value_type Get(index_type index) const noexcept {
+      return cells_[static_cast<size_type>(index) & mask_].load(
+          std::memory_order_relaxed);
+    }
+
+    void Put(index_type index, value_type value) noexcept {
+      cells_[static_cast<size_type>(index) & mask_].store(
+          value, std::memory_order_relaxed);
+    }
+
+   private:
+    size_type mask_;
+    std::unique_ptr<std::atomic<value_type>[]> cells_;
+  };
+
+  // Переносит элементы [top, bottom) в буфер вдвое большего размера
+  Buffer *Grow(Buffer *buffer, index_type top, index_type bottom) {
+    buffers_.reserve(buffers_.size() + 1);
+    auto bigger = std::make_unique<Buffer>(buffer->size() * 2);
+    for (index_type i = top; i < bottom; ++i) bigger->Put(i, buffer->Get(i));
+    buffers_.push_back(std::move(bigger));
+    buffer = buffers_.back().get();
+    buffer_.store(buffer, std::memory_order_release);
+    return buffer;
+  }
+
+  // top_ и bottom_ в разных кэш-линиях: top_ меняют "воры", bottom_ -
+  // владелец
+  alignas(64) std::atomic<index_type> top_;
+  alignas(64) std::atomic<index_type> bottom_;
+  std::atomic<Buffer *> buffer_;
+  // Текущий и все прежние буферы (нужны "ворам", читающим старый буфер).
+  // Изменяется только владельцем
+  std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+}  // namespace s21
+
+#endif
@@ -1,7 +1,23 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H
 #define CPP2_S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_H
 
+#include "s21_containersplus/algorithm/s21_parallel_algorithm.h"
 #include "s21_containersplus/array/s21_array.h"
+#include "s21_containersplus/async_queue/s21_async_queue.h"
+#include "s21_containersplus/bitset/s21_bitset.h"
+#include "s21_containersplus/concurrent_hash_map/s21_concurrent_hash_map.h"
+#include "s21_containersplus/concurrent_stack/s21_concurrent_stack.h"
+#include "s21_containersplus/dense_int_set/s21_dense_int_set.h"
+#include "s21_containersplus/epoch/s21_epoch_domain.h"
 #include "s21_containersplus/multiset/s21_multiset.h"
+#include "s21_containersplus/radix_map/s21_radix_map.h"
+#include "s21_containersplus/rcu/s21_rcu.h"
+#include "s21_containersplus/roaring_set/s21_roaring_set.h"
+#include "s21_containersplus/segmented_vector/s21_segmented_vector.h"
+#include "s21_containersplus/slot_map/s21_slot_map.h"
+#include "s21_containersplus/soa_vector/s21_soa_vector.h"
+#include "s21_containersplus/static_map/s21_static_map.h"
+#include "s21_containersplus/static_set/s21_static_set.h"
+#include "s21_containersplus/static_vector/s21_static_vector.h"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,233 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_ALGORITHM_S21_PARALLEL_ALGORITHM_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_ALGORITHM_S21_PARALLEL_ALGORITHM_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../s21_containers/policy/s21_execution_policy.h"
+#include "../../s21_containers/thread_pool/s21_thread_pool.h"
+
+namespace s21 {
+
+/**
+ * @brief Применяет f к каждому элементу [first, last).
+ *
+ * @details При параллельной политике диапазоны s21::vector, s21::array (и
+ * любые другие с произвольным доступом) делятся на равные части, диапазоны
+ * set/map/multiset - по поддеревьям. Прочие диапазоны (например, s21::list)
+ * обрабатываются последовательно.
+ */
+template <typename Policy, typename It, typename Function>
+detail::enable_if_policy_t<Policy, void> for_each(Policy &&policy, It first,
+                                                  It last, Function f) {
+  if constexpr (detail::is_parallel_v<Policy> && detail::is_splittable_v<It>) {
+    thread_pool &pool = policy.pool();
+    std::vector<It> bounds = detail::SplitRange(pool, first, last);
+    pool.parallel_for(bounds.size() - 1, [&](detail::size_type i) {
+      std::for_each(bounds[i], bounds[i + 1], f);
+    });
+  } else {
+    (void)policy;
+    std::for_each(first, last, f);
+  }
+}
+
+/**
+ * @brief Записывает op(x) для каждого x из [first, last) в d_first.
+ *
+ * @details Параллельно выполняется, если входной диапазон делится на части,
+ * а выходной итератор с произвольным доступом.
+ *
+ * @return Итератор за последним записанным элементом
+ */
+template <typename Policy, typename It, typename OutIt, typename UnaryOp>
+detail::enable_if_policy_t<Policy, OutIt> transform(Policy &&policy, It first,
+                                                    It last, OutIt d_first,
+                                                    UnaryOp op) {
+  if constexpr (detail::is_parallel_v<Policy> && detail::is_splittable_v<It> &&
+                detail::is_random_access_v<OutIt>) {
+    thread_pool &pool = policy.pool();
+    std::vector<It> bounds = detail::SplitRange(pool, first, last);
+    std::vector<detail::size_type> offsets =
+        detail::ChunkOffsets(pool, bounds);
+    pool.parallel_for(bounds.size() - 1, [&](detail::size_type i) {
+      std::transform(bounds[i], bounds[i + 1], d_first + offsets[i], op);
+    });
+    return d_first + offsets.back();
+  } else {
+    (void)policy;
+    return std::transform(first, last, d_first, op);
+  }
+}
+
+/**
+ * @brief Сворачивает [first, last) операцией op с начальным значением init.
+ *
+ * @details Как и std::reduce, при параллельном выполнении порядок
+ * применения op не определен (части сворачиваются независимо, затем
+ * результаты частей - по порядку), поэтому op должна быть ассоциативной.
+ */
+template <typename Policy, typename It, typename T,
+          typename BinaryOp = std::plus<>>
+detail::enable_if_policy_t<Policy, T> reduce(Policy &&policy, It first,
+                                             It last, T init,
+                                             BinaryOp op = BinaryOp{}) {
+  if constexpr (detail::is_parallel_v<Policy> && detail::is_splittable_v<It>) {
+    thread_pool &pool = policy.pool();
+    std::vector<It> bounds = detail::SplitRange(pool, first, last);
+    std::vector<std::optional<T>> partial(bounds.size() - 1);
+    pool.parallel_for(partial.size(), [&](detail::size_type i) {
+      It it = bounds[i];
+      if (it == bounds[i + 1]) return;
+      T acc = *it;
+      for (++it; it != bounds[i + 1]; ++it) acc = op(std::move(acc), *it);
+      partial[i] = std::move(acc);
+    });
+    for (std::optional<T> &value : partial)
+      if (value) init = op(std::move(init), std::move(*value));
+    return init;
+  } else {
+    (void)policy;
+    return std::accumulate(first, last, std::move(init), op);
+  }
+}
+
+/**
+ * @brief Сортирует [first, last) (произвольный доступ) по comp.
+ *
+ * @details Параллельная версия - сортировка слиянием с дополнительным буфером
+ * на n элементов; как и std::sort, она не устойчива относительно порядка
+ * равных элементов внутри частей.
+ */
+template <typename Policy, typename RandomIt,
+          typename Compare = std::less<>>
+detail::enable_if_policy_t<Policy, void> sort(Policy &&policy, RandomIt first,
+                                              RandomIt last,
+                                              Compare comp = Compare{}) {
+  static_assert(detail::is_random_access_v<RandomIt>,
+                "s21::sort requires random access iterators");
+  if constexpr (detail::is_parallel_v<Policy>) {
+    detail::ParallelSort(policy.pool(), first, last, comp, false);
+  } else {
+    (void)policy;
+    std::sort(first, last, comp);
+  }
+}
+
+/**
+ * @brief Устойчивая сортировка [first, last): равные элементы сохраняют
+ * взаимный порядок.
+ */
+template <typename Policy, typename RandomIt,
+          typename Compare = std::less<>>
+detail::enable_if_policy_t<Policy, void> stable_sort(Policy &&policy,
+                                                     RandomIt first,
+                                                     RandomIt last,
+                                                     Compare comp = Compare{}) {
+  static_assert(detail::is_random_access_v<RandomIt>,
+                "s21::stable_sort requires random access iterators");
+  detail::StableSort(policy, first, last, comp);
+}
+
+/**
+ * @brief Включающий префиксный скан: d_first[i] = x[0] op ... op x[i].
+ *
+ * @details Параллельная версия в три прохода: свертка каждой части,
+ * последовательный скан по результатам частей, скан каждой части со своим
+ * начальным значением. op должна быть ассоциативной.
+ *
+ * @return Итератор за последним записанным элементом
+ */
+template <typename Policy, typename It, typename OutIt,
+          typename BinaryOp = std::plus<>>
+detail::enable_if_policy_t<Policy, OutIt> inclusive_scan(
+    Policy &&policy, It first, It last, OutIt d_first,
+    BinaryOp op = BinaryOp{}) {
+  using value_type = typename std::iterator_traits<It>::value_type;
+  if constexpr (detail::is_parallel_v<Policy> && detail::is_splittable_v<It> &&
+                detail::is_random_access_v<OutIt>) {
+    thread_pool &pool = policy.pool();
+    std::vector<It> bounds = detail::SplitRange(pool, first, last);
+    std::vector<detail::size_type> offsets =
+        detail::ChunkOffsets(pool, bounds);
+    detail::size_type chunks = bounds.size() - 1;
+
+    std::vector<std::optional<value_type>> carry(chunks);
+    pool.parallel_for(chunks, [&](detail::size_type i) {
+      It it = bounds[i];
+      if (it == bounds[i + 1]) return;
+      value_type acc = *it;
+      for (++it; it != bounds[i + 1]; ++it) acc = op(std::move(acc), *it);
+      carry[i] = std::move(acc);
+    });
+    // carry[i] - свертка всех частей до i-й включительно
+    for (detail::size_type i = 1; i < chunks; ++i) {
+      if (!carry[i]) {
+        carry[i] = carry[i - 1];
+      } else if (carry[i - 1]) {
+        carry[i] = op(*carry[i - 1], std::move(*carry[i]));
+      }
+    }
+
+    pool.parallel_for(chunks, [&](detail::size_type i) {
+      OutIt out = d_first + offsets[i];
+      if (i == 0 || !carry[i - 1]) {
+        std::partial_sum(bounds[i], bounds[i + 1], out, op);
+        return;
+      }
+      value_type acc = *carry[i - 1];
+      for (It it = bounds[i]; it != bounds[i + 1]; ++it, ++out) {
+        acc = op(std::move(acc), *it);
+        *out = acc;
+      }
+    });
+    return d_first + offsets.back();
+  } else {
+    (void)policy;
+    return std::partial_sum(first, last, d_first, op);
+  }
+}
+
+/**
+ * @brief Копирует в d_first элементы [first, last), для которых pred
+ * истинен, сохраняя их порядок.
+ *
+ * @details Параллельная версия в два прохода: подсчет подходящих элементов в
+ * каждой части, затем копирование каждой части со своего смещения.
+ *
+ * @return Итератор за последним записанным элементом
+ */
+template <typename Policy, typename It, typename OutIt, typename Predicate>
+detail::enable_if_policy_t<Policy, OutIt> copy_if(Policy &&policy, It first,
+                                                  It last, OutIt d_first,
+                                                  Predicate pred) {
+  if constexpr (detail::is_parallel_v<Policy> && detail::is_splittable_v<It> &&
+                detail::is_random_access_v<OutIt>) {
+    thread_pool &pool = policy.pool();
+    std::vector<It> bounds = detail::SplitRange(pool, first, last);
+    detail::size_type chunks = bounds.size() - 1;
+    std::vector<detail::size_type> offsets(chunks + 1, 0U);
+    pool.parallel_for(chunks, [&](detail::size_type i) {
+      offsets[i + 1] = static_cast<detail::size_type>(
+          std::count_if(bounds[i], bounds[i + 1], pred));
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    pool.parallel_for(chunks, [&](detail::size_type i) {
+      std::copy_if(bounds[i], bounds[i + 1], d_first + offsets[i], pred);
+    });
+    return d_first + offsets.back();
+  } else {
+    (void)policy;
+    return std::copy_if(first, last, d_first, pred);
+  }
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,432 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_ASYNC_QUEUE_S21_ASYNC_QUEUE_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_ASYNC_QUEUE_S21_ASYNC_QUEUE_H
+
+// Сопрограммы есть только в C++20; в режиме C++17 заголовок пуст
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "../../s21_containers/queue/s21_queue.h"
+#include "../../s21_containers/thread_pool/s21_thread_pool.h"
+#include "../../s21_containers/vector/s21_vector.h"
+
+namespace s21 {
+
+/**
+ * @brief Сопрограмма "запустил и забыл" для конвейеров на async_queue.
+ *
+ * @details Создается приостановленной; запускается исполнителем через
+ * spawn(). После завершения освобождается сама. Исключение, вышедшее из
+ * сопрограммы, завершает программу (std::terminate), поэтому обрабатывайте
+ * ошибки внутри.
+ */
+class async_task {
+ public:
+  struct promise_type {
+    async_task get_return_object() noexcept {
+      return async_task(
+          std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    std::suspend_never final_suspend() noexcept { return {}; }
+
+    void return_void() noexcept {}
+
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+
+  async_task(async_task &&other) noexcept
+      : handle_(std::exchange(other.handle_, {})) {}
+
+  async_task(const async_task &) = delete;
+  async_task &operator=(const async_task &) = delete;
+  async_task &operator=(async_task &&) = delete;
+
+  // Незапущенная сопрограмма уничтожается вместе с объектом
+  ~async_task() {
+    if (handle_) handle_.destroy();
+  }
+
+  /**
+   * @brief Передает владение сопрограммой вызывающему (для запуска).
+   */
+  std::coroutine_handle<> release() noexcept {
+    return std::exchange(handle_, {});
+  }
+
+ private:
+  explicit async_task(std::coroutine_handle<> handle) : handle_(handle) {}
+
+  std::coroutine_handle<> handle_;
+};
+
+/**
+ * @brief Простейший однопоточный исполнитель: очередь готовых к
+ * возобновлению сопрограмм, которую run() разбирает в текущем потоке.
+ */
+class run_loop {
+ public:
+  void schedule(std::coroutine_handle<> handle) { ready_.push(handle); }
+
+  void spawn(async_task task) { schedule(task.release()); }
+
+  /**
+   * @brief Возобновляет сопрограммы, пока очередь не опустеет.
+   */
+  void run() {
+    while (!ready_.empty()) {
+      std::coroutine_handle<> handle = ready_.front();
+      ready_.pop();
+      handle.resume();
+    }
+  }
+
+ private:
+  s21::queue<std::coroutine_handle<>> ready_;
+};
+
+/**
+ * @brief Исполнитель, возобновляющий сопрограммы в потоках s21::thread_pool.
+ */
+class pool_executor {
+ public:
+  explicit pool_executor(thread_pool &pool = thread_pool::global())
+      : pool_(&pool) {}
+
+  void schedule(std::coroutine_handle<> handle) {
+    pool_->post([handle] { handle.resume(); });
+  }
+
+  void spawn(async_task task) { schedule(task.release()); }
+
+ private:
+  thread_pool *pool_;
+};
+
+/**
+ * @brief Мьютекс-заглушка для однопоточной очереди.
+ */
+struct null_mutex {
+  void lock() noexcept {}
+  void unlock() noexcept {}
+  bool try_lock() noexcept { return true; }
+};
+
+/**
+ * @brief Ограниченная очередь для конвейеров из сопрограмм.
+ *
+ * @details co_await pop() приостанавливает сопрограмму, пока очередь пуста,
+ * co_await push() - пока она заполнена; вместо опроса empty() в цикле
+ * ожидающая сопрограмма возобновляется через исполнитель, как только
+ * появится элемент или место. Элементы хранятся в кольцевом буфере
+ * фиксированной емкости. Если сопрограмма уже ждет элемент, push()
+ * передает его напрямую, минуя буфер.
+ *
+ * После close() новые элементы не принимаются, ожидающие push() получают
+ * false, а pop() возвращает оставшиеся элементы и затем std::nullopt.
+ *
+ * Ожидающая сопрограмма снимается с очереди ожидания только после того, как
+ * элемент успешно перемещен. Если перемещение бросает исключение, его
+ * получает тот, кто передавал элемент: вызывающий push()/try_push() или,
+ * когда элемент ждущего push() переходит в освободившийся буфер, сам этот
+ * push() при возобновлении.
+ *
+ * @tparam T Тип элементов
+ * @tparam Mutex null_mutex для однопоточной очереди (async_queue) или
+ * std::mutex для очереди, с которой работают сопрограммы в разных потоках
+ * (concurrent_async_queue)
+ */
+template <class T, class Mutex>
+class basic_async_queue {
+ private:
+  class PopAwaiter;
+  class PushAwaiter;
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  /**
+   * @brief Создает очередь емкостью capacity, сопрограммы которой
+   * возобновляет executor (любой тип с методом
+   * schedule(std::coroutine_handle<>)).
+   *
+   * @throw std::invalid_argument если capacity равна нулю
+   */
+  template <class Executor>
+  basic_async_queue(size_type capacity, Executor &executor)
+      : cells_(Checked(capacity)),
+        head_(0),
+        size_(0),
+        closed_(false),
+        executor_(&executor),
+        schedule_([](void *target, std::coroutine_handle<> handle) {
+          static_cast<Executor *>(target)->schedule(handle);
+        }) {}
+
+  basic_async_queue(const basic_async_queue &) = delete;
+  basic_async_queue &operator=(const basic_async_queue &) = delete;
+
+  /**
+   * @brief co_await pop() возвращает std::optional<T>: элемент или
+   * std::nullopt, если очередь закрыта и пуста.
+   */
+  [[nodiscard]] PopAwaiter pop() { return PopAwaiter(this); }
+
+  /**
+   * @brief co_await push(value) возвращает true, если элемент добавлен, и
+   * false, если очередь закрыта.
+   */
+  [[nodiscard]] PushAwaiter push(value_type value) {
+    return PushAwaiter(this, std::move(value));
+  }
+
+  /**
+   * @brief Добавляет элемент без ожидания.
+   *
+   * @return false, если очередь заполнена или закрыта
+   */
+  bool try_push(value_type value) {
+    std::unique_lock<Mutex> lock(mutex_);
+    if (closed_) return false;
+    if (PopAwaiter *popper = poppers_.Front()) {
+      popper->value_.emplace(std::move(value));
+      poppers_.PopFront();
+      lock.unlock();
+      Schedule(popper->handle_);
+      return true;
+    }
+    if (size_ == cells_.size()) return false;
+    PushBack(std::move(value));
+    return true;
+  }
+
+  /**
+   * @brief Забирает элемент без ожидания (std::nullopt, если очередь пуста).
+   */
+  std::optional<value_type> try_pop() {
+    std::unique_lock<Mutex> lock(mutex_);
+    std::optional<value_type> result;
+    std::coroutine_handle<> pusher = TakeFront(result);
+    lock.unlock();
+    if (pusher) Schedule(pusher);
+    return result;
+  }
+
+  /**
+   * @brief Закрывает очередь и возобновляет все ожидающие сопрограммы.
+   */
+  void close() {
+    std::unique_lock<Mutex> lock(mutex_);
+    closed_ = true;
+    WaitList<PopAwaiter> poppers = std::exchange(poppers_, {});
+    WaitList<PushAwaiter> pushers = std::exchange(pushers_, {});
+    lock.unlock();
+    while (PopAwaiter *popper = poppers.PopFront()) Schedule(popper->handle_);
+    while (PushAwaiter *pusher = pushers.PopFront()) {
+      pusher->result_ = false;
+      Schedule(pusher->handle_);
+    }
+  }
+
+  bool closed() const {
+    std::lock_guard<Mutex> lock(mutex_);
+    return closed_;
+  }
+
+  size_type size() const {
+    std::lock_guard<Mutex> lock(mutex_);
+    return size_;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  size_type capacity() const noexcept { return cells_.size(); }
+
+ private:
+  // Очередь ожидающих сопрограмм (FIFO) из самих объектов ожидания
+  template <class Awaiter>
+  struct WaitList {
+    void PushBack(Awaiter *awaiter) noexcept {
+      awaiter->next_ = nullptr;
+      if (tail_) {
+        tail_->next_ = awaiter;
+      } else {
+        head_ = awaiter;
+      }
+      tail_ = awaiter;
+    }
+
+    Awaiter *Front() const noexcept { return head_; }
+
+    Awaiter *PopFront() noexcept {
+      Awaiter *awaiter = head_;
+      if (awaiter) {
+        head_ = awaiter->next_;
+        if (!head_) tail_ = nullptr;
+      }
+      return awaiter;
+    }
+
+    Awaiter *head_ = nullptr;
+    Awaiter *tail_ = nullptr;
+  };
+
+  class PopAwaiter {
+   public:
+    explicit PopAwaiter(basic_async_queue *queue) : queue_(queue) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    // false - элемент получен (или очередь закрыта) без приостановки
+    bool await_suspend(std::coroutine_handle<> handle) {
+      std::unique_lock<Mutex> lock(queue_->mutex_);
+      if (queue_->size_ != 0) {
+        std::coroutine_handle<> pusher = queue_->TakeFront(value_);
+        lock.unlock();
+        if (pusher) queue_->Schedule(pusher);
+        return false;
+      }
+      if (queue_->closed_) return false;
+      handle_ = handle;
+      queue_->poppers_.PushBack(this);
+      // После разблокировки объект может уже возобновить другой поток
+      return true;
+    }
+
+    std::optional<value_type> await_resume() { return std::move(value_); }
+
+   private:
+    friend class basic_async_queue;
+    template <class>
+    friend struct WaitList;
+
+    basic_async_queue *queue_;
+    std::optional<value_type> value_;
+    std::coroutine_handle<> handle_;
+    PopAwaiter *next_ = nullptr;
+  };
+
+  class PushAwaiter {
+   public:
+    PushAwaiter(basic_async_queue *queue, value_type value)
+        : queue_(queue), value_(std::move(value)) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    // false - элемент передан (или очередь закрыта) без приостановки
+    bool await_suspend(std::coroutine_handle<> handle) {
+      std::unique_lock<Mutex> lock(queue_->mutex_);
+      if (queue_->closed_) {
+        result_ = false;
+        return false;
+      }
+      if (PopAwaiter *popper = queue_->poppers_.Front()) {
+        popper->value_.emplace(std::move(value_));
+        queue_->poppers_.PopFront();
+        lock.unlock();
+        queue_->Schedule(popper->handle_);
+        return false;
+      }
+      if (queue_->size_ != queue_->cells_.size()) {
+        queue_->PushBack(std::move(value_));
+        return false;
+      }
+      handle_ = handle;
+      queue_->pushers_.PushBack(this);
+      return true;
+    }
+
+    // Пробрасывает исключение, брошенное при переносе элемента в буфер
+    bool await_resume() const {
+      if (error_) std::rethrow_exception(error_);
+      return result_;
+    }
+
+   private:
+    friend class basic_async_queue;
+    template <class>
+    friend struct WaitList;
+
+    basic_async_queue *queue_;
+    value_type value_;
+    bool result_ = true;
+    std::exception_ptr error_;
+    std::coroutine_handle<> handle_;
+    PushAwaiter *next_ = nullptr;
+  };
+
+  static size_type Checked(size_type capacity) {
+    if (capacity == 0)
+      throw std::invalid_argument(
+          "s21::async_queue: capacity must be positive");
+    return capacity;
+  }
+
+  // Вызывается под mutex_, в буфере есть место
+  void PushBack(value_type value) {
+    cells_.data()[(head_ + size_) % cells_.size()] = std::move(value);
+    ++size_;
+  }
+
+  // Вызывается под mutex_: забирает первый элемент в out. Если место
+  // освободилось для ожидающего push(), его элемент переходит в буфер, а
+  // сопрограмму нужно возобновить - ее и возвращаем. Исключение при этом
+  // переносе достается push(), а не вызывающему: свой элемент он уже получил
+  std::coroutine_handle<> TakeFront(std::optional<value_type> &out) {
+    if (size_ == 0) return {};
+    std::optional<value_type> &cell = cells_.data()[head_];
+    out = std::move(cell);
+    cell.reset();
+    head_ = (head_ + 1) % cells_.size();
+    --size_;
+    PushAwaiter *pusher = pushers_.PopFront();
+    if (!pusher) return {};
+    try {
+      PushBack(std::move(pusher->value_));
+    } catch (...) {
+      pusher->error_ = std::current_exception();
+    }
+    return pusher->handle_;
+  }
+
+  // Вызывается без mutex_
+  void Schedule(std::coroutine_handle<> handle) {
+    schedule_(executor_, handle);
+  }
+
+  s21::vector<std::optional<value_type>> cells_;  // Кольцевой буфер.
+  size_type head_;  // Индекс первого элемента.
+  size_type size_;
+  bool closed_;
+  WaitList<PopAwaiter> poppers_;   // Ждут элемент; буфер пуст.
+  WaitList<PushAwaiter> pushers_;  // Ждут место; буфер заполнен.
+  void *executor_;
+  void (*schedule_)(void *, std::coroutine_handle<>);
+  mutable Mutex mutex_;
+};
+
+/**
+ * @brief Очередь для сопрограмм одного потока (без блокировок).
+ */
+template <class T>
+using async_queue = basic_async_queue<T, null_mutex>;
+
+/**
+ * @brief Очередь для сопрограмм, работающих в разных потоках.
+ */
+template <class T>
+using concurrent_async_queue = basic_async_queue<T, std::mutex>;
+
+}  // namespace s21
+
+#endif  // __cpp_impl_coroutine
+
+#endif
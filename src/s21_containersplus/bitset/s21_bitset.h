@@ -0,0 +1,307 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_BITSET_S21_BITSET_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_BITSET_S21_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace s21 {
+namespace detail {
+
+// Операции над 64-битными словами битовых множеств. Встроенные функции GCC
+// и Clang компилируются в popcnt/tzcnt/lzcnt, если их разрешает -march, и
+// вычислимы на этапе компиляции.
+
+constexpr unsigned PopCount(std::uint64_t word) noexcept {
+#if defined(__GNUC__)
+  return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+  unsigned count = 0;
+  for (; word != 0; word &= word - 1) ++count;
+  return count;
+#endif
+}
+
+// Номер младшего единичного бита; word != 0
+constexpr unsigned CountTrailingZeros(std::uint64_t word) noexcept {
+#if defined(__GNUC__)
+  return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+  unsigned count = 0;
+  for (; (word & 1U) == 0; word >>= 1U) ++count;
+  return count;
+#endif
+}
+
+// Номер старшего единичного бита; word != 0
+constexpr unsigned HighestBit(std::uint64_t word) noexcept {
+#if defined(__GNUC__)
+  return 63U - static_cast<unsigned>(__builtin_clzll(word));
+#else
+  unsigned bit = 0;
+  while (word >>= 1U) ++bit;
+  return bit;
+#endif
+}
+
+// Номер k-го (с нуля) единичного бита слова; k < PopCount(word)
+inline unsigned SelectInWord(std::uint64_t word, unsigned k) noexcept {
+#if defined(__BMI2__)
+  return static_cast<unsigned>(
+      _tzcnt_u64(_pdep_u64(std::uint64_t(1) << k, word)));
+#else
+  for (; k != 0; --k) word &= word - 1;
+  return CountTrailingZeros(word);
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief Битовое множество фиксированного размера, аналог std::bitset,
+ * все операции которого вычислимы на этапе компиляции.
+ *
+ * @details Биты хранятся в 64-битных словах. Подсчет единиц, поиск первой
+ * и следующей единицы и rank() обрабатывают слово за одну инструкцию
+ * (popcnt, tzcnt), а побитовые операции над всем множеством - простые циклы
+ * по словам фиксированной длины, которые компилятор векторизует.
+ *
+ * Биты старшего слова за пределами N всегда нулевые.
+ *
+ * @tparam N Число битов
+ */
+template <std::size_t N>
+class bitset {
+ public:
+  using size_type = std::size_t;
+
+  constexpr bitset() noexcept : words_{} {}
+
+  /**
+   * @brief Младшие биты берутся из value, остальные равны нулю.
+   */
+  constexpr bitset(unsigned long long value) noexcept : words_{} {
+    words_[0] = value;
+    Trim();
+  }
+
+  constexpr bool operator[](size_type pos) const noexcept {
+    return (words_[pos / kBits] >> (pos % kBits) & 1U) != 0;
+  }
+
+  /**
+   * @brief Значение бита с проверкой позиции.
+   *
+   * @throw std::out_of_range если pos >= N
+   */
+  constexpr bool test(size_type pos) const {
+    Check(pos, "s21::bitset::test: pos out of range");
+    return (*this)[pos];
+  }
+
+  constexpr bitset &set() noexcept {
+    for (size_type i = 0; i < kWords; ++i) words_[i] = ~std::uint64_t(0);
+    Trim();
+    return *this;
+  }
+
+  constexpr bitset &set(size_type pos, bool value = true) {
+    Check(pos, "s21::bitset::set: pos out of range");
+    std::uint64_t mask = std::uint64_t(1) << (pos % kBits);
+    if (value) {
+      words_[pos / kBits] |= mask;
+    } else {
+      words_[pos / kBits] &= ~mask;
+    }
+    return *this;
+  }
+
+  constexpr bitset &reset() noexcept {
+    for (size_type i = 0; i < kWords; ++i) words_[i] = 0;
+    return *this;
+  }
+
+  constexpr bitset &reset(size_type pos) {
+    Check(pos, "s21::bitset::reset: pos out of range");
+    words_[pos / kBits] &= ~(std::uint64_t(1) << (pos % kBits));
+    return *this;
+  }
+
+  constexpr bitset &flip() noexcept {
+    for (size_type i = 0; i < kWords; ++i) words_[i] = ~words_[i];
+    Trim();
+    return *this;
+  }
+
+  constexpr bitset &flip(size_type pos) {
+    Check(pos, "s21::bitset::flip: pos out of range");
+    words_[pos / kBits] ^= std::uint64_t(1) << (pos % kBits);
+    return *this;
+  }
+
+  constexpr size_type size() const noexcept { return N; }
+
+  /**
+   * @brief Число единичных битов.
+   */
+  constexpr size_type count() const noexcept {
+    size_type total = 0;
+    for (size_type i = 0; i < kWords; ++i) total += detail::PopCount(words_[i]);
+    return total;
+  }
+
+  /**
+   * @brief Число единичных битов на позициях [0, pos).
+   *
+   * @throw std::out_of_range если pos > N
+   */
+  constexpr size_type rank(size_type pos) const {
+    if (pos > N) throw std::out_of_range("s21::bitset::rank: pos > size()");
+    size_type total = 0;
+    for (size_type i = 0; i < pos / kBits; ++i)
+      total += detail::PopCount(words_[i]);
+    if (pos % kBits != 0)
+      total += detail::PopCount(words_[pos / kBits] &
+                                ((std::uint64_t(1) << (pos % kBits)) - 1U));
+    return total;
+  }
+
+  constexpr bool all() const noexcept { return count() == N; }
+
+  constexpr bool any() const noexcept {
+    for (size_type i = 0; i < kWords; ++i)
+      if (words_[i] != 0) return true;
+    return false;
+  }
+
+  constexpr bool none() const noexcept { return !any(); }
+
+  /**
+   * @brief Позиция первого единичного бита или size(), если их нет.
+   */
+  constexpr size_type find_first() const noexcept { return FindFrom(0); }
+
+  /**
+   * @brief Позиция первого единичного бита после pos или size().
+   */
+  constexpr size_type find_next(size_type pos) const noexcept {
+    return pos + 1U >= N ? N : FindFrom(pos + 1U);
+  }
+
+  constexpr bitset &operator&=(const bitset &other) noexcept {
+    for (size_type i = 0; i < kWords; ++i) words_[i] &= other.words_[i];
+    return *this;
+  }
+
+  constexpr bitset &operator|=(const bitset &other) noexcept {
+    for (size_type i = 0; i < kWords; ++i) words_[i] |= other.words_[i];
+    return *this;
+  }
+
+  constexpr bitset &operator^=(const bitset &other) noexcept {
+    for (size_type i = 0; i < kWords; ++i) words_[i] ^= other.words_[i];
+    return *this;
+  }
+
+  constexpr bitset &operator<<=(size_type shift) noexcept {
+    if (shift >= N) return reset();
+    size_type word_shift = shift / kBits;
+    size_type bit_shift = shift % kBits;
+    for (size_type i = kWords; i-- > word_shift;) {
+      std::uint64_t word = words_[i - word_shift] << bit_shift;
+      if (bit_shift != 0 && i > word_shift)
+        word |= words_[i - word_shift - 1U] >> (kBits - bit_shift);
+      words_[i] = word;
+    }
+    for (size_type i = 0; i < word_shift; ++i) words_[i] = 0;
+    Trim();
+    return *this;
+  }
+
+  constexpr bitset &operator>>=(size_type shift) noexcept {
+    if (shift >= N) return reset();
+    size_type word_shift = shift / kBits;
+    size_type bit_shift = shift % kBits;
+    for (size_type i = 0; i + word_shift < kWords; ++i) {
+      std::uint64_t word = words_[i + word_shift] >> bit_shift;
+      if (bit_shift != 0 && i + word_shift + 1U < kWords)
+        word |= words_[i + word_shift + 1U] << (kBits - bit_shift);
+      words_[i] = word;
+    }
+    for (size_type i = kWords - word_shift; i < kWords; ++i) words_[i] = 0;
+    return *this;
+  }
+
+  constexpr bitset operator~() const noexcept { return bitset(*this).flip(); }
+
+  constexpr bitset operator<<(size_type shift) const noexcept {
+    return bitset(*this) <<= shift;
+  }
+
+  constexpr bitset operator>>(size_type shift) const noexcept {
+    return bitset(*this) >>= shift;
+  }
+
+  constexpr bool operator==(const bitset &other) const noexcept {
+    for (size_type i = 0; i < kWords; ++i)
+      if (words_[i] != other.words_[i]) return false;
+    return true;
+  }
+
+  constexpr bool operator!=(const bitset &other) const noexcept {
+    return !(*this == other);
+  }
+
+  friend constexpr bitset operator&(const bitset &lhs,
+                                    const bitset &rhs) noexcept {
+    return bitset(lhs) &= rhs;
+  }
+
+  friend constexpr bitset operator|(const bitset &lhs,
+                                    const bitset &rhs) noexcept {
+    return bitset(lhs) |= rhs;
+  }
+
+  friend constexpr bitset operator^(const bitset &lhs,
+                                    const bitset &rhs) noexcept {
+    return bitset(lhs) ^= rhs;
+  }
+
+ private:
+  static constexpr size_type kBits = 64U;
+  static constexpr size_type kWords = N == 0 ? 1U : (N + kBits - 1U) / kBits;
+
+  static constexpr void Check(size_type pos, const char *message) {
+    if (pos >= N) throw std::out_of_range(message);
+  }
+
+  // Обнуляет биты старшего слова за пределами N
+  constexpr void Trim() noexcept {
+    if constexpr (N % kBits != 0) {
+      words_[kWords - 1U] &= (std::uint64_t(1) << (N % kBits)) - 1U;
+    } else if constexpr (N == 0) {
+      words_[0] = 0;
+    }
+  }
+
+  constexpr size_type FindFrom(size_type pos) const noexcept {
+    if (pos >= N) return N;
+    size_type i = pos / kBits;
+    std::uint64_t word = words_[i] & (~std::uint64_t(0) << (pos % kBits));
+    while (word == 0) {
+      if (++i == kWords) return N;
+      word = words_[i];
+    }
+    return i * kBits + detail::CountTrailingZeros(word);
+  }
+
+  std::uint64_t words_[kWords];
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,388 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_CONCURRENT_HASH_MAP_S21_CONCURRENT_HASH_MAP_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_CONCURRENT_HASH_MAP_S21_CONCURRENT_HASH_MAP_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+/**
+ * @brief Хэш-таблица для одновременного доступа из многих потоков.
+ *
+ * @details Таблица разбита на сегменты (lock striping): у каждого сегмента
+ * своя таблица корзин и свой std::shared_mutex. Ключ попадает в сегмент по
+ * старшим битам хэша, поэтому потоки, работающие с разными ключами, почти
+ * никогда не ждут друг друга, а чтения одного сегмента идут параллельно.
+ *
+ * Каждый сегмент растет независимо и постепенно: при переполнении
+ * выделяется вдвое большая таблица, а цепочки из старой переносятся по
+ * несколько корзин за каждую изменяющую операцию. Пока перенос не закончен,
+ * поиск смотрит в обе таблицы. Так ни одна операция не останавливает
+ * сегмент на время перехэширования всех его элементов.
+ *
+ * Итераторов нет: элемент может быть удален другим потоком в любой момент.
+ * find() возвращает копию значения, а visit() и upsert() вызывают функцию
+ * под блокировкой сегмента.
+ *
+ * @tparam Key Тип ключа
+ * @tparam T Тип значения
+ * @tparam Hash Хэш-функция
+ * @tparam KeyEqual Функция сравнения ключей на равенство
+ */
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>>
+class concurrent_hash_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  /**
+   * @brief Создает пустую таблицу.
+   *
+   * @param segments Количество сегментов (округляется вверх до степени
+   * двойки). По умолчанию - в 8 раз больше числа аппаратных потоков, но не
+   * меньше 16.
+   */
+  explicit concurrent_hash_map(size_type segments = DefaultSegmentCount(),
+                               const hasher &hash = hasher(),
+                               const key_equal &equal = key_equal())
+      : segment_count_(RoundUpToPowerOfTwo(segments)),
+        segments_(std::make_unique<Segment[]>(segment_count_)),
+        hash_(hash),
+        equal_(equal) {}
+
+  concurrent_hash_map(const concurrent_hash_map &) = delete;
+  concurrent_hash_map &operator=(const concurrent_hash_map &) = delete;
+
+  ~concurrent_hash_map() {
+    for (size_type i = 0; i < segment_count_; ++i) segments_[i].Clear();
+  }
+
+ public:
+  /**
+   * @brief Количество элементов. Если таблицу одновременно изменяют другие
+   * потоки, результат - приблизительный.
+   */
+  size_type size() const noexcept {
+    size_type result = 0;
+    for (size_type i = 0; i < segment_count_; ++i)
+      result += segments_[i].size_.load(std::memory_order_relaxed);
+    return result;
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type segment_count() const noexcept { return segment_count_; }
+
+  /**
+   * @brief Суммарное количество корзин во всех сегментах (без таблиц, из
+   * которых еще идет перенос).
+   */
+  size_type bucket_count() const {
+    size_type result = 0;
+    for (size_type i = 0; i < segment_count_; ++i) {
+      std::shared_lock<std::shared_mutex> lock(segments_[i].mutex_);
+      result += segments_[i].buckets_.size();
+    }
+    return result;
+  }
+
+  /**
+   * @brief Удаляет все элементы. Сегменты очищаются по очереди, поэтому
+   * элементы, вставленные во время вызова, могут остаться.
+   */
+  void clear() noexcept {
+    for (size_type i = 0; i < segment_count_; ++i) {
+      std::unique_lock<std::shared_mutex> lock(segments_[i].mutex_);
+      segments_[i].Clear();
+    }
+  }
+
+ public:
+  /**
+   * @brief Вставляет элемент, если ключа еще нет.
+   *
+   * @return true, если элемент вставлен
+   */
+  bool insert(const value_type &value) {
+    return Modify(
+        value.first, [&value] { return value; }, [](mapped_type &) {});
+  }
+
+  /**
+   * @brief Вставляет элемент или присваивает obj значению существующего.
+   *
+   * @return true, если элемент вставлен, false - если значение заменено
+   */
+  template <class M>
+  bool insert_or_assign(const key_type &key, M &&obj) {
+    return Modify(
+        key, [&] { return value_type(key, std::forward<M>(obj)); },
+        [&obj](mapped_type &value) { value = std::forward<M>(obj); });
+  }
+
+  /**
+   * @brief Атомарно изменяет значение по ключу.
+   *
+   * @details Если ключа нет, вставляет значение mapped_type(). Затем
+   * вызывает fn(mapped_type &) под эксклюзивной блокировкой сегмента, так
+   * что чтение-изменение-запись не пересекается с другими операциями над
+   * этим ключом. fn не должна обращаться к этой же таблице.
+   *
+   * @return true, если элемент был вставлен
+   */
+  template <class F>
+  bool upsert(const key_type &key, F &&fn) {
+    bool inserted = false;
+    Modify(
+        key,
+        [&] {
+          value_type value(key, mapped_type());
+          fn(value.second);
+          inserted = true;
+          return value;
+        },
+        [&fn](mapped_type &value) { fn(value); });
+    return inserted;
+  }
+
+  /**
+   * @brief Копия значения по ключу или std::nullopt, если ключа нет.
+   */
+  std::optional<mapped_type> find(const key_type &key) const {
+    std::optional<mapped_type> result;
+    visit(key, [&result](const mapped_type &value) { result = value; });
+    return result;
+  }
+
+  bool contains(const key_type &key) const {
+    return visit(key, [](const mapped_type &) {});
+  }
+
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  /**
+   * @brief Вызывает fn(const mapped_type &) для значения по ключу под
+   * разделяемой блокировкой сегмента (без копирования значения). fn не
+   * должна обращаться к этой же таблице.
+   *
+   * @return true, если ключ найден
+   */
+  template <class F>
+  bool visit(const key_type &key, F &&fn) const {
+    size_type hash = HashOf(key);
+    Segment &segment = SegmentFor(hash);
+    std::shared_lock<std::shared_mutex> lock(segment.mutex_);
+    Node **link = segment.FindLink(hash, key, equal_);
+    if (!link) return false;
+    fn(static_cast<const mapped_type &>((*link)->value_.second));
+    return true;
+  }
+
+  /**
+   * @brief Удаляет элемент по ключу.
+   *
+   * @return Количество удаленных элементов (0 или 1)
+   */
+  size_type erase(const key_type &key) {
+    size_type hash = HashOf(key);
+    Segment &segment = SegmentFor(hash);
+    std::unique_lock<std::shared_mutex> lock(segment.mutex_);
+    segment.Migrate(kMigrationStep);
+    Node **link = segment.FindLink(hash, key, equal_);
+    if (!link) return 0;
+    Node *node = *link;
+    *link = node->next_;
+    delete node;
+    segment.size_.fetch_sub(1, std::memory_order_relaxed);
+    return 1;
+  }
+
+  /**
+   * @brief Вызывает fn(const value_type &) для всех элементов. Сегменты
+   * обходятся по очереди под разделяемой блокировкой, поэтому обход не
+   * является снимком таблицы на один момент времени.
+   */
+  template <class F>
+  void for_each(F &&fn) const {
+    for (size_type i = 0; i < segment_count_; ++i) {
+      std::shared_lock<std::shared_mutex> lock(segments_[i].mutex_);
+      segments_[i].ForEach(fn);
+    }
+  }
+
+  static size_type DefaultSegmentCount() noexcept {
+    size_type threads = std::thread::hardware_concurrency();
+    return threads * 8 < 16 ? 16 : threads * 8;
+  }
+
+ private:
+  struct Node {
+    Node(value_type value, size_type hash)
+        : value_(std::move(value)), hash_(hash), next_(nullptr) {}
+
+    value_type value_;
+    size_type hash_;  // Хэш ключа, чтобы не вычислять его при переносе.
+    Node *next_;
+  };
+
+  // Сегмент занимает отдельные кэш-линии, чтобы блокировки соседних
+  // сегментов не мешали друг другу (false sharing)
+  struct alignas(64) Segment {
+    Segment() : buckets_(kInitialBuckets, nullptr), migrated_(0), size_(0) {}
+
+    // Указатель на ссылку на узел с ключом key или nullptr
+    Node **FindLink(size_type hash, const key_type &key,
+                    const key_equal &equal) {
+      Node **link = FindIn(buckets_, hash, key, equal);
+      if (link || old_buckets_.empty()) return link;
+      // Корзины старой таблицы до migrated_ уже перенесены
+      if ((hash & (old_buckets_.size() - 1)) < migrated_) return nullptr;
+      return FindIn(old_buckets_, hash, key, equal);
+    }
+
+    static Node **FindIn(std::vector<Node *> &buckets, size_type hash,
+                         const key_type &key, const key_equal &equal) {
+      Node **link = &buckets[hash & (buckets.size() - 1)];
+      for (; *link; link = &(*link)->next_)
+        if ((*link)->hash_ == hash && equal((*link)->value_.first, key))
+          return link;
+      return nullptr;
+    }
+
+    // Подготавливает место для еще одного элемента. Может выбросить
+    // исключение только до изменения сегмента
+    void Reserve() {
+      if (size_.load(std::memory_order_relaxed) < buckets_.size()) return;
+      // Предыдущий перенос должен закончиться до начала следующего
+      Migrate(old_buckets_.size());
+      std::vector<Node *> bigger(buckets_.size() * 2, nullptr);
+      old_buckets_.swap(buckets_);
+      buckets_.swap(bigger);
+      migrated_ = 0;
+    }
+
+    void Link(Node *node) noexcept {
+      Node *&head = buckets_[node->hash_ & (buckets_.size() - 1)];
+      node->next_ = head;
+      head = node;
+    }
+
+    // Переносит в новую таблицу до steps корзин старой
+    void Migrate(size_type steps) noexcept {
+      if (old_buckets_.empty()) return;
+      for (; steps > 0 && migrated_ < old_buckets_.size(); --steps) {
+        Node *node = old_buckets_[migrated_];
+        old_buckets_[migrated_++] = nullptr;
+        while (node) {
+          Node *next = node->next_;
+          Link(node);
+          node = next;
+        }
+      }
+      if (migrated_ == old_buckets_.size()) {
+        std::vector<Node *>().swap(old_buckets_);
+        migrated_ = 0;
+      }
+    }
+
+    template <class F>
+    void ForEach(F &fn) const {
+      for (const std::vector<Node *> *buckets : {&buckets_, &old_buckets_})
+        for (Node *head : *buckets)
+          for (Node *node = head; node; node = node->next_)
+            fn(static_cast<const value_type &>(node->value_));
+    }
+
+    void Clear() noexcept {
+      for (std::vector<Node *> *buckets : {&buckets_, &old_buckets_}) {
+        for (Node *&head : *buckets) {
+          while (head) {
+            Node *next = head->next_;
+            delete head;
+            head = next;
+          }
+        }
+      }
+      std::vector<Node *>().swap(old_buckets_);
+      migrated_ = 0;
+      size_.store(0, std::memory_order_relaxed);
+    }
+
+    mutable std::shared_mutex mutex_;
+    std::vector<Node *> buckets_;      // Текущая таблица корзин.
+    std::vector<Node *> old_buckets_;  // Таблица, из которой идет перенос.
+    size_type migrated_;  // Сколько корзин old_buckets_ уже перенесено.
+    std::atomic<size_type> size_;  // Изменяется под mutex_.
+  };
+
+  // Под эксклюзивной блокировкой сегмента: если ключ есть - вызывает
+  // update(mapped_type &), иначе вставляет элемент create()
+  template <class Create, class Update>
+  bool Modify(const key_type &key, Create &&create, Update &&update) {
+    size_type hash = HashOf(key);
+    Segment &segment = SegmentFor(hash);
+    std::unique_lock<std::shared_mutex> lock(segment.mutex_);
+    segment.Migrate(kMigrationStep);
+    if (Node **link = segment.FindLink(hash, key, equal_)) {
+      update((*link)->value_.second);
+      return false;
+    }
+    auto node = std::make_unique<Node>(create(), hash);
+    segment.Reserve();
+    segment.Link(node.release());
+    segment.size_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // std::hash для целых - тождественная функция, поэтому перемешиваем биты
+  // (финализатор MurmurHash3): старшие биты выбирают сегмент, младшие -
+  // корзину
+  size_type HashOf(const key_type &key) const {
+    std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+    h ^= h >> 33U;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33U;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33U;
+    return static_cast<size_type>(h);
+  }
+
+  Segment &SegmentFor(size_type hash) const noexcept {
+    return segments_[(hash >> kSegmentShift) & (segment_count_ - 1)];
+  }
+
+  static size_type RoundUpToPowerOfTwo(size_type value) noexcept {
+    size_type result = 1;
+    while (result < value) result *= 2;
+    return result;
+  }
+
+  static constexpr size_type kInitialBuckets = 8;
+  // Сколько корзин старой таблицы переносит каждая изменяющая операция.
+  // Перенос заканчивается раньше, чем сегмент снова заполнится
+  static constexpr size_type kMigrationStep = 2;
+  static constexpr unsigned kSegmentShift = sizeof(size_type) * 4U;
+
+  size_type segment_count_;
+  std::unique_ptr<Segment[]> segments_;
+  hasher hash_;
+  key_equal equal_;
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,302 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_CONCURRENT_STACK_S21_CONCURRENT_STACK_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_CONCURRENT_STACK_S21_CONCURRENT_STACK_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+/**
+ * @brief Стек без блокировок для нескольких потоков (стек Трайбера).
+ *
+ * @details Вершина стека - одно 64-битное атомарное слово: индекс узла и
+ * счетчик изменений (тег). Каждое изменение вершины увеличивает тег, поэтому
+ * compare_exchange не срабатывает, если между чтением и записью узел успели
+ * снять и вернуть обратно (проблема ABA).
+ *
+ * Узлы не возвращаются в кучу, пока жив стек: освободившиеся узлы попадают
+ * в собственный список свободных узлов (такой же стек с тегом), а память
+ * выделяется блоками удваивающегося размера. Поэтому поток, прочитавший
+ * индекс уже снятого узла, читает корректную память, а его compare_exchange
+ * просто не сработает. Отдельная схема отложенного освобождения не нужна.
+ *
+ * При высокой конкуренции push() и pop(), не сумевшие изменить вершину,
+ * пытаются встретиться в массиве исключения (elimination backoff): push()
+ * оставляет узел в случайной ячейке и немного ждет, а встречный pop()
+ * забирает его напрямую, не трогая вершину стека.
+ *
+ * @tparam T Тип элементов
+ */
+template <class T>
+class concurrent_stack {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+
+  concurrent_stack() : chunk_count_(0) {
+    for (std::atomic<Node *> &chunk : chunks_)
+      chunk.store(nullptr, std::memory_order_relaxed);
+  }
+
+  concurrent_stack(const concurrent_stack &) = delete;
+  concurrent_stack &operator=(const concurrent_stack &) = delete;
+
+  /**
+   * @brief Уничтожает оставшиеся элементы. Другие потоки не должны
+   * обращаться к стеку во время вызова деструктора.
+   */
+  ~concurrent_stack() {
+    // Элементы уничтожаются на месте, без перемещения, которое может бросить
+    while (index_type index = stack_.Pop(*this))
+      NodeAt(index).Value()->~value_type();
+    for (size_type k = 0; k < chunk_count_; ++k)
+      delete[] chunks_[k].load(std::memory_order_relaxed);
+  }
+
+  void push(const_reference value) { emplace(value); }
+
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  /**
+   * @brief Создает элемент на вершине стека из аргументов args.
+   */
+  template <class... Args>
+  void emplace(Args &&...args) {
+    index_type index = Allocate();
+    Node &node = NodeAt(index);
+    try {
+      new (node.Value()) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      free_.Push(*this, index);
+      throw;
+    }
+    while (!stack_.TryPush(*this, index)) {
+      if (EliminatePush(index)) return;
+    }
+  }
+
+  /**
+   * @brief Снимает элемент с вершины стека.
+   *
+   * @details Если перемещение элемента из узла бросает исключение, узел
+   * вместе с элементом возвращается в стек, и исключение пробрасывается
+   * дальше.
+   *
+   * @return Элемент или std::nullopt, если стек пуст
+   */
+  std::optional<value_type> pop() {
+    index_type index = 0;
+    while (true) {
+      PopResult result = stack_.TryPop(*this, index);
+      if (result == PopResult::kSuccess) break;
+      if (result == PopResult::kEmpty) return std::nullopt;
+      index = EliminatePop();
+      if (index != 0) break;
+    }
+    Node &node = NodeAt(index);
+    std::optional<value_type> result;
+    try {
+      result.emplace(std::move(*node.Value()));
+    } catch (...) {
+      stack_.Push(*this, index);
+      throw;
+    }
+    node.Value()->~value_type();
+    free_.Push(*this, index);
+    return result;
+  }
+
+  /**
+   * @brief Пуст ли стек. При одновременной работе других потоков результат
+   * может сразу устареть.
+   */
+  bool empty() const noexcept { return stack_.Empty(); }
+
+ private:
+  using index_type = std::uint32_t;
+  using word_type = std::uint64_t;
+
+  enum class PopResult { kEmpty, kSuccess, kContended };
+
+  struct Node {
+    value_type *Value() noexcept {
+      return std::launder(reinterpret_cast<value_type *>(storage_));
+    }
+
+    // Следующий узел. Атомарный, так как его может читать поток, который
+    // еще не знает, что узел уже снят и переиспользован
+    std::atomic<index_type> next_{0};
+    alignas(value_type) unsigned char storage_[sizeof(value_type)];
+  };
+
+  // Индекс узла (0 - пусто) в младших 32 битах, тег в старших
+  static word_type Pack(index_type index, word_type tag) noexcept {
+    return (tag << 32U) | index;
+  }
+
+  static index_type IndexOf(word_type word) noexcept {
+    return static_cast<index_type>(word);
+  }
+
+  static word_type NextTag(word_type word) noexcept {
+    return (word >> 32U) + 1U;
+  }
+
+  // Стек индексов с тегом: и сам стек элементов, и список свободных узлов
+  class TaggedStack {
+   public:
+    // Одна попытка положить узел; false, если вершину изменил другой поток
+    bool TryPush(concurrent_stack &owner, index_type index) {
+      word_type head = head_.load(std::memory_order_relaxed);
+      owner.NodeAt(index).next_.store(IndexOf(head),
+                                      std::memory_order_relaxed);
+      return head_.compare_exchange_weak(head, Pack(index, NextTag(head)),
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed);
+    }
+
+    void Push(concurrent_stack &owner, index_type index) {
+      while (!TryPush(owner, index)) {
+      }
+    }
+
+    PopResult TryPop(concurrent_stack &owner, index_type &index) {
+      word_type head = head_.load(std::memory_order_acquire);
+      index = IndexOf(head);
+      if (index == 0) return PopResult::kEmpty;
+      index_type next =
+          owner.NodeAt(index).next_.load(std::memory_order_relaxed);
+      if (head_.compare_exchange_weak(head, Pack(next, NextTag(head)),
+                                      std::memory_order_acquire,
+                                      std::memory_order_relaxed))
+        return PopResult::kSuccess;
+      return PopResult::kContended;
+    }
+
+    // Снимает узел; 0, если стек пуст
+    index_type Pop(concurrent_stack &owner) {
+      index_type index = 0;
+      while (TryPop(owner, index) == PopResult::kContended) {
+      }
+      return index;
+    }
+
+    bool Empty() const noexcept {
+      return IndexOf(head_.load(std::memory_order_relaxed)) == 0;
+    }
+
+   private:
+    std::atomic<word_type> head_{0};
+  };
+
+  // Ячейка массива исключения: индекс узла, предложенного push(), и тег
+  struct alignas(64) Slot {
+    std::atomic<word_type> word_{0};
+  };
+
+  // Предлагает узел встречному pop(). true, если узел забрали
+  bool EliminatePush(index_type index) {
+    Slot &slot = RandomSlot();
+    word_type empty = slot.word_.load(std::memory_order_relaxed);
+    if (IndexOf(empty) != 0) return false;
+    word_type offer = Pack(index, NextTag(empty));
+    if (!slot.word_.compare_exchange_strong(empty, offer,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed))
+      return false;
+    for (int i = 0; i < kEliminationSpins; ++i) {
+      if (slot.word_.load(std::memory_order_relaxed) != offer) return true;
+      CpuRelax();
+    }
+    // Забираем предложение обратно; не вышло - значит, узел уже забрали
+    return !slot.word_.compare_exchange_strong(
+        offer, Pack(0, NextTag(offer)), std::memory_order_relaxed,
+        std::memory_order_relaxed);
+  }
+
+  // Забирает узел, предложенный встречным push(); 0, если не удалось
+  index_type EliminatePop() {
+    Slot &slot = RandomSlot();
+    word_type offer = slot.word_.load(std::memory_order_relaxed);
+    if (IndexOf(offer) == 0) return 0;
+    if (!slot.word_.compare_exchange_strong(offer, Pack(0, NextTag(offer)),
+                                            std::memory_order_acquire,
+                                            std::memory_order_relaxed))
+      return 0;
+    return IndexOf(offer);
+  }
+
+  Slot &RandomSlot() noexcept {
+    // xorshift: ячейка выбирается случайно, чтобы потоки реже сталкивались
+    static thread_local std::uint32_t state =
+        static_cast<std::uint32_t>(
+            reinterpret_cast<std::uintptr_t>(&state) >> 4U) |
+        1U;
+    state ^= state << 13U;
+    state ^= state >> 17U;
+    state ^= state << 5U;
+    return slots_[state % kEliminationSlots];
+  }
+
+  static void CpuRelax() noexcept {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#endif
+  }
+
+  // Узлы блока k имеют индексы [2^k, 2^(k+1))
+  Node &NodeAt(index_type index) const noexcept {
+    unsigned k = HighestBit(index);
+    return chunks_[k].load(std::memory_order_acquire)[index - (1U << k)];
+  }
+
+  static unsigned HighestBit(index_type value) noexcept {
+#if defined(__GNUC__)
+    return 31U - static_cast<unsigned>(__builtin_clz(value));
+#else
+    unsigned bit = 0;
+    while (value >>= 1U) ++bit;
+    return bit;
+#endif
+  }
+
+  // Берет свободный узел, при необходимости выделяя новый блок
+  index_type Allocate() {
+    while (true) {
+      index_type index = free_.Pop(*this);
+      if (index != 0) return index;
+      std::lock_guard<std::mutex> lock(grow_mutex_);
+      // Пока мы ждали мьютекс, новый блок мог выделить другой поток
+      if (!free_.Empty()) continue;
+      if (chunk_count_ == kMaxChunks)
+        throw std::length_error("s21::concurrent_stack: too many elements");
+      index_type first = index_type{1} << chunk_count_;
+      chunks_[chunk_count_].store(new Node[first], std::memory_order_release);
+      ++chunk_count_;
+      for (index_type i = 1; i < first; ++i) free_.Push(*this, first + i);
+      return first;
+    }
+  }
+
+  static constexpr size_type kMaxChunks = 32;
+  static constexpr size_type kEliminationSlots = 16;
+  static constexpr int kEliminationSpins = 64;
+
+  alignas(64) TaggedStack stack_;
+  alignas(64) TaggedStack free_;
+  Slot slots_[kEliminationSlots];
+  std::atomic<Node *> chunks_[kMaxChunks];
+  std::mutex grow_mutex_;
+  size_type chunk_count_;  // Защищен grow_mutex_.
+};
+
+}  // namespace s21
+
+#endif
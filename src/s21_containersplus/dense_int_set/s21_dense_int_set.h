@@ -0,0 +1,413 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_DENSE_INT_SET_S21_DENSE_INT_SET_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_DENSE_INT_SET_S21_DENSE_INT_SET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../../s21_containers/set/s21_set.h"
+#include "../../s21_containers/vector/s21_vector.h"
+#include "../bitset/s21_bitset.h"
+
+namespace s21 {
+
+/**
+ * @brief Множество чисел std::uint32_t в виде битового массива, с rank() и
+ * select() за O(log n).
+ *
+ * @details Подходит для плотных множеств (идентификаторы, выдаваемые
+ * подряд): число x - это бит x массива слов, поэтому память - один бит на
+ * каждое значение от 0 до наибольшего элемента (плюс 1/64 на индекс rank),
+ * а не ~40 байтов на элемент, как у s21::set<std::uint32_t>. Для редких
+ * множеств с большими значениями это невыгодно.
+ *
+ * Для rank() и select() хранятся числа элементов в блоках по kBlockWords
+ * слов, сложенные в дерево Фенвика: вставка и удаление обновляют его за
+ * O(log n), поэтому константные методы ничего не перестраивают и безопасны
+ * при одновременном вызове из разных потоков.
+ *
+ * Итератор хранит позицию, а не указатель на слово, и остается
+ * действительным при вставках (в том числе с ростом массива) и удалении
+ * других элементов.
+ */
+class dense_int_set {
+ private:
+  struct DenseIntSetIterator;
+
+ public:
+  using key_type = std::uint32_t;
+  using value_type = std::uint32_t;
+  using reference = value_type;
+  using const_reference = value_type;
+  using iterator = DenseIntSetIterator;
+  using const_iterator = DenseIntSetIterator;
+  using size_type = std::size_t;
+
+  dense_int_set() = default;
+
+  dense_int_set(std::initializer_list<value_type> const &items)
+      : dense_int_set(items.begin(), items.end()) {}
+
+  template <class InputIt>
+  dense_int_set(InputIt first, InputIt last) : dense_int_set() {
+    for (; first != last; ++first) insert(*first);
+  }
+
+  /**
+   * @brief Строит множество из s21::set: память выделяется один раз, по
+   * наибольшему элементу.
+   */
+  template <class Compare, class Storage>
+  explicit dense_int_set(const s21::set<value_type, Compare, Storage> &other)
+      : dense_int_set() {
+    if (other.empty()) return;
+    value_type largest = 0;
+    for (value_type value : other) largest = std::max(largest, value);
+    Reserve(std::uint64_t(largest) + 1U);
+    for (value_type value : other) SetBit(value);
+    size_ = other.size();
+    RebuildIndex();
+  }
+
+  dense_int_set(const dense_int_set &other) = default;
+
+  dense_int_set(dense_int_set &&other) noexcept : dense_int_set() {
+    swap(other);
+  }
+
+  dense_int_set &operator=(const dense_int_set &other) = default;
+
+  dense_int_set &operator=(dense_int_set &&other) noexcept {
+    if (this != &other) {
+      dense_int_set tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ~dense_int_set() = default;
+
+ public:
+  iterator begin() const noexcept { return iterator(this, FindFrom(0)); }
+
+  iterator end() const noexcept { return iterator(this, kEnd); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return size_type(std::numeric_limits<value_type>::max()) + 1U;
+  }
+
+  /**
+   * @brief Удаляет все элементы и освобождает память.
+   */
+  void clear() noexcept {
+    words_ = s21::vector<std::uint64_t>();
+    index_ = s21::vector<std::uint64_t>();
+    size_ = 0;
+  }
+
+  std::pair<iterator, bool> insert(value_type value) {
+    if (std::uint64_t(value) >= Universe()) Reserve(std::uint64_t(value) + 1U);
+    bool inserted = !Test(value);
+    if (inserted) {
+      SetBit(value);
+      ++size_;
+      AddToIndex(value, 1U);
+    }
+    return {iterator(this, value), inserted};
+  }
+
+  void erase(iterator pos) noexcept { erase(*pos); }
+
+  size_type erase(value_type value) noexcept {
+    if (!contains(value)) return 0;
+    words_.data()[value / kBits] &= ~(std::uint64_t(1) << (value % kBits));
+    --size_;
+    AddToIndex(value, ~std::uint64_t(0));
+    return 1;
+  }
+
+  void swap(dense_int_set &other) noexcept {
+    words_.swap(other.words_);
+    index_.swap(other.index_);
+    std::swap(size_, other.size_);
+  }
+
+  /**
+   * @brief Переносит из other элементы, которых нет в *this (в other
+   * остаются только общие элементы). Выполняется по словам, за O(n / 64).
+   */
+  void merge(dense_int_set &other) {
+    if (this == &other) return;
+    if (other.Universe() > Universe()) Reserve(other.Universe());
+    std::uint64_t *mine = words_.data();
+    std::uint64_t *theirs = other.words_.data();
+    for (size_type i = 0; i < other.words_.size(); ++i) {
+      std::uint64_t moved = theirs[i] & ~mine[i];
+      mine[i] |= moved;
+      theirs[i] &= ~moved;
+    }
+    RebuildIndex();
+    other.RebuildIndex();
+  }
+
+ public:
+  bool contains(value_type value) const noexcept {
+    return std::uint64_t(value) < Universe() && Test(value);
+  }
+
+  size_type count(value_type value) const noexcept {
+    return contains(value) ? 1 : 0;
+  }
+
+  iterator find(value_type value) const noexcept {
+    return contains(value) ? iterator(this, value) : end();
+  }
+
+  iterator lower_bound(value_type value) const noexcept {
+    return iterator(this, FindFrom(value));
+  }
+
+  iterator upper_bound(value_type value) const noexcept {
+    return iterator(this, FindFrom(std::uint64_t(value) + 1U));
+  }
+
+  /**
+   * @brief Число элементов, меньших value.
+   */
+  size_type rank(value_type value) const noexcept {
+    std::uint64_t position = std::min<std::uint64_t>(value, Universe());
+    size_type word = static_cast<size_type>(position / kBits);
+    size_type block = word / kBlockWords;
+    // Сумма по блокам [0, block) из дерева Фенвика
+    std::uint64_t total = 0;
+    for (size_type i = block; i > 0; i &= i - 1) total += index_.data()[i];
+    const std::uint64_t *words = words_.data();
+    for (size_type i = block * kBlockWords; i < word; ++i)
+      total += detail::PopCount(words[i]);
+    if (position % kBits != 0) {
+      std::uint64_t below = (std::uint64_t(1) << (position % kBits)) - 1U;
+      total += detail::PopCount(words[word] & below);
+    }
+    return static_cast<size_type>(total);
+  }
+
+  /**
+   * @brief k-й по возрастанию элемент (с нуля): select(rank(x)) == x для
+   * любого элемента x.
+   *
+   * @throw std::out_of_range если k >= size()
+   */
+  value_type select(size_type k) const {
+    if (k >= size_)
+      throw std::out_of_range("s21::dense_int_set::select: k >= size()");
+    // Спуск по дереву Фенвика: последний блок, перед которым меньше k + 1
+    // элементов
+    size_type blocks = index_.size() - 1U;
+    size_type block = 0;
+    std::uint64_t remaining = k;
+    for (size_type step = size_type(1) << detail::HighestBit(blocks);
+         step != 0; step >>= 1U) {
+      if (block + step <= blocks && index_.data()[block + step] <= remaining) {
+        block += step;
+        remaining -= index_.data()[block];
+      }
+    }
+    const std::uint64_t *words = words_.data();
+    size_type word = block * kBlockWords;
+    for (;; ++word) {
+      unsigned ones = detail::PopCount(words[word]);
+      if (remaining < ones) break;
+      remaining -= ones;
+    }
+    return static_cast<value_type>(
+        word * kBits +
+        detail::SelectInWord(words[word], static_cast<unsigned>(remaining)));
+  }
+
+  /**
+   * @brief Копия в виде s21::set (дерево строится за O(n): элементы уже
+   * упорядочены).
+   */
+  s21::set<value_type> to_set() const {
+    return s21::set<value_type>(s21::execution::seq, begin(), end());
+  }
+
+  bool operator==(const dense_int_set &other) const noexcept {
+    if (size_ != other.size_) return false;
+    const dense_int_set &shorter =
+        words_.size() < other.words_.size() ? *this : other;
+    const dense_int_set &longer = &shorter == this ? other : *this;
+    for (size_type i = 0; i < longer.words_.size(); ++i) {
+      std::uint64_t word =
+          i < shorter.words_.size() ? shorter.words_.data()[i] : 0U;
+      if (word != longer.words_.data()[i]) return false;
+    }
+    return true;
+  }
+
+  bool operator!=(const dense_int_set &other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  static constexpr size_type kBits = 64U;
+  // Слов в блоке индекса rank: 512 битов, одна кэш-линия
+  static constexpr size_type kBlockWords = 8U;
+  // Позиция end(): больше любого значения и не зависит от размера массива
+  static constexpr std::uint64_t kEnd = std::uint64_t(1) << 32U;
+
+  std::uint64_t Universe() const noexcept {
+    return std::uint64_t(words_.size()) * kBits;
+  }
+
+  bool Test(value_type value) const noexcept {
+    return (words_.data()[value / kBits] >> (value % kBits) & 1U) != 0;
+  }
+
+  void SetBit(value_type value) noexcept {
+    words_.data()[value / kBits] |= std::uint64_t(1) << (value % kBits);
+  }
+
+  // Первый элемент, не меньший position, или kEnd
+  std::uint64_t FindFrom(std::uint64_t position) const noexcept {
+    if (position >= Universe()) return kEnd;
+    const std::uint64_t *words = words_.data();
+    size_type i = static_cast<size_type>(position / kBits);
+    std::uint64_t word = words[i] & (~std::uint64_t(0) << (position % kBits));
+    while (word == 0) {
+      if (++i == words_.size()) return kEnd;
+      word = words[i];
+    }
+    return std::uint64_t(i) * kBits + detail::CountTrailingZeros(word);
+  }
+
+  // Последний элемент, не больший position, или kEnd
+  std::uint64_t FindBefore(std::uint64_t position) const noexcept {
+    if (Universe() == 0) return kEnd;
+    position = std::min(position, Universe() - 1U);
+    const std::uint64_t *words = words_.data();
+    size_type i = static_cast<size_type>(position / kBits);
+    unsigned shift = static_cast<unsigned>(kBits - 1U - position % kBits);
+    std::uint64_t word = words[i] & (~std::uint64_t(0) >> shift);
+    while (word == 0) {
+      if (i-- == 0) return kEnd;
+      word = words[i];
+    }
+    return std::uint64_t(i) * kBits + detail::HighestBit(word);
+  }
+
+  /**
+   * @brief Расширяет массив слов так, чтобы в нем помещались значения
+   * [0, values). Массив растет как минимум вдвое (но не больше 2^32
+   * битов), а кратность блоку сохраняет индекс rank простым.
+   */
+  void Reserve(std::uint64_t values) {
+    constexpr size_type kMaxWords =
+        size_type((std::uint64_t(1) << 32U) / kBits);
+    size_type needed = static_cast<size_type>((values + kBits - 1U) / kBits);
+    size_type words = std::min(kMaxWords, std::max(needed, 2U * words_.size()));
+    words = (words + kBlockWords - 1U) / kBlockWords * kBlockWords;
+    s21::vector<std::uint64_t> grown(words);
+    std::copy(words_.begin(), words_.end(), grown.begin());
+    words_.swap(grown);
+    RebuildIndex();
+  }
+
+  // Добавляет delta (по модулю 2^64) к числу элементов блока value
+  void AddToIndex(value_type value, std::uint64_t delta) noexcept {
+    size_type blocks = index_.size() - 1U;
+    std::uint64_t *index = index_.data();
+    for (size_type i = value / kBits / kBlockWords + 1U; i <= blocks;
+         i += i & (0U - i))
+      index[i] += delta;
+  }
+
+  // Перестраивает дерево Фенвика по массиву слов за O(n / 64) и
+  // пересчитывает размер
+  void RebuildIndex() {
+    size_type blocks = words_.size() / kBlockWords;
+    s21::vector<std::uint64_t> index(blocks + 1U);
+    std::uint64_t *tree = index.data();
+    const std::uint64_t *words = words_.data();
+    std::uint64_t total = 0;
+    for (size_type block = 0; block < blocks; ++block) {
+      std::uint64_t ones = 0;
+      for (size_type i = 0; i < kBlockWords; ++i)
+        ones += detail::PopCount(words[block * kBlockWords + i]);
+      total += ones;
+      tree[block + 1U] += ones;
+      size_type parent = block + 1U + ((block + 1U) & (0U - (block + 1U)));
+      if (parent <= blocks) tree[parent] += tree[block + 1U];
+    }
+    index_.swap(index);
+    size_ = static_cast<size_type>(total);
+  }
+
+  struct DenseIntSetIterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = dense_int_set::value_type;
+    using reference = dense_int_set::value_type;
+    using pointer = void;
+
+    DenseIntSetIterator() noexcept : owner_(nullptr), position_(0) {}
+
+    DenseIntSetIterator(const dense_int_set *owner,
+                        std::uint64_t position) noexcept
+        : owner_(owner), position_(position) {}
+
+    reference operator*() const noexcept {
+      return static_cast<value_type>(position_);
+    }
+
+    DenseIntSetIterator &operator++() noexcept {
+      position_ = owner_->FindFrom(position_ + 1U);
+      return *this;
+    }
+
+    DenseIntSetIterator operator++(int) noexcept {
+      DenseIntSetIterator tmp{*this};
+      ++(*this);
+      return tmp;
+    }
+
+    DenseIntSetIterator &operator--() noexcept {
+      position_ = owner_->FindBefore(position_ - 1U);
+      return *this;
+    }
+
+    DenseIntSetIterator operator--(int) noexcept {
+      DenseIntSetIterator tmp{*this};
+      --(*this);
+      return tmp;
+    }
+
+    bool operator==(const DenseIntSetIterator &other) const noexcept {
+      return position_ == other.position_;
+    }
+
+    bool operator!=(const DenseIntSetIterator &other) const noexcept {
+      return position_ != other.position_;
+    }
+
+    const dense_int_set *owner_;
+    std::uint64_t position_;  // Значение элемента, kEnd - end().
+  };
+
+  s21::vector<std::uint64_t> words_;  // Бит x - признак элемента x.
+  s21::vector<std::uint64_t> index_;  // Дерево Фенвика, index_[0] не исп.
+  size_type size_ = 0;
+};
+
+}  // namespace s21
+
+#endif
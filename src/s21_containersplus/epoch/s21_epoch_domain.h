@@ -0,0 +1,370 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_EPOCH_S21_EPOCH_DOMAIN_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_EPOCH_S21_EPOCH_DOMAIN_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace s21 {
+
+/**
+ * @brief Отложенное освобождение памяти по эпохам (epoch-based
+ * reclamation) для контейнеров, которые читаются без блокировок.
+ *
+ * @details Поток, читающий разделяемую структуру, держит guard ("закреплен"
+ * в текущей глобальной эпохе). Узел, исключенный из структуры, не
+ * удаляется сразу, а передается в retire() вместе с номером текущей эпохи.
+ * Эпоха увеличивается, только когда все закрепленные потоки уже видели
+ * текущую, поэтому после двух увеличений ни один читатель не может держать
+ * указатель на такой узел, и его можно удалить.
+ *
+ * Узлы копятся в списке потока, вызвавшего retire(), и удаляются пачками:
+ * раз в kReclaimBatch вызовов поток пытается продвинуть эпоху и удаляет
+ * все, что стало безопасным. Закрепление - атомарная запись и барьер,
+ * открепление - одна запись, без операций чтение-изменение-запись на общих
+ * данных.
+ *
+ * Записи потоков переиспользуются: при завершении потока его запись
+ * освобождается, а неудаленные узлы достаются следующему потоку.
+ *
+ * Все контейнеры библиотеки, которым нужно отложенное освобождение,
+ * используют общий домен global().
+ */
+class epoch_domain {
+ private:
+  struct Record;
+
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * @brief Закрепляет текущий поток в домене на время своего существования.
+   *
+   * @details Пока guard жив, объекты, прочитанные из структур домена, не
+   * будут удалены. Охраны могут быть вложенными. guard нельзя передавать
+   * в другой поток.
+   */
+  class guard {
+   public:
+    explicit guard(epoch_domain &domain = epoch_domain::global())
+        : domain_(&domain), record_(&domain.LocalRecord()) {
+      domain_->Pin(*record_);
+    }
+
+    guard(const guard &) = delete;
+    guard &operator=(const guard &) = delete;
+
+    guard(guard &&other) noexcept
+        : domain_(other.domain_), record_(other.record_) {
+      other.record_ = nullptr;
+    }
+
+    guard &operator=(guard &&) = delete;
+
+    ~guard() {
+      if (record_) domain_->Unpin(*record_);
+    }
+
+   private:
+    epoch_domain *domain_;
+    Record *record_;
+  };
+
+  epoch_domain() : epoch_(0), records_(nullptr), id_(NextId()) {
+    Registry &registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex_);
+    registry.live_.push_back(id_);
+  }
+
+  epoch_domain(const epoch_domain &) = delete;
+  epoch_domain &operator=(const epoch_domain &) = delete;
+
+  /**
+   * @brief Удаляет все отложенные объекты. Ни один поток не должен в этот
+   * момент держать guard этого домена.
+   */
+  ~epoch_domain() {
+    {
+      Registry &registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.mutex_);
+      registry.live_.erase(
+          std::find(registry.live_.begin(), registry.live_.end(), id_));
+    }
+    Record *record = records_.load(std::memory_order_acquire);
+    while (record) {
+      Record *next = record->next_;
+      for (Retired &item : record->retired_) item.Reclaim();
+      delete record;
+      record = next;
+    }
+  }
+
+  /**
+   * @brief Общий домен библиотеки.
+   */
+  static epoch_domain &global() {
+    static epoch_domain domain;
+    return domain;
+  }
+
+  /**
+   * @brief Откладывает удаление ptr (delete ptr), пока его могут читать
+   * закрепленные потоки. Объект уже должен быть недоступен для новых
+   * читателей.
+   */
+  template <class T>
+  void retire(T *ptr) {
+    retire(ptr, std::default_delete<T>());
+  }
+
+  /**
+   * @brief Откладывает вызов deleter(ptr), пока ptr могут читать
+   * закрепленные потоки.
+   *
+   * @details Если retire() бросает исключение, ptr остается за вызывающим:
+   * после того как ptr попал в список, исключений больше нет.
+   */
+  template <class T, class Deleter>
+  void retire(T *ptr, Deleter deleter) {
+    Record &record = LocalRecord();
+    // Очередная пачка удаляется до добавления ptr: новый объект удалить
+    // еще нельзя, а исключение из Collect() не должно его потерять
+    if (record.retired_.size() % kReclaimBatch == kReclaimBatch - 1)
+      Collect(record);
+    ReserveOneMore(record.retired_);
+    Retired item = MakeRetired(ptr, std::move(deleter));
+    // Исключение узла из структуры должно произойти раньше чтения эпохи
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    item.epoch_ = epoch_.load(std::memory_order_relaxed);
+    record.retired_.push_back(item);
+  }
+
+  /**
+   * @brief Готовит место в списке текущего потока, чтобы следующий
+   * retire_reserved() не бросал исключений.
+   */
+  void reserve_retire() { ReserveOneMore(LocalRecord().retired_); }
+
+  /**
+   * @brief retire() без исключений: откладывает delete ptr в место,
+   * подготовленное reserve_retire() в этом же потоке.
+   *
+   * @details Нужен, когда объект уже исключен из структуры и потерять его
+   * нельзя: сначала reserve_retire(), потом исключение из структуры, потом
+   * retire_reserved(). Пачку отложенного не удаляет.
+   */
+  template <class T>
+  void retire_reserved(T *ptr) noexcept {
+    Record &record = LocalRecord();
+    Retired item = MakeRetired(ptr, std::default_delete<T>());
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    item.epoch_ = epoch_.load(std::memory_order_relaxed);
+    record.retired_.push_back(item);
+  }
+
+  /**
+   * @brief Пытается продвинуть эпоху и удаляет ставшие безопасными объекты,
+   * отложенные текущим потоком.
+   */
+  void collect() { Collect(LocalRecord()); }
+
+  /**
+   * @brief Дожидается удаления всех объектов, отложенных текущим потоком.
+   *
+   * @throw std::logic_error если текущий поток держит guard (ожидание
+   * никогда бы не закончилось)
+   */
+  void synchronize() {
+    Record &record = LocalRecord();
+    if (record.nesting_ != 0)
+      throw std::logic_error(
+          "s21::epoch_domain::synchronize: called inside a guard");
+    while (true) {
+      Collect(record);
+      if (record.retired_.empty()) return;
+      std::this_thread::yield();
+    }
+  }
+
+  /**
+   * @brief Количество объектов, отложенных текущим потоком и еще не
+   * удаленных.
+   */
+  size_type pending() { return LocalRecord().retired_.size(); }
+
+  std::uint64_t epoch() const noexcept {
+    return epoch_.load(std::memory_order_relaxed);
+  }
+
+  // Раз в сколько вызовов retire() поток пытается удалить отложенное
+  static constexpr size_type kReclaimBatch = 64;
+
+ private:
+  // Отложенный объект: reclaim_(object_) удаляет его
+  struct Retired {
+    void Reclaim() const { reclaim_(object_); }
+
+    void *object_;
+    void (*reclaim_)(void *);
+    std::uint64_t epoch_;
+  };
+
+  // Запись потока. state_ - (эпоха << 1) | 1, пока поток закреплен, и 0
+  // иначе; остальные поля, кроме in_use_, меняет только владелец записи
+  struct alignas(64) Record {
+    std::atomic<std::uint64_t> state_{0};
+    std::atomic<bool> in_use_{true};
+    unsigned nesting_ = 0;
+    std::vector<Retired> retired_;  // В порядке неубывания эпохи.
+    Record *next_ = nullptr;        // Не меняется после публикации.
+  };
+
+  // Живые домены; нужен, чтобы завершающийся поток не обращался к
+  // записям уже удаленного домена
+  struct Registry {
+    std::mutex mutex_;
+    std::vector<std::uint64_t> live_;
+  };
+
+  // Записи, занятые текущим потоком: освобождаются при его завершении
+  struct ThreadRecords {
+    ~ThreadRecords() {
+      Registry &registry = GetRegistry();
+      std::lock_guard<std::mutex> lock(registry.mutex_);
+      for (const auto &entry : entries_) {
+        if (std::find(registry.live_.begin(), registry.live_.end(),
+                      entry.first) != registry.live_.end())
+          entry.second->in_use_.store(false, std::memory_order_release);
+      }
+    }
+
+    std::vector<std::pair<std::uint64_t, Record *>> entries_;
+  };
+
+  // Место под еще один элемент заранее, чтобы push_back после него не
+  // бросал исключений. Емкость растет геометрически: reserve(size() + 1)
+  // копировал бы весь список при каждом вызове
+  template <class Item>
+  static void ReserveOneMore(std::vector<Item> &items) {
+    if (items.size() == items.capacity()) items.reserve(2 * items.size() + 1);
+  }
+
+  template <class T, class Deleter>
+  static Retired MakeRetired(T *ptr, Deleter deleter) {
+    if constexpr (std::is_empty_v<Deleter> &&
+                  std::is_default_constructible_v<Deleter>) {
+      return Retired{
+          ptr, [](void *object) { Deleter()(static_cast<T *>(object)); },
+          0};
+    } else {
+      // Состояние удалителя храним рядом с указателем
+      using Holder = std::pair<T *, Deleter>;
+      Holder *holder = new Holder(ptr, std::move(deleter));
+      return Retired{holder,
+                     [](void *object) {
+                       std::unique_ptr<Holder> holder(
+                           static_cast<Holder *>(object));
+                       holder->second(holder->first);
+                     },
+                     0};
+    }
+  }
+
+  void Pin(Record &record) {
+    if (record.nesting_++ != 0) return;
+    std::uint64_t epoch = epoch_.load(std::memory_order_relaxed);
+    record.state_.store((epoch << 1U) | 1U, std::memory_order_relaxed);
+    // Барьер не дает чтениям указателей из структуры (даже acquire)
+    // выполниться раньше записи state_; парный барьер - в TryAdvance()
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+  }
+
+  void Unpin(Record &record) noexcept {
+    if (--record.nesting_ == 0)
+      record.state_.store(0, std::memory_order_release);
+  }
+
+  // Увеличивает эпоху, если все закрепленные потоки уже в текущей
+  bool TryAdvance() {
+    // Парный барьеру в Pin(): либо сканирование увидит закрепление, либо
+    // читатель увидит структуру уже без удаленных объектов
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    for (Record *record = records_.load(std::memory_order_acquire); record;
+         record = record->next_) {
+      std::uint64_t state = record->state_.load(std::memory_order_seq_cst);
+      if ((state & 1U) && (state >> 1U) != epoch) return false;
+    }
+    return epoch_.compare_exchange_strong(epoch, epoch + 1,
+                                          std::memory_order_seq_cst);
+  }
+
+  // Удаляет объекты, отложенные не меньше двух эпох назад
+  void Collect(Record &record) {
+    TryAdvance();
+    std::uint64_t epoch = epoch_.load(std::memory_order_acquire);
+    auto safe_end = std::find_if(
+        record.retired_.begin(), record.retired_.end(),
+        [epoch](const Retired &item) { return item.epoch_ + 2 > epoch; });
+    // Сначала исключаем из списка: удалитель может сам вызвать retire()
+    std::vector<Retired> ready(record.retired_.begin(), safe_end);
+    record.retired_.erase(record.retired_.begin(), safe_end);
+    for (const Retired &item : ready) item.Reclaim();
+  }
+
+  Record &LocalRecord() {
+    static thread_local ThreadRecords records;
+    for (const auto &entry : records.entries_)
+      if (entry.first == id_) return *entry.second;
+    ReserveOneMore(records.entries_);
+    Record *record = AcquireRecord();
+    records.entries_.emplace_back(id_, record);
+    return *record;
+  }
+
+  // Занимает свободную запись или добавляет новую в список
+  Record *AcquireRecord() {
+    for (Record *record = records_.load(std::memory_order_acquire); record;
+         record = record->next_) {
+      bool expected = false;
+      if (!record->in_use_.load(std::memory_order_relaxed) &&
+          record->in_use_.compare_exchange_strong(expected, true,
+                                                  std::memory_order_acquire,
+                                                  std::memory_order_relaxed))
+        return record;
+    }
+    Record *record = new Record;
+    Record *head = records_.load(std::memory_order_relaxed);
+    do {
+      record->next_ = head;
+    } while (!records_.compare_exchange_weak(head, record,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed));
+    return record;
+  }
+
+  static Registry &GetRegistry() {
+    static Registry registry;
+    return registry;
+  }
+
+  static std::uint64_t NextId() noexcept {
+    static std::atomic<std::uint64_t> next_id{0};
+    return next_id.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  std::atomic<std::uint64_t> epoch_;
+  std::atomic<Record *> records_;  // Список записей, только растет.
+  std::uint64_t id_;  // Уникальный номер (адрес домена может повториться).
+};
+
+}  // namespace s21
+
+#endif
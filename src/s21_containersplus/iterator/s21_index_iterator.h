@@ -0,0 +1,150 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_ITERATOR_S21_INDEX_ITERATOR_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_ITERATOR_S21_INDEX_ITERATOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace s21 {
+namespace detail {
+
+/**
+ * @brief Итератор произвольного доступа по индексу элемента: хранит
+ * указатель на контейнер и номер позиции, а элемент получает через
+ * operator[] контейнера.
+ *
+ * @details Подходит контейнерам, у которых элементы не лежат одним
+ * массивом (soa_vector, segmented_vector). Сравнение и разность итераторов
+ * используют только индексы; iterator неявно приводится к const_iterator.
+ * operator-> есть, только если operator[] возвращает настоящую ссылку, а не
+ * прокси-объект.
+ *
+ * @tparam Container Тип контейнера
+ * @tparam Const true для const_iterator
+ */
+template <class Container, bool Const>
+struct index_iterator {
+  using owner_type = std::conditional_t<Const, const Container, Container>;
+  using size_type = typename Container::size_type;
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = typename Container::value_type;
+  using reference =
+      std::conditional_t<Const, typename Container::const_reference,
+                         typename Container::reference>;
+  using pointer =
+      std::conditional_t<std::is_reference_v<reference>,
+                         std::add_pointer_t<reference>, void>;
+
+  index_iterator() noexcept : owner_(nullptr), index_(0) {}
+
+  index_iterator(owner_type *owner, size_type index) noexcept
+      : owner_(owner), index_(index) {}
+
+  // iterator неявно приводится к const_iterator
+  template <bool WasConst, class = std::enable_if_t<Const && !WasConst>>
+  index_iterator(const index_iterator<Container, WasConst> &other) noexcept
+      : owner_(other.owner_), index_(other.index_) {}
+
+  reference operator*() const noexcept { return (*owner_)[index_]; }
+
+  template <class P = pointer, class = std::enable_if_t<!std::is_void_v<P>>>
+  P operator->() const noexcept {
+    return std::addressof((*owner_)[index_]);
+  }
+
+  reference operator[](difference_type n) const noexcept {
+    return (*owner_)[index_ + n];
+  }
+
+  index_iterator &operator++() noexcept {
+    ++index_;
+    return *this;
+  }
+
+  index_iterator operator++(int) noexcept {
+    index_iterator tmp{*this};
+    ++index_;
+    return tmp;
+  }
+
+  index_iterator &operator--() noexcept {
+    --index_;
+    return *this;
+  }
+
+  index_iterator operator--(int) noexcept {
+    index_iterator tmp{*this};
+    --index_;
+    return tmp;
+  }
+
+  index_iterator &operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+  }
+
+  index_iterator &operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+  }
+
+  index_iterator operator+(difference_type n) const noexcept {
+    return index_iterator(owner_, index_ + n);
+  }
+
+  index_iterator operator-(difference_type n) const noexcept {
+    return index_iterator(owner_, index_ - n);
+  }
+
+  friend index_iterator operator+(difference_type n,
+                                  const index_iterator &it) noexcept {
+    return it + n;
+  }
+
+  // Дружественные функции, чтобы сравнивать iterator с const_iterator
+  friend difference_type operator-(const index_iterator &lhs,
+                                   const index_iterator &rhs) noexcept {
+    return static_cast<difference_type>(lhs.index_) -
+           static_cast<difference_type>(rhs.index_);
+  }
+
+  friend bool operator==(const index_iterator &lhs,
+                         const index_iterator &rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+  }
+
+  friend bool operator!=(const index_iterator &lhs,
+                         const index_iterator &rhs) noexcept {
+    return lhs.index_ != rhs.index_;
+  }
+
+  friend bool operator<(const index_iterator &lhs,
+                        const index_iterator &rhs) noexcept {
+    return lhs.index_ < rhs.index_;
+  }
+
+  friend bool operator>(const index_iterator &lhs,
+                        const index_iterator &rhs) noexcept {
+    return lhs.index_ > rhs.index_;
+  }
+
+  friend bool operator<=(const index_iterator &lhs,
+                         const index_iterator &rhs) noexcept {
+    return lhs.index_ <= rhs.index_;
+  }
+
+  friend bool operator>=(const index_iterator &lhs,
+                         const index_iterator &rhs) noexcept {
+    return lhs.index_ >= rhs.index_;
+  }
+
+  owner_type *owner_;
+  size_type index_;
+};
+
+}  // namespace detail
+}  // namespace s21
+
+#endif
@@ -5,14 +5,24 @@
 
 namespace s21 {
 
-template <class Key>
+/**
+ * @brief Множество с повторяющимися ключами на красно-черном дереве.
+ *
+ * @tparam Key Тип элементов
+ * @tparam Compare Функция сравнения ключей
+ * @tparam Storage Политика хранения дерева (см. s21_storage_policy.h)
+ */
+template <class Key, class Compare = std::less<Key>,
+          class Storage = tree_policy<>>
 class multiset {
  public:
   using key_type = Key;
   using value_type = key_type;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using tree_type = RedBlackTree<value_type>;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using tree_type = RedBlackTree<value_type, key_compare, Storage>;
   using iterator = typename tree_type::iterator;
   using const_iterator = typename tree_type::const_iterator;
   using size_type = std::size_t;
@@ -23,6 +33,13 @@ class multiset {
    */
   multiset() : tree_(new tree_type{}){};
 
+  /**
+   * @brief Создает пустой multiset с заданной функцией сравнения.
+   *
+   * @param comp Функция сравнения ключей
+   */
+  explicit multiset(const key_compare &comp) : tree_(new tree_type(comp)) {}
+
   /**
    * @brief Конструктор с инициализатором списка.
    * Создает multiset и заполняет его элементами из инициализатора списка.
@@ -34,6 +51,22 @@ class multiset {
     for (auto item : items) insert(item);
   }
 
+  /**
+   * @brief Конструктор из диапазона с политикой выполнения.
+   * Элементы устойчиво сортируются (при s21::execution::par - параллельно),
+   * и сбалансированное дерево строится за линейное время. Равные элементы
+   * идут в порядке диапазона, как при последовательных insert().
+   *
+   * @param policy Политика выполнения (s21::execution::seq или par).
+   * @param first, last Диапазон элементов.
+   */
+  template <typename Policy, typename InputIt,
+            typename =
+                std::enable_if_t<execution::is_execution_policy_v<Policy>>>
+  multiset(Policy &&policy, InputIt first, InputIt last) : multiset() {
+    tree_->Build(policy, first, last, false);
+  }
+
   /**
    * @brief Конструктор копирования.
    * Создает новый multiset как копию существующего.
@@ -146,6 +179,16 @@ class multiset {
    */
   size_type max_size() const noexcept { return tree_->MaxSize(); }
 
+  /**
+   * @brief Функция сравнения ключей.
+   */
+  key_compare key_comp() const { return tree_->KeyComp(); }
+
+  /**
+   * @brief Функция сравнения элементов (для multiset совпадает с key_comp()).
+   */
+  value_compare value_comp() const { return tree_->KeyComp(); }
+
  public:
   /**
    * @brief Очищает дерево, удаляя все элементы.
@@ -166,6 +209,22 @@ class multiset {
    */
   iterator insert(const value_type &value) { return tree_->Insert(value); }
 
+  /**
+   * @brief Вставляет пакет элементов в дерево.
+   *
+   * Пакет сортируется и вставляется за один проход по дереву: поиск места
+   * каждого следующего элемента начинается от предыдущего вставленного, а не
+   * от корня. Равные элементы, как и при insert(), встают после уже
+   * имеющихся.
+   *
+   * @param first, last Диапазон вставляемых элементов.
+   * @return Количество вставленных элементов.
+   */
+  template <typename InputIt>
+  size_type insert_batch(InputIt first, InputIt last) {
+    return tree_->InsertBatch(first, last, false);
+  }
+
   /**
    * @brief Удаляет элемент из дерева.
    *
@@ -197,6 +256,26 @@ class multiset {
    */
   void merge(multiset &other) noexcept { tree_->Merge(*other.tree_); }
 
+  /**
+   * @brief Сливает в дерево сразу несколько multiset (k-way слияние).
+   *
+   * Узлы переходят из [first, last) в текущее дерево без перевыделения,
+   * источники становятся пустыми. Работает за O(n log k) вместо k вызовов
+   * merge() и при s21::execution::par выполняется параллельно. Равные
+   * элементы идут в порядке: текущее дерево, затем источники по порядку.
+   *
+   * @param policy Политика выполнения (s21::execution::seq или par).
+   * @param first, last Диапазон деревьев-источников.
+   */
+  template <typename Policy, typename ForwardIt,
+            typename =
+                std::enable_if_t<execution::is_execution_policy_v<Policy>>>
+  void merge_all(Policy &&policy, ForwardIt first, ForwardIt last) {
+    std::vector<tree_type *> sources;
+    for (; first != last; ++first) sources.push_back((*first).tree_);
+    tree_->MergeAll(policy, sources, false);
+  }
+
  public:
   /**
    * @brief Возвращает количество элементов с заданным ключом.
@@ -210,11 +289,12 @@ class multiset {
    */
   size_type count(const key_type &key) const {
     auto lower_iterator = lower_bound(key);
-    if (*lower_iterator != key) return 0;
-
     auto end_iterator = end();
+    const key_compare &comp = tree_->KeyComp();
     size_type result_count = 0;
-    while (lower_iterator != end_iterator && *lower_iterator == key) {
+    // Элементы, начиная с lower_bound, не меньше key; эквивалентны ему те,
+    // что и не больше
+    while (lower_iterator != end_iterator && !comp(key, *lower_iterator)) {
       ++result_count;
       ++lower_iterator;
     }
@@ -266,6 +346,38 @@ class multiset {
     return tree_->Find(key) != tree_->End();
   }
 
+  /**
+   * @brief Пакетный поиск ключей.
+   *
+   * Для каждого ключа из [keys_first, keys_last) записывает в out итератор,
+   * который вернул бы find(). Поиски идут группами с чередованием спусков и
+   * упреждающей загрузкой узлов, поэтому на больших деревьях это заметно
+   * быстрее цикла из find().
+   *
+   * @param keys_first, keys_last Диапазон искомых ключей (forward-итераторы).
+   * @param out Итератор вывода для результатов.
+   * @return Итератор вывода за последним записанным результатом.
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt keys_first, ForwardIt keys_last, OutputIt out) {
+    return tree_->FindMany(keys_first, keys_last, out);
+  }
+
+  /**
+   * @brief Пакетная проверка наличия ключей.
+   *
+   * Аналог find_many(), записывающий в out значения bool.
+   *
+   * @param keys_first, keys_last Диапазон проверяемых ключей.
+   * @param out Итератор вывода для результатов.
+   * @return Итератор вывода за последним записанным результатом.
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt keys_first, ForwardIt keys_last,
+                         OutputIt out) const {
+    return tree_->ContainsMany(keys_first, keys_last, out);
+  }
+
   /**
    * @brief Возвращает пару итераторов, указывающих на начало и конец диапазона
    * элементов с заданным ключом.
@@ -0,0 +1,1318 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_RADIX_MAP_S21_RADIX_MAP_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_RADIX_MAP_S21_RADIX_MAP_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+
+/**
+ * @brief Представление ключа radix_map в виде строки байтов.
+ *
+ * @details encode() возвращает объект с data() и size(). Лексикографический
+ * порядок байтов (без знака) должен совпадать с нужным порядком ключей, а
+ * представление, полученное из ключа элемента, должно жить, пока жив
+ * элемент. Для своих типов ключей достаточно специализировать этот шаблон.
+ */
+template <class Key, class = void>
+struct radix_key_traits;
+
+// Целые числа: байты от старшего к младшему; у знаковых инвертирован
+// знаковый бит, чтобы отрицательные числа шли раньше положительных
+template <class Key>
+struct radix_key_traits<Key, std::enable_if_t<std::is_integral_v<Key> &&
+                                              !std::is_same_v<Key, bool>>> {
+  using encoded_type = std::array<unsigned char, sizeof(Key)>;
+
+  static encoded_type encode(Key key) noexcept {
+    using Unsigned = std::make_unsigned_t<Key>;
+    Unsigned value = static_cast<Unsigned>(key);
+    if constexpr (std::is_signed_v<Key>) {
+      value = static_cast<Unsigned>(value ^
+                                    (Unsigned(1) << (sizeof(Key) * 8U - 1U)));
+    }
+    encoded_type bytes{};
+    for (std::size_t i = sizeof(Key); i-- > 0;) {
+      bytes[i] = static_cast<unsigned char>(value & 0xFFU);
+      value = static_cast<Unsigned>(value >> 8U);
+    }
+    return bytes;
+  }
+};
+
+// Строки: сами байты строки (std::string сравнивает их как unsigned char)
+template <class Alloc>
+struct radix_key_traits<std::basic_string<char, std::char_traits<char>, Alloc>,
+                        void> {
+  using string_type = std::basic_string<char, std::char_traits<char>, Alloc>;
+  using encoded_type = std::string_view;
+
+  static encoded_type encode(const string_type &key) noexcept {
+    return encoded_type(key.data(), key.size());
+  }
+};
+
+/**
+ * @brief Упорядоченный словарь на адаптивном префиксном дереве (Adaptive
+ * Radix Tree) для строковых и целочисленных ключей.
+ *
+ * @details Ключ рассматривается как строка байтов (см. radix_key_traits), и
+ * каждый уровень дерева разбирает один байт. Поиск не сравнивает ключи
+ * целиком на каждом уровне, как красно-черное дерево, поэтому время поиска
+ * зависит от длины ключа, а не от числа элементов. Это особенно заметно на
+ * ключах с длинными общими префиксами (таблицы маршрутов, URL).
+ *
+ * Внутренние узлы бывают четырех размеров (4, 16, 48 и 256 потомков) и
+ * меняют размер по мере вставки и удаления. В Node16 байт ищется одной
+ * SIMD-инструкцией сравнения (SSE2), если она доступна. Цепочки узлов с
+ * одним потомком сжимаются в префикс узла: в узле хранятся первые
+ * kMaxPrefix байтов префикса и его длина, остальные байты при поиске
+ * сверяются по ключу листа.
+ *
+ * Элементы (листья) дополнительно связаны в двусвязный список в порядке
+ * ключей: итераторы двунаправленные, переход к соседнему элементу - O(1),
+ * а вставка и удаление не делают итераторы на другие элементы
+ * недействительными.
+ *
+ * @tparam Key Тип ключа
+ * @tparam T Тип значения
+ * @tparam KeyTraits Преобразование ключа в байты
+ */
+template <class Key, class T, class KeyTraits = radix_key_traits<Key>>
+class radix_map {
+ private:
+  struct LeafLinks;
+  struct Leaf;
+  template <bool IsConst>
+  struct RadixMapIterator;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = RadixMapIterator<false>;
+  using const_iterator = RadixMapIterator<true>;
+  using size_type = std::size_t;
+  using key_traits = KeyTraits;
+
+  radix_map() noexcept : root_(nullptr), head_{&head_, &head_}, size_(0U) {}
+
+  radix_map(std::initializer_list<value_type> const &items) : radix_map() {
+    for (const value_type &item : items) insert(item);
+  }
+
+  radix_map(const radix_map &other) : radix_map() {
+    for (const value_type &item : other) insert(item);
+  }
+
+  radix_map(radix_map &&other) noexcept : radix_map() { swap(other); }
+
+  radix_map &operator=(const radix_map &other) {
+    if (this != &other) {
+      radix_map tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  radix_map &operator=(radix_map &&other) noexcept {
+    if (this != &other) {
+      radix_map tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ~radix_map() { clear(); }
+
+ public:
+  /**
+   * @brief Доступ к значению по ключу с проверкой наличия ключа.
+   *
+   * @throw std::out_of_range если ключа нет
+   */
+  mapped_type &at(const key_type &key) {
+    auto encoded = key_traits::encode(key);
+    Leaf *leaf = FindLeaf(ToBytes(encoded));
+    if (leaf == nullptr)
+      throw std::out_of_range(
+          "s21::radix_map::at: No element exists with key equivalent to key");
+    return leaf->value_.second;
+  }
+
+  const mapped_type &at(const key_type &key) const {
+    return const_cast<radix_map *>(this)->at(key);
+  }
+
+  /**
+   * @brief Значение по ключу; если ключа нет, вставляет
+   * value_type(key, mapped_type{}). Дерево проходится один раз.
+   */
+  mapped_type &operator[](const key_type &key) {
+    return (*InsertLeaf(key, [&key] { return new Leaf(key, mapped_type()); })
+                 .first)
+        .second;
+  }
+
+  iterator begin() noexcept { return iterator(head_.next_); }
+
+  const_iterator begin() const noexcept { return const_iterator(head_.next_); }
+
+  iterator end() noexcept { return iterator(&head_); }
+
+  const_iterator end() const noexcept { return const_iterator(&head_); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(Leaf);
+  }
+
+  void clear() noexcept {
+    DeleteInnerNodes(root_);
+    root_ = nullptr;
+    LeafLinks *link = head_.next_;
+    while (link != &head_) {
+      LeafLinks *next = link->next_;
+      delete static_cast<Leaf *>(link);
+      link = next;
+    }
+    head_.prev_ = head_.next_ = &head_;
+    size_ = 0;
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return InsertLeaf(value.first, [&value] { return new Leaf(value); });
+  }
+
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return InsertLeaf(key, [&key, &obj] { return new Leaf(key, obj); });
+  }
+
+  /**
+   * @brief Вставляет value_type(key, obj) или присваивает obj значению
+   * существующего элемента. Дерево проходится один раз.
+   */
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    std::pair<iterator, bool> result =
+        InsertLeaf(key, [&key, &obj] { return new Leaf(key, obj); });
+    if (!result.second) (*result.first).second = obj;
+    return result;
+  }
+
+  /**
+   * @brief Вставляет пакет элементов [first, last), как insert() для
+   * каждого.
+   *
+   * @return size_type Количество вставленных элементов
+   */
+  template <typename InputIt>
+  size_type insert_batch(InputIt first, InputIt last) {
+    size_type inserted = 0;
+    for (; first != last; ++first) inserted += insert(*first).second;
+    return inserted;
+  }
+
+  /**
+   * @brief Пакетный insert_or_assign(): из одинаковых ключей внутри пакета
+   * побеждает последний.
+   *
+   * @return size_type Количество вставленных (новых) элементов
+   */
+  template <typename InputIt>
+  size_type insert_or_assign_batch(InputIt first, InputIt last) {
+    size_type inserted = 0;
+    for (; first != last; ++first)
+      inserted += insert_or_assign((*first).first, (*first).second).second;
+    return inserted;
+  }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    std::vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(args));
+    (result.push_back(insert(std::forward<Args>(args))), ...);
+    return result;
+  }
+
+  void erase(iterator pos) noexcept {
+    Leaf *leaf = static_cast<Leaf *>(pos.node_);
+    Extract(leaf);
+    delete leaf;
+  }
+
+  size_type erase(const key_type &key) {
+    iterator pos = find(key);
+    if (pos == end()) return 0;
+    erase(pos);
+    return 1;
+  }
+
+  void swap(radix_map &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    std::swap(head_, other.head_);
+    AdoptList(head_, other.head_);
+    AdoptList(other.head_, head_);
+  }
+
+  /**
+   * @brief Переносит из other элементы с ключами, которых нет в *this. Листья
+   * не копируются, итераторы на перенесенные элементы остаются
+   * действительными.
+   */
+  void merge(radix_map &other) {
+    if (this == &other) return;
+    LeafLinks *link = other.head_.next_;
+    while (link != &other.head_) {
+      Leaf *leaf = static_cast<Leaf *>(link);
+      link = link->next_;
+      InsertLeaf(leaf->value_.first, [&other, leaf] {
+        other.Extract(leaf);
+        return leaf;
+      });
+    }
+  }
+
+ public:
+  iterator find(const key_type &key) {
+    auto encoded = key_traits::encode(key);
+    return iterator(Position(FindLeaf(ToBytes(encoded))));
+  }
+
+  const_iterator find(const key_type &key) const {
+    auto encoded = key_traits::encode(key);
+    return const_iterator(Position(FindLeaf(ToBytes(encoded))));
+  }
+
+  bool contains(const key_type &key) const noexcept {
+    auto encoded = key_traits::encode(key);
+    return FindLeaf(ToBytes(encoded)) != nullptr;
+  }
+
+  size_type count(const key_type &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+
+  iterator lower_bound(const key_type &key) {
+    auto encoded = key_traits::encode(key);
+    return iterator(LowerBound(ToBytes(encoded)));
+  }
+
+  const_iterator lower_bound(const key_type &key) const {
+    auto encoded = key_traits::encode(key);
+    return const_iterator(LowerBound(ToBytes(encoded)));
+  }
+
+  iterator upper_bound(const key_type &key) {
+    auto encoded = key_traits::encode(key);
+    return iterator(UpperBound(ToBytes(encoded)));
+  }
+
+  const_iterator upper_bound(const key_type &key) const {
+    auto encoded = key_traits::encode(key);
+    return const_iterator(UpperBound(ToBytes(encoded)));
+  }
+
+  /**
+   * @brief Диапазон элементов, ключи которых начинаются с prefix (для
+   * строковых ключей). Находится одним спуском до поддерева префикса, без
+   * перебора элементов.
+   *
+   * @return Пара итераторов [first, last); если таких элементов нет, оба
+   * итератора равны lower_bound(prefix)
+   */
+  std::pair<iterator, iterator> prefix_range(const key_type &prefix) {
+    auto encoded = key_traits::encode(prefix);
+    std::pair<LeafLinks *, LeafLinks *> range = PrefixRange(ToBytes(encoded));
+    return {iterator(range.first), iterator(range.second)};
+  }
+
+  std::pair<const_iterator, const_iterator> prefix_range(
+      const key_type &prefix) const {
+    auto encoded = key_traits::encode(prefix);
+    std::pair<LeafLinks *, LeafLinks *> range = PrefixRange(ToBytes(encoded));
+    return {const_iterator(range.first), const_iterator(range.second)};
+  }
+
+  /**
+   * @brief Пакетный поиск: для каждого ключа из [keys_first, keys_last)
+   * записывает в out итератор на элемент с этим ключом или end().
+   */
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt find_many(ForwardIt keys_first, ForwardIt keys_last, OutputIt out) {
+    for (; keys_first != keys_last; ++keys_first) *out++ = find(*keys_first);
+    return out;
+  }
+
+  template <typename ForwardIt, typename OutputIt>
+  OutputIt contains_many(ForwardIt keys_first, ForwardIt keys_last,
+                         OutputIt out) const {
+    for (; keys_first != keys_last; ++keys_first)
+      *out++ = contains(*keys_first);
+    return out;
+  }
+
+ private:
+  // Сколько байтов сжатого префикса хранится в самом узле
+  static constexpr size_type kMaxPrefix = 8U;
+
+  enum class NodeKind : unsigned char {
+    kLeaf,
+    kNode4,
+    kNode16,
+    kNode48,
+    kNode256
+  };
+
+  struct NodeBase {
+    NodeKind kind_;
+  };
+
+  struct LeafLinks {
+    LeafLinks *prev_;
+    LeafLinks *next_;
+  };
+
+  struct Leaf : NodeBase, LeafLinks {
+    template <class... Args>
+    explicit Leaf(Args &&...args)
+        : NodeBase{NodeKind::kLeaf},
+          LeafLinks{nullptr, nullptr},
+          value_(std::forward<Args>(args)...) {}
+
+    value_type value_;
+  };
+
+  // Общая часть внутренних узлов. Узел на глубине depth покрывает байты
+  // ключа [depth, depth + prefix_len_) своим префиксом, потомки различаются
+  // байтом depth + prefix_len_. Ключ, который заканчивается ровно на
+  // префиксе, хранится в terminal_ и меньше всех ключей потомков.
+  struct Inner : NodeBase {
+    std::uint16_t count_;  // Число потомков (без terminal_).
+    std::uint32_t prefix_len_;
+    unsigned char prefix_[kMaxPrefix];
+    Leaf *terminal_;
+  };
+
+  // Ключи потомков Node4 и Node16 хранятся по возрастанию
+  struct Node4 : Inner {
+    static constexpr NodeKind kKind = NodeKind::kNode4;
+    unsigned char keys_[4];
+    NodeBase *children_[4];
+  };
+
+  struct Node16 : Inner {
+    static constexpr NodeKind kKind = NodeKind::kNode16;
+    unsigned char keys_[16];
+    NodeBase *children_[16];
+  };
+
+  struct Node48 : Inner {
+    static constexpr NodeKind kKind = NodeKind::kNode48;
+    unsigned char index_[256];  // Номер потомка + 1, 0 - потомка нет.
+    NodeBase *children_[48];
+  };
+
+  struct Node256 : Inner {
+    static constexpr NodeKind kKind = NodeKind::kNode256;
+    NodeBase *children_[256];
+  };
+
+  // Байты ключа
+  struct KeyBytes {
+    const unsigned char *data_;
+    size_type size_;
+  };
+
+  struct InsertResult {
+    Leaf *leaf_;
+    bool inserted_;
+    // Следующий за вставленным лист; nullptr, пока не найден на пути вверх
+    LeafLinks *next_;
+  };
+
+  template <class Encoded>
+  static KeyBytes ToBytes(const Encoded &encoded) noexcept {
+    return {reinterpret_cast<const unsigned char *>(encoded.data()),
+            static_cast<size_type>(encoded.size())};
+  }
+
+  LeafLinks *Position(Leaf *leaf) const noexcept {
+    if (leaf != nullptr) return leaf;
+    return const_cast<LeafLinks *>(&head_);
+  }
+
+  // Сравнивает ключи, начиная с байта depth (предыдущие байты совпадают)
+  static int CompareFrom(KeyBytes lhs, KeyBytes rhs, size_type depth) noexcept {
+    size_type limit = std::min(lhs.size_, rhs.size_);
+    if (depth < limit) {
+      int order =
+          std::memcmp(lhs.data_ + depth, rhs.data_ + depth, limit - depth);
+      if (order != 0) return order;
+    }
+    if (lhs.size_ == rhs.size_) return 0;
+    return lhs.size_ < rhs.size_ ? -1 : 1;
+  }
+
+  static bool Equal(const Leaf *leaf, KeyBytes key) noexcept {
+    auto encoded = key_traits::encode(leaf->value_.first);
+    KeyBytes bytes = ToBytes(encoded);
+    return bytes.size_ == key.size_ &&
+           std::memcmp(bytes.data_, key.data_, key.size_) == 0;
+  }
+
+  /**
+   * @brief Вызывает fn(байты префикса узла). Префикс длиннее kMaxPrefix
+   * хранится в узле не целиком, тогда байты берутся из ключа любого листа
+   * поддерева (все они проходят через этот префикс).
+   */
+  template <class F>
+  static auto WithPrefix(const Inner *node, size_type depth, F &&fn) {
+    if (node->prefix_len_ <= kMaxPrefix) return fn(node->prefix_);
+    auto encoded = key_traits::encode(MinLeaf(node)->value_.first);
+    return fn(ToBytes(encoded).data_ + depth);
+  }
+
+  /**
+   * @brief Сравнивает префикс узла с байтами ключа начиная с depth.
+   *
+   * @param matched Длина совпавшей части префикса
+   * @return 0, если ключ проходит через весь префикс; меньше 0, если ключ
+   * меньше всех ключей поддерева (закончился или меньше по байту); больше 0,
+   * если больше всех
+   */
+  static int ComparePrefix(const Inner *node, KeyBytes key, size_type depth,
+                           size_type &matched) {
+    return WithPrefix(node, depth, [&](const unsigned char *prefix) {
+      size_type length = node->prefix_len_;
+      size_type rest = key.size_ - depth;
+      size_type limit = std::min<size_type>(length, rest);
+      size_type i = 0;
+      while (i < limit && prefix[i] == key.data_[depth + i]) ++i;
+      matched = i;
+      if (i == length) return 0;
+      if (i == rest) return -1;
+      return key.data_[depth + i] < prefix[i] ? -1 : 1;
+    });
+  }
+
+  static void SetPrefix(Inner *node, const unsigned char *bytes,
+                        size_type length) noexcept {
+    node->prefix_len_ = static_cast<std::uint32_t>(length);
+    std::memcpy(node->prefix_, bytes, std::min(length, kMaxPrefix));
+  }
+
+  // Отрезает от префикса узла на глубине depth первые count байтов и
+  // возвращает последний из них: по нему узел ляжет в новый родитель
+  static unsigned char CutPrefix(Inner *node, size_type depth,
+                                 size_type count) {
+    size_type rest = node->prefix_len_ - count;
+    unsigned char byte = WithPrefix(node, depth, [&](const unsigned char *p) {
+      unsigned char last = p[count - 1];
+      std::memmove(node->prefix_, p + count, std::min(rest, kMaxPrefix));
+      return last;
+    });
+    node->prefix_len_ = static_cast<std::uint32_t>(rest);
+    return byte;
+  }
+
+  template <class NodeType>
+  static NodeType *NewInner() {
+    NodeType *node = new NodeType();
+    node->kind_ = NodeType::kKind;
+    return node;
+  }
+
+  static void DeleteInner(Inner *node) noexcept {
+    switch (node->kind_) {
+      case NodeKind::kNode4:
+        delete static_cast<Node4 *>(node);
+        break;
+      case NodeKind::kNode16:
+        delete static_cast<Node16 *>(node);
+        break;
+      case NodeKind::kNode48:
+        delete static_cast<Node48 *>(node);
+        break;
+      default:
+        delete static_cast<Node256 *>(node);
+        break;
+    }
+  }
+
+  // Удаляет внутренние узлы поддерева; листья удаляются по списку
+  static void DeleteInnerNodes(NodeBase *node) noexcept {
+    if (node == nullptr || node->kind_ == NodeKind::kLeaf) return;
+    Inner *inner = static_cast<Inner *>(node);
+    NodeBase **children = nullptr;
+    size_type capacity = 0;
+    switch (inner->kind_) {
+      case NodeKind::kNode4:
+        children = static_cast<Node4 *>(inner)->children_;
+        capacity = inner->count_;
+        break;
+      case NodeKind::kNode16:
+        children = static_cast<Node16 *>(inner)->children_;
+        capacity = inner->count_;
+        break;
+      case NodeKind::kNode48:
+        children = static_cast<Node48 *>(inner)->children_;
+        capacity = 48U;
+        break;
+      default:
+        children = static_cast<Node256 *>(inner)->children_;
+        capacity = 256U;
+        break;
+    }
+    for (size_type i = 0; i < capacity; ++i) DeleteInnerNodes(children[i]);
+    DeleteInner(inner);
+  }
+
+  static NodeBase *const *FindChild(const Inner *node,
+                                    unsigned char byte) noexcept {
+    switch (node->kind_) {
+      case NodeKind::kNode4: {
+        const Node4 *n = static_cast<const Node4 *>(node);
+        for (size_type i = 0; i < n->count_; ++i)
+          if (n->keys_[i] == byte) return &n->children_[i];
+        return nullptr;
+      }
+      case NodeKind::kNode16:
+        return FindChild16(static_cast<const Node16 *>(node), byte);
+      case NodeKind::kNode48: {
+        const Node48 *n = static_cast<const Node48 *>(node);
+        if (n->index_[byte] == 0) return nullptr;
+        return &n->children_[n->index_[byte] - 1U];
+      }
+      default: {
+        const Node256 *n = static_cast<const Node256 *>(node);
+        return n->children_[byte] != nullptr ? &n->children_[byte] : nullptr;
+      }
+    }
+  }
+
+  static NodeBase **FindChild(Inner *node, unsigned char byte) noexcept {
+    return const_cast<NodeBase **>(
+        FindChild(static_cast<const Inner *>(node), byte));
+  }
+
+  static NodeBase *const *FindChild16(const Node16 *node,
+                                      unsigned char byte) noexcept {
+#if defined(__SSE2__)
+    __m128i keys =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(node->keys_));
+    __m128i equal =
+        _mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte)));
+    unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(equal)) &
+                    ((1U << node->count_) - 1U);
+    if (mask == 0) return nullptr;
+    return &node->children_[__builtin_ctz(mask)];
+#else
+    for (size_type i = 0; i < node->count_; ++i)
+      if (node->keys_[i] == byte) return &node->children_[i];
+    return nullptr;
+#endif
+  }
+
+  // Потомок с наименьшим байтом, большим byte, или nullptr
+  static NodeBase *GreaterChild(const Inner *node,
+                                unsigned char byte) noexcept {
+    switch (node->kind_) {
+      case NodeKind::kNode4: {
+        const Node4 *n = static_cast<const Node4 *>(node);
+        for (size_type i = 0; i < n->count_; ++i)
+          if (n->keys_[i] > byte) return n->children_[i];
+        return nullptr;
+      }
+      case NodeKind::kNode16:
+        return GreaterChild16(static_cast<const Node16 *>(node), byte);
+      case NodeKind::kNode48: {
+        const Node48 *n = static_cast<const Node48 *>(node);
+        for (size_type b = byte + 1U; b < 256U; ++b)
+          if (n->index_[b] != 0) return n->children_[n->index_[b] - 1U];
+        return nullptr;
+      }
+      default: {
+        const Node256 *n = static_cast<const Node256 *>(node);
+        for (size_type b = byte + 1U; b < 256U; ++b)
+          if (n->children_[b] != nullptr) return n->children_[b];
+        return nullptr;
+      }
+    }
+  }
+
+  static NodeBase *GreaterChild16(const Node16 *node,
+                                  unsigned char byte) noexcept {
+#if defined(__SSE2__)
+    // Сравнение байтов без знака через знаковое: сдвигаем оба на 0x80
+    const __m128i bias = _mm_set1_epi8(-128);
+    __m128i keys = _mm_xor_si128(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(node->keys_)), bias);
+    __m128i probe =
+        _mm_xor_si128(_mm_set1_epi8(static_cast<char>(byte)), bias);
+    unsigned mask =
+        static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(keys, probe))) &
+        ((1U << node->count_) - 1U);
+    if (mask == 0) return nullptr;
+    return node->children_[__builtin_ctz(mask)];
+#else
+    for (size_type i = 0; i < node->count_; ++i)
+      if (node->keys_[i] > byte) return node->children_[i];
+    return nullptr;
+#endif
+  }
+
+  static NodeBase *FirstChild(const Inner *node) noexcept {
+    if (node->count_ == 0) return nullptr;
+    switch (node->kind_) {
+      case NodeKind::kNode4:
+        return static_cast<const Node4 *>(node)->children_[0];
+      case NodeKind::kNode16:
+        return static_cast<const Node16 *>(node)->children_[0];
+      default:
+        return GreaterOrEqualChild(node, 0U);
+    }
+  }
+
+  static NodeBase *LastChild(const Inner *node) noexcept {
+    if (node->count_ == 0) return nullptr;
+    switch (node->kind_) {
+      case NodeKind::kNode4:
+        return static_cast<const Node4 *>(node)->children_[node->count_ - 1U];
+      case NodeKind::kNode16:
+        return static_cast<const Node16 *>(node)->children_[node->count_ - 1U];
+      case NodeKind::kNode48: {
+        const Node48 *n = static_cast<const Node48 *>(node);
+        for (size_type b = 256U; b-- > 0;)
+          if (n->index_[b] != 0) return n->children_[n->index_[b] - 1U];
+        return nullptr;
+      }
+      default: {
+        const Node256 *n = static_cast<const Node256 *>(node);
+        for (size_type b = 256U; b-- > 0;)
+          if (n->children_[b] != nullptr) return n->children_[b];
+        return nullptr;
+      }
+    }
+  }
+
+  // Для Node48 и Node256: потомок с наименьшим байтом, не меньшим byte
+  static NodeBase *GreaterOrEqualChild(const Inner *node,
+                                       size_type byte) noexcept {
+    if (node->kind_ == NodeKind::kNode48) {
+      const Node48 *n = static_cast<const Node48 *>(node);
+      for (size_type b = byte; b < 256U; ++b)
+        if (n->index_[b] != 0) return n->children_[n->index_[b] - 1U];
+      return nullptr;
+    }
+    const Node256 *n = static_cast<const Node256 *>(node);
+    for (size_type b = byte; b < 256U; ++b)
+      if (n->children_[b] != nullptr) return n->children_[b];
+    return nullptr;
+  }
+
+  // Наименьший байт среди потомков непустого узла
+  static unsigned char FirstKey(const Inner *node) noexcept {
+    switch (node->kind_) {
+      case NodeKind::kNode4:
+        return static_cast<const Node4 *>(node)->keys_[0];
+      case NodeKind::kNode16:
+        return static_cast<const Node16 *>(node)->keys_[0];
+      case NodeKind::kNode48: {
+        const Node48 *n = static_cast<const Node48 *>(node);
+        size_type b = 0;
+        while (n->index_[b] == 0) ++b;
+        return static_cast<unsigned char>(b);
+      }
+      default: {
+        const Node256 *n = static_cast<const Node256 *>(node);
+        size_type b = 0;
+        while (n->children_[b] == nullptr) ++b;
+        return static_cast<unsigned char>(b);
+      }
+    }
+  }
+
+  static Leaf *MinLeaf(const NodeBase *node) noexcept {
+    while (node != nullptr && node->kind_ != NodeKind::kLeaf) {
+      const Inner *inner = static_cast<const Inner *>(node);
+      if (inner->terminal_ != nullptr) return inner->terminal_;
+      node = FirstChild(inner);
+    }
+    return static_cast<Leaf *>(const_cast<NodeBase *>(node));
+  }
+
+  static Leaf *MaxLeaf(const NodeBase *node) noexcept {
+    while (node->kind_ != NodeKind::kLeaf) {
+      const Inner *inner = static_cast<const Inner *>(node);
+      NodeBase *child = LastChild(inner);
+      if (child == nullptr) return inner->terminal_;
+      node = child;
+    }
+    return static_cast<Leaf *>(const_cast<NodeBase *>(node));
+  }
+
+  static bool IsFull(const Inner *node) noexcept {
+    switch (node->kind_) {
+      case NodeKind::kNode4:
+        return node->count_ == 4U;
+      case NodeKind::kNode16:
+        return node->count_ == 16U;
+      case NodeKind::kNode48:
+        return node->count_ == 48U;
+      default:
+        return false;
+    }
+  }
+
+  // Вставляет новый байт в упорядоченный массив ключей Node4/Node16
+  static void InsertSorted(unsigned char *keys, NodeBase **children,
+                           size_type count, unsigned char byte,
+                           NodeBase *child) noexcept {
+    size_type pos = 0;
+    while (pos < count && keys[pos] < byte) ++pos;
+    std::memmove(keys + pos + 1, keys + pos, count - pos);
+    std::memmove(children + pos + 1, children + pos,
+                 (count - pos) * sizeof(NodeBase *));
+    keys[pos] = byte;
+    children[pos] = child;
+  }
+
+  static void RemoveSorted(unsigned char *keys, NodeBase **children,
+                           size_type count, unsigned char byte) noexcept {
+    size_type pos = 0;
+    while (keys[pos] != byte) ++pos;
+    std::memmove(keys + pos, keys + pos + 1, count - pos - 1);
+    std::memmove(children + pos, children + pos + 1,
+                 (count - pos - 1) * sizeof(NodeBase *));
+  }
+
+  // Добавляет потомка в неполный узел
+  static void AddChild(Inner *node, unsigned char byte,
+                       NodeBase *child) noexcept {
+    switch (node->kind_) {
+      case NodeKind::kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        InsertSorted(n->keys_, n->children_, n->count_, byte, child);
+        break;
+      }
+      case NodeKind::kNode16: {
+        Node16 *n = static_cast<Node16 *>(node);
+        InsertSorted(n->keys_, n->children_, n->count_, byte, child);
+        break;
+      }
+      case NodeKind::kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        size_type slot = 0;
+        while (n->children_[slot] != nullptr) ++slot;
+        n->children_[slot] = child;
+        n->index_[byte] = static_cast<unsigned char>(slot + 1U);
+        break;
+      }
+      default:
+        static_cast<Node256 *>(node)->children_[byte] = child;
+        break;
+    }
+    ++node->count_;
+  }
+
+  static void RemoveChild(Inner *node, unsigned char byte) noexcept {
+    switch (node->kind_) {
+      case NodeKind::kNode4: {
+        Node4 *n = static_cast<Node4 *>(node);
+        RemoveSorted(n->keys_, n->children_, n->count_, byte);
+        break;
+      }
+      case NodeKind::kNode16: {
+        Node16 *n = static_cast<Node16 *>(node);
+        RemoveSorted(n->keys_, n->children_, n->count_, byte);
+        break;
+      }
+      case NodeKind::kNode48: {
+        Node48 *n = static_cast<Node48 *>(node);
+        n->children_[n->index_[byte] - 1U] = nullptr;
+        n->index_[byte] = 0;
+        break;
+      }
+      default:
+        static_cast<Node256 *>(node)->children_[byte] = nullptr;
+        break;
+    }
+    --node->count_;
+  }
+
+  static void CopyHeader(Inner *to, const Inner *from) noexcept {
+    to->count_ = from->count_;
+    to->prefix_len_ = from->prefix_len_;
+    std::memcpy(to->prefix_, from->prefix_, kMaxPrefix);
+    to->terminal_ = from->terminal_;
+  }
+
+  // Переносит содержимое узла в узел следующего размера
+  static Inner *Grow(NodeBase *&slot) {
+    Inner *node = static_cast<Inner *>(slot);
+    Inner *grown = nullptr;
+    if (node->kind_ == NodeKind::kNode4) {
+      const Node4 *from = static_cast<const Node4 *>(node);
+      Node16 *to = NewInner<Node16>();
+      std::copy(from->keys_, from->keys_ + 4, to->keys_);
+      std::copy(from->children_, from->children_ + 4, to->children_);
+      grown = to;
+    } else if (node->kind_ == NodeKind::kNode16) {
+      const Node16 *from = static_cast<const Node16 *>(node);
+      Node48 *to = NewInner<Node48>();
+      for (size_type i = 0; i < 16U; ++i) {
+        to->children_[i] = from->children_[i];
+        to->index_[from->keys_[i]] = static_cast<unsigned char>(i + 1U);
+      }
+      grown = to;
+    } else {
+      const Node48 *from = static_cast<const Node48 *>(node);
+      Node256 *to = NewInner<Node256>();
+      for (size_type b = 0; b < 256U; ++b)
+        if (from->index_[b] != 0)
+          to->children_[b] = from->children_[from->index_[b] - 1U];
+      grown = to;
+    }
+    CopyHeader(grown, node);
+    DeleteInner(node);
+    slot = grown;
+    return grown;
+  }
+
+  // Переносит содержимое узла в узел меньшего размера. Пороги ниже порогов
+  // роста, чтобы чередование вставок и удалений не перестраивало узел
+  static void ShrinkKind(NodeBase *&slot) {
+    Inner *node = static_cast<Inner *>(slot);
+    Inner *shrunk = nullptr;
+    if (node->kind_ == NodeKind::kNode16 && node->count_ <= 3U) {
+      const Node16 *from = static_cast<const Node16 *>(node);
+      Node4 *to = NewInner<Node4>();
+      std::copy(from->keys_, from->keys_ + node->count_, to->keys_);
+      std::copy(from->children_, from->children_ + node->count_,
+                to->children_);
+      shrunk = to;
+    } else if (node->kind_ == NodeKind::kNode48 && node->count_ <= 12U) {
+      const Node48 *from = static_cast<const Node48 *>(node);
+      Node16 *to = NewInner<Node16>();
+      size_type i = 0;
+      for (size_type b = 0; b < 256U; ++b) {
+        if (from->index_[b] == 0) continue;
+        to->keys_[i] = static_cast<unsigned char>(b);
+        to->children_[i++] = from->children_[from->index_[b] - 1U];
+      }
+      shrunk = to;
+    } else if (node->kind_ == NodeKind::kNode256 && node->count_ <= 37U) {
+      const Node256 *from = static_cast<const Node256 *>(node);
+      Node48 *to = NewInner<Node48>();
+      size_type i = 0;
+      for (size_type b = 0; b < 256U; ++b) {
+        if (from->children_[b] == nullptr) continue;
+        to->children_[i] = from->children_[b];
+        to->index_[b] = static_cast<unsigned char>(++i);
+      }
+      shrunk = to;
+    } else {
+      return;
+    }
+    CopyHeader(shrunk, node);
+    DeleteInner(node);
+    slot = shrunk;
+  }
+
+  // Заменяет узел с единственным элементом этим элементом; префикс узла и
+  // байт потомка приписываются к префиксу потомка
+  static void Collapse(NodeBase *&slot) noexcept {
+    Inner *node = static_cast<Inner *>(slot);
+    if (node->count_ == 0) {
+      slot = node->terminal_;
+    } else {
+      NodeBase *child = FirstChild(node);
+      if (child->kind_ != NodeKind::kLeaf) {
+        Inner *inner = static_cast<Inner *>(child);
+        unsigned char byte = FirstKey(node);
+        unsigned char prefix[kMaxPrefix];
+        size_type stored = std::min<size_type>(node->prefix_len_, kMaxPrefix);
+        std::memcpy(prefix, node->prefix_, stored);
+        if (stored < kMaxPrefix) prefix[stored++] = byte;
+        std::memcpy(prefix + stored, inner->prefix_,
+                    std::min<size_type>(kMaxPrefix - stored,
+                                        inner->prefix_len_));
+        inner->prefix_len_ += node->prefix_len_ + 1U;
+        std::memcpy(inner->prefix_, prefix, kMaxPrefix);
+      }
+      slot = child;
+    }
+    DeleteInner(node);
+  }
+
+  // Восстанавливает инварианты узла после удаления потомка или terminal_
+  static void Shrink(NodeBase *&slot) noexcept {
+    Inner *node = static_cast<Inner *>(slot);
+    if (node->count_ + (node->terminal_ != nullptr ? 1U : 0U) == 1U) {
+      Collapse(slot);
+      return;
+    }
+    try {
+      ShrinkKind(slot);
+    } catch (const std::bad_alloc &) {
+      // Узел остается прежнего размера: он корректен, просто больше
+    }
+  }
+
+  static void Attach(Inner *node, KeyBytes key, size_type depth,
+                     Leaf *leaf) noexcept {
+    if (depth == key.size_) {
+      node->terminal_ = leaf;
+    } else {
+      AddChild(node, key.data_[depth], leaf);
+    }
+  }
+
+  // Новый лист создается после выделения узлов, чтобы при нехватке памяти
+  // не потерять уже созданный (или перенесенный из другого словаря) лист
+  template <class Make>
+  static Leaf *MakeOrFree(Node4 *node, Make &make) {
+    try {
+      return make();
+    } catch (...) {
+      delete node;
+      throw;
+    }
+  }
+
+  /**
+   * @brief Вставка листа в поддерево slot на глубине depth.
+   *
+   * @details Лист создается вызовом make() только если ключа еще нет. Место
+   * листа в списке (следующий лист) определяется на обратном пути
+   * рекурсии: это наименьший лист поддерева ближайшего большего соседа.
+   */
+  template <class Make>
+  static InsertResult InsertAt(NodeBase *&slot, KeyBytes key, size_type depth,
+                               Make &make) {
+    if (slot == nullptr) {
+      Leaf *leaf = make();
+      slot = leaf;
+      return {leaf, true, nullptr};
+    }
+    if (slot->kind_ == NodeKind::kLeaf)
+      return SplitLeaf(slot, key, depth, make);
+    Inner *node = static_cast<Inner *>(slot);
+    size_type matched = 0;
+    int order = ComparePrefix(node, key, depth, matched);
+    if (order != 0) return SplitPrefix(slot, key, depth, matched, order, make);
+    depth += node->prefix_len_;
+    if (depth == key.size_) {
+      if (node->terminal_ != nullptr) return {node->terminal_, false, nullptr};
+      Leaf *leaf = make();
+      node->terminal_ = leaf;
+      return {leaf, true, MinLeaf(FirstChild(node))};
+    }
+    unsigned char byte = key.data_[depth];
+    NodeBase **child = FindChild(node, byte);
+    if (child != nullptr) {
+      InsertResult result = InsertAt(*child, key, depth + 1U, make);
+      if (result.inserted_ && result.next_ == nullptr)
+        result.next_ = MinLeaf(GreaterChild(node, byte));
+      return result;
+    }
+    if (IsFull(node)) node = Grow(slot);
+    Leaf *leaf = make();
+    AddChild(node, byte, leaf);
+    return {leaf, true, MinLeaf(GreaterChild(node, byte))};
+  }
+
+  // Ключ дошел до листа с другим ключом: оба листа уходят в новый Node4,
+  // префикс которого - их общая часть
+  template <class Make>
+  static InsertResult SplitLeaf(NodeBase *&slot, KeyBytes key, size_type depth,
+                                Make &make) {
+    Leaf *existing = static_cast<Leaf *>(slot);
+    auto encoded = key_traits::encode(existing->value_.first);
+    KeyBytes other = ToBytes(encoded);
+    size_type end = depth;
+    size_type limit = std::min(key.size_, other.size_);
+    while (end < limit && key.data_[end] == other.data_[end]) ++end;
+    if (end == key.size_ && end == other.size_)
+      return {existing, false, nullptr};
+    Node4 *node = NewInner<Node4>();
+    Leaf *leaf = MakeOrFree(node, make);
+    SetPrefix(node, key.data_ + depth, end - depth);
+    Attach(node, key, end, leaf);
+    Attach(node, other, end, existing);
+    slot = node;
+    bool less = end == key.size_ ||
+                (end != other.size_ && key.data_[end] < other.data_[end]);
+    return {leaf, true, less ? existing : nullptr};
+  }
+
+  // Ключ расходится с префиксом узла после matched байтов: над узлом
+  // появляется Node4 с совпавшей частью префикса
+  template <class Make>
+  static InsertResult SplitPrefix(NodeBase *&slot, KeyBytes key,
+                                  size_type depth, size_type matched,
+                                  int order, Make &make) {
+    Inner *old = static_cast<Inner *>(slot);
+    Node4 *node = NewInner<Node4>();
+    Leaf *leaf = MakeOrFree(node, make);
+    SetPrefix(node, key.data_ + depth, matched);
+    AddChild(node, CutPrefix(old, depth, matched + 1U), old);
+    Attach(node, key, depth + matched, leaf);
+    slot = node;
+    return {leaf, true, order < 0 ? MinLeaf(old) : nullptr};
+  }
+
+  template <class Make>
+  std::pair<iterator, bool> InsertLeaf(const key_type &key, Make make) {
+    auto encoded = key_traits::encode(key);
+    InsertResult result = InsertAt(root_, ToBytes(encoded), 0U, make);
+    if (result.inserted_) {
+      Link(result.leaf_, result.next_ != nullptr ? result.next_ : &head_);
+      ++size_;
+    }
+    return {iterator(result.leaf_), result.inserted_};
+  }
+
+  // Удаляет из поддерева лист с ключом key (он там есть)
+  static void RemoveAt(NodeBase *&slot, KeyBytes key,
+                       size_type depth) noexcept {
+    if (slot->kind_ == NodeKind::kLeaf) {
+      slot = nullptr;
+      return;
+    }
+    Inner *node = static_cast<Inner *>(slot);
+    depth += node->prefix_len_;
+    if (depth == key.size_) {
+      node->terminal_ = nullptr;
+    } else {
+      unsigned char byte = key.data_[depth];
+      NodeBase **child = FindChild(node, byte);
+      RemoveAt(*child, key, depth + 1U);
+      if (*child != nullptr) return;
+      RemoveChild(node, byte);
+    }
+    Shrink(slot);
+  }
+
+  // Убирает лист из дерева и списка, не удаляя его
+  void Extract(Leaf *leaf) noexcept {
+    auto encoded = key_traits::encode(leaf->value_.first);
+    RemoveAt(root_, ToBytes(encoded), 0U);
+    leaf->prev_->next_ = leaf->next_;
+    leaf->next_->prev_ = leaf->prev_;
+    --size_;
+  }
+
+  static void Link(Leaf *leaf, LeafLinks *next) noexcept {
+    leaf->next_ = next;
+    leaf->prev_ = next->prev_;
+    next->prev_->next_ = leaf;
+    next->prev_ = leaf;
+  }
+
+  // После обмена заголовками списков перенаправляет крайние листы на новый
+  // заголовок; пустой список (указывавший на previous) замыкается на себя
+  static void AdoptList(LeafLinks &head, LeafLinks &previous) noexcept {
+    if (head.next_ == &previous) {
+      head.prev_ = head.next_ = &head;
+    } else {
+      head.next_->prev_ = &head;
+      head.prev_->next_ = &head;
+    }
+  }
+
+  Leaf *FindLeaf(KeyBytes key) const noexcept {
+    const NodeBase *node = root_;
+    size_type depth = 0;
+    while (node != nullptr) {
+      if (node->kind_ == NodeKind::kLeaf) {
+        Leaf *leaf = static_cast<Leaf *>(const_cast<NodeBase *>(node));
+        return Equal(leaf, key) ? leaf : nullptr;
+      }
+      const Inner *inner = static_cast<const Inner *>(node);
+      size_type length = inner->prefix_len_;
+      if (key.size_ - depth < length) return nullptr;
+      // Сверяем только хранящиеся в узле байты префикса, остальные проверит
+      // сравнение с ключом листа
+      if (std::memcmp(inner->prefix_, key.data_ + depth,
+                      std::min(length, kMaxPrefix)) != 0)
+        return nullptr;
+      depth += length;
+      if (depth == key.size_) {
+        Leaf *leaf = inner->terminal_;
+        return leaf != nullptr && Equal(leaf, key) ? leaf : nullptr;
+      }
+      NodeBase *const *child = FindChild(inner, key.data_[depth]);
+      if (child == nullptr) return nullptr;
+      node = *child;
+      ++depth;
+    }
+    return nullptr;
+  }
+
+  // Наименьший лист поддерева с ключом не меньше key или nullptr
+  static LeafLinks *LowerBoundAt(const NodeBase *node, KeyBytes key,
+                                 size_type depth) {
+    if (node == nullptr) return nullptr;
+    if (node->kind_ == NodeKind::kLeaf) {
+      Leaf *leaf = static_cast<Leaf *>(const_cast<NodeBase *>(node));
+      auto encoded = key_traits::encode(leaf->value_.first);
+      return CompareFrom(ToBytes(encoded), key, depth) >= 0 ? leaf : nullptr;
+    }
+    const Inner *inner = static_cast<const Inner *>(node);
+    size_type matched = 0;
+    int order = ComparePrefix(inner, key, depth, matched);
+    if (order < 0) return MinLeaf(inner);
+    if (order > 0) return nullptr;
+    depth += inner->prefix_len_;
+    if (depth == key.size_) return MinLeaf(inner);
+    unsigned char byte = key.data_[depth];
+    NodeBase *const *child = FindChild(inner, byte);
+    if (child != nullptr) {
+      LeafLinks *found = LowerBoundAt(*child, key, depth + 1U);
+      if (found != nullptr) return found;
+    }
+    return MinLeaf(GreaterChild(inner, byte));
+  }
+
+  LeafLinks *LowerBound(KeyBytes key) const {
+    LeafLinks *found = LowerBoundAt(root_, key, 0U);
+    return found != nullptr ? found : const_cast<LeafLinks *>(&head_);
+  }
+
+  LeafLinks *UpperBound(KeyBytes key) const {
+    LeafLinks *found = LowerBound(key);
+    if (found != &head_ && Equal(static_cast<Leaf *>(found), key))
+      found = found->next_;
+    return found;
+  }
+
+  std::pair<LeafLinks *, LeafLinks *> PrefixRange(KeyBytes prefix) const {
+    const NodeBase *node = root_;
+    size_type depth = 0;
+    while (node != nullptr) {
+      if (node->kind_ == NodeKind::kLeaf) {
+        Leaf *leaf = static_cast<Leaf *>(const_cast<NodeBase *>(node));
+        auto encoded = key_traits::encode(leaf->value_.first);
+        KeyBytes bytes = ToBytes(encoded);
+        if (bytes.size_ >= prefix.size_ &&
+            std::memcmp(bytes.data_, prefix.data_, prefix.size_) == 0)
+          return {leaf, leaf->next_};
+        break;
+      }
+      const Inner *inner = static_cast<const Inner *>(node);
+      size_type matched = 0;
+      int order = ComparePrefix(inner, prefix, depth, matched);
+      // Префикс закончился внутри узла: подходит все поддерево
+      if (depth + matched == prefix.size_)
+        return {MinLeaf(inner), MaxLeaf(inner)->next_};
+      if (order != 0) break;
+      depth += inner->prefix_len_;
+      NodeBase *const *child = FindChild(inner, prefix.data_[depth]);
+      if (child == nullptr) break;
+      node = *child;
+      ++depth;
+    }
+    LeafLinks *position = LowerBound(prefix);
+    return {position, position};
+  }
+
+  template <bool IsConst>
+  struct RadixMapIterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = radix_map::value_type;
+    using reference = std::conditional_t<IsConst, const value_type &,
+                                         value_type &>;
+    using pointer = std::conditional_t<IsConst, const value_type *,
+                                       value_type *>;
+    using link_pointer =
+        std::conditional_t<IsConst, const LeafLinks *, LeafLinks *>;
+    using leaf_pointer = std::conditional_t<IsConst, const Leaf *, Leaf *>;
+
+    RadixMapIterator() noexcept : node_(nullptr) {}
+
+    explicit RadixMapIterator(link_pointer node) noexcept : node_(node) {}
+
+    /**
+     * @brief Неконстантный итератор неявно приводится к константному.
+     */
+    template <bool OtherConst,
+              typename = std::enable_if_t<IsConst && !OtherConst>>
+    RadixMapIterator(const RadixMapIterator<OtherConst> &other) noexcept
+        : node_(other.node_) {}
+
+    reference operator*() const noexcept {
+      return static_cast<leaf_pointer>(node_)->value_;
+    }
+
+    pointer operator->() const noexcept {
+      return &static_cast<leaf_pointer>(node_)->value_;
+    }
+
+    RadixMapIterator &operator++() noexcept {
+      node_ = node_->next_;
+      return *this;
+    }
+
+    RadixMapIterator operator++(int) noexcept {
+      RadixMapIterator tmp{*this};
+      ++(*this);
+      return tmp;
+    }
+
+    RadixMapIterator &operator--() noexcept {
+      node_ = node_->prev_;
+      return *this;
+    }
+
+    RadixMapIterator operator--(int) noexcept {
+      RadixMapIterator tmp{*this};
+      --(*this);
+      return tmp;
+    }
+
+    bool operator==(const RadixMapIterator &other) const noexcept {
+      return node_ == other.node_;
+    }
+
+    bool operator!=(const RadixMapIterator &other) const noexcept {
+      return node_ != other.node_;
+    }
+
+    link_pointer node_;  // Лист или заголовок списка (end()).
+  };
+
+  NodeBase *root_;
+  LeafLinks head_;  // Заголовок кольцевого списка листов.
+  size_type size_;
+};
+
+}  // namespace s21
+
+#endif
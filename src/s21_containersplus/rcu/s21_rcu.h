@@ -0,0 +1,131 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_RCU_S21_RCU_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_RCU_S21_RCU_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "../epoch/s21_epoch_domain.h"
+
+namespace s21 {
+
+/**
+ * @brief Обертка read-copy-update для контейнеров, которые очень часто
+ * читаются из многих потоков и редко меняются (настройки, справочники).
+ *
+ * @details Текущее состояние - неизменяемый контейнер, на который указывает
+ * атомарный указатель. Читатель получает снимок через load(): это
+ * закрепление в epoch_domain и одно чтение указателя, без блокировок и без
+ * записи в общие данные. Писатель копирует контейнер, меняет копию и
+ * публикует ее одной атомарной записью; старая версия удаляется через
+ * epoch_domain, когда ее больше не читает ни один снимок.
+ *
+ * Писатели выполняются по очереди (под мьютексом). Каждое изменение
+ * копирует контейнер целиком, поэтому rcu подходит только для данных,
+ * которые меняются редко.
+ *
+ * @tparam Container Тип контейнера (например, s21::map или s21::set)
+ */
+template <class Container>
+class rcu {
+ public:
+  using value_type = Container;
+
+  /**
+   * @brief Снимок состояния: константный доступ к версии контейнера,
+   * актуальной на момент load(). Версия не удаляется, пока жив снимок.
+   * Снимок нельзя передавать в другой поток.
+   */
+  class snapshot {
+   public:
+    const value_type &operator*() const noexcept { return *data_; }
+
+    const value_type *operator->() const noexcept { return data_; }
+
+    const value_type *get() const noexcept { return data_; }
+
+   private:
+    friend class rcu;
+
+    snapshot(epoch_domain &domain, const std::atomic<value_type *> &current)
+        : guard_(domain),
+          data_(current.load(std::memory_order_acquire)) {}
+
+    epoch_domain::guard guard_;
+    const value_type *data_;
+  };
+
+  /**
+   * @brief Создает обертку с начальным значением value.
+   *
+   * @param domain Домен отложенного освобождения старых версий
+   */
+  explicit rcu(value_type value = value_type(),
+               epoch_domain &domain = epoch_domain::global())
+      : current_(new value_type(std::move(value))), domain_(&domain) {}
+
+  rcu(const rcu &) = delete;
+  rcu &operator=(const rcu &) = delete;
+
+  /**
+   * @brief Удаляет текущую версию. Снимков этой обертки в этот момент быть
+   * не должно; старые версии удалит домен.
+   */
+  ~rcu() { delete current_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Снимок текущей версии.
+   */
+  snapshot load() const { return snapshot(*domain_, current_); }
+
+  /**
+   * @brief Заменяет содержимое на value.
+   */
+  void store(value_type value) {
+    auto next = std::make_unique<value_type>(std::move(value));
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    Publish(std::move(next));
+  }
+
+  /**
+   * @brief Изменяет содержимое: копирует текущую версию, вызывает
+   * fn(value_type &) для копии и публикует результат. Если fn выбросила
+   * исключение, текущая версия не меняется.
+   */
+  template <class F>
+  void update(F &&fn) {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    auto next = std::make_unique<value_type>(
+        *current_.load(std::memory_order_relaxed));
+    fn(*next);
+    Publish(std::move(next));
+  }
+
+  /**
+   * @brief Дожидается удаления всех старых версий, опубликованных текущим
+   * потоком (см. epoch_domain::synchronize()).
+   */
+  void synchronize() { domain_->synchronize(); }
+
+ private:
+  // Вызывается под writer_mutex_. Все, что может бросить исключение,
+  // выполняется до замены указателя: после нее старую версию еще могут
+  // читать снимки, и удалить ее сразу нельзя. Старые версии удаляются, как
+  // только это безопасно: иначе у редко обновляемой структуры полные копии
+  // ждали бы, пока у домена наберется пачка удалений
+  void Publish(std::unique_ptr<value_type> next) {
+    domain_->collect();
+    domain_->reserve_retire();
+    domain_->retire_reserved(
+        current_.exchange(next.release(), std::memory_order_acq_rel));
+  }
+
+  std::atomic<value_type *> current_;
+  epoch_domain *domain_;
+  std::mutex writer_mutex_;  // Упорядочивает писателей.
+};
+
+}  // namespace s21
+
+#endif
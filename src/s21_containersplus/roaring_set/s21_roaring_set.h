@@ -0,0 +1,1114 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_ROARING_SET_S21_ROARING_SET_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_ROARING_SET_S21_ROARING_SET_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "../../s21_containers/set/s21_set.h"
+#include "../../s21_containers/vector/s21_vector.h"
+#include "../bitset/s21_bitset.h"
+
+namespace s21 {
+
+/**
+ * @brief Сжатое множество чисел std::uint32_t (roaring bitmap).
+ *
+ * @details Значения делятся по старшим 16 битам на блоки по 65536 чисел.
+ * Младшие 16 битов элементов непустого блока хранятся в контейнере одного
+ * из трех видов:
+ * - массив: отсортированные std::uint16_t, не больше 4096 штук (2 байта на
+ *   элемент);
+ * - битовая карта: 1024 слова по 64 бита (8 КБ), если элементов больше;
+ * - серии: пары (начало, длина - 1) для значений, идущих подряд. Их создают
+ *   insert_range() и run_optimize(); при вставке и удалении отдельных
+ *   элементов серии разворачиваются обратно в массив или карту.
+ *
+ * Поэтому память зависит от распределения, а не от наибольшего значения,
+ * как у s21::dense_int_set: редкие значения стоят около 2 байтов, плотные
+ * блоки - 1 бит, диапазоны - 4 байта на серию, против ~48 байтов на элемент
+ * у s21::set<std::uint32_t>.
+ *
+ * Объединение, пересечение и разность обходят блоки обоих множеств
+ * слиянием: карты обрабатываются циклами по словам, которые компилятор
+ * векторизует, а пересечение массивов сравнивает блоки по 8 элементов
+ * инструкциями SSE2 (если они доступны).
+ *
+ * Итератор хранит номер контейнера и значение; вставка и удаление делают
+ * итераторы недействительными.
+ */
+class roaring_set {
+ private:
+  struct Container;
+  struct RoaringSetIterator;
+
+ public:
+  using key_type = std::uint32_t;
+  using value_type = std::uint32_t;
+  using reference = value_type;
+  using const_reference = value_type;
+  using iterator = RoaringSetIterator;
+  using const_iterator = RoaringSetIterator;
+  using size_type = std::size_t;
+
+  roaring_set() = default;
+
+  roaring_set(std::initializer_list<value_type> const &items)
+      : roaring_set(items.begin(), items.end()) {}
+
+  template <class InputIt>
+  roaring_set(InputIt first, InputIt last) : roaring_set() {
+    for (; first != last; ++first) insert(*first);
+  }
+
+  template <class Compare, class Storage>
+  explicit roaring_set(const s21::set<value_type, Compare, Storage> &other)
+      : roaring_set(other.begin(), other.end()) {}
+
+  roaring_set(const roaring_set &other) = default;
+
+  roaring_set(roaring_set &&other) noexcept : roaring_set() { swap(other); }
+
+  roaring_set &operator=(const roaring_set &other) = default;
+
+  roaring_set &operator=(roaring_set &&other) noexcept {
+    if (this != &other) {
+      roaring_set tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ~roaring_set() = default;
+
+ public:
+  iterator begin() const noexcept { return Seek(0, 0); }
+
+  iterator end() const noexcept { return iterator(this, keys_.size(), kEnd); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return size_type(std::numeric_limits<value_type>::max()) + 1U;
+  }
+
+  void clear() noexcept {
+    keys_ = s21::vector<std::uint16_t>();
+    containers_ = s21::vector<Container>();
+    size_ = 0;
+  }
+
+  std::pair<iterator, bool> insert(value_type value) {
+    std::uint32_t high = value >> kLowBits;
+    std::uint32_t low = value & kLowMask;
+    size_type index = FindKey(high);
+    bool inserted = true;
+    if (index == keys_.size() || keys_.data()[index] != high) {
+      Container container;
+      container.values_.push_back(static_cast<std::uint16_t>(low));
+      container.cardinality_ = 1;
+      InsertContainer(index, high, std::move(container));
+    } else {
+      inserted = Insert(containers_.data()[index], low);
+    }
+    if (inserted) ++size_;
+    return {iterator(this, index, value), inserted};
+  }
+
+  /**
+   * @brief Вставляет все значения отрезка [first, last]. Пустые блоки
+   * получают контейнер из одной серии, поэтому диапазон занимает память,
+   * пропорциональную числу затронутых блоков, а не его длине.
+   *
+   * @return Число добавленных элементов
+   */
+  size_type insert_range(value_type first, value_type last) {
+    if (first > last) return 0;
+    size_type before = size_;
+    std::uint32_t first_high = first >> kLowBits;
+    std::uint32_t last_high = last >> kLowBits;
+    for (std::uint32_t high = first_high;; ++high) {
+      std::uint32_t low_first = high == first_high ? first & kLowMask : 0U;
+      std::uint32_t low_last = high == last_high ? last & kLowMask : kLowMask;
+      InsertRange(high, low_first, low_last);
+      if (high == last_high) break;
+    }
+    return size_ - before;
+  }
+
+  void erase(iterator pos) { erase(*pos); }
+
+  size_type erase(value_type value) {
+    std::uint32_t high = value >> kLowBits;
+    size_type index = FindKey(high);
+    if (index == keys_.size() || keys_.data()[index] != high ||
+        !Erase(containers_.data()[index], value & kLowMask))
+      return 0;
+    --size_;
+    if (containers_.data()[index].cardinality_ == 0) {
+      containers_.erase(containers_.begin() + index);
+      keys_.erase(keys_.begin() + index);
+    }
+    return 1;
+  }
+
+  void swap(roaring_set &other) noexcept {
+    keys_.swap(other.keys_);
+    containers_.swap(other.containers_);
+    std::swap(size_, other.size_);
+  }
+
+  /**
+   * @brief Переносит из other элементы, которых нет в *this (в other
+   * остаются только общие элементы).
+   */
+  void merge(roaring_set &other) {
+    if (this == &other) return;
+    roaring_set common = *this & other;
+    *this |= other;
+    other.swap(common);
+  }
+
+  /**
+   * @brief Переводит в серии контейнеры, которые так займут меньше памяти, а
+   * серии, переставшие быть выгодными, - обратно в массивы и карты.
+   *
+   * @return true, если после вызова есть хотя бы один контейнер из серий
+   */
+  bool run_optimize() {
+    bool has_runs = false;
+    for (Container &container : containers_) {
+      Compress(container);
+      has_runs = has_runs || container.kind_ == Kind::kRun;
+    }
+    return has_runs;
+  }
+
+ public:
+  bool contains(value_type value) const noexcept {
+    std::uint32_t high = value >> kLowBits;
+    size_type index = FindKey(high);
+    return index != keys_.size() && keys_.data()[index] == high &&
+           Contains(containers_.data()[index], value & kLowMask);
+  }
+
+  size_type count(value_type value) const noexcept {
+    return contains(value) ? 1 : 0;
+  }
+
+  iterator find(value_type value) const noexcept {
+    std::uint32_t high = value >> kLowBits;
+    size_type index = FindKey(high);
+    if (index != keys_.size() && keys_.data()[index] == high &&
+        Contains(containers_.data()[index], value & kLowMask))
+      return iterator(this, index, value);
+    return end();
+  }
+
+  iterator lower_bound(value_type value) const noexcept {
+    std::uint32_t high = value >> kLowBits;
+    size_type index = FindKey(high);
+    if (index != keys_.size() && keys_.data()[index] == high)
+      return Seek(index, value & kLowMask);
+    return Seek(index, 0);
+  }
+
+  iterator upper_bound(value_type value) const noexcept {
+    if (value == std::numeric_limits<value_type>::max()) return end();
+    return lower_bound(value + 1U);
+  }
+
+  /**
+   * @brief Копия в виде s21::set (дерево строится за O(n): элементы уже
+   * упорядочены).
+   */
+  s21::set<value_type> to_set() const {
+    return s21::set<value_type>(s21::execution::seq, begin(), end());
+  }
+
+  roaring_set &operator|=(const roaring_set &other) {
+    *this = Combine(*this, other, Operation::kUnion);
+    return *this;
+  }
+
+  roaring_set &operator&=(const roaring_set &other) {
+    *this = Combine(*this, other, Operation::kIntersection);
+    return *this;
+  }
+
+  roaring_set &operator-=(const roaring_set &other) {
+    *this = Combine(*this, other, Operation::kDifference);
+    return *this;
+  }
+
+  friend roaring_set operator|(const roaring_set &lhs,
+                               const roaring_set &rhs) {
+    return Combine(lhs, rhs, Operation::kUnion);
+  }
+
+  friend roaring_set operator&(const roaring_set &lhs,
+                               const roaring_set &rhs) {
+    return Combine(lhs, rhs, Operation::kIntersection);
+  }
+
+  friend roaring_set operator-(const roaring_set &lhs,
+                               const roaring_set &rhs) {
+    return Combine(lhs, rhs, Operation::kDifference);
+  }
+
+  bool operator==(const roaring_set &other) const noexcept {
+    if (size_ != other.size_ || keys_.size() != other.keys_.size())
+      return false;
+    for (size_type i = 0; i < keys_.size(); ++i) {
+      if (keys_.data()[i] != other.keys_.data()[i] ||
+          !Equal(containers_.data()[i], other.containers_.data()[i]))
+        return false;
+    }
+    return true;
+  }
+
+  bool operator!=(const roaring_set &other) const noexcept {
+    return !(*this == other);
+  }
+
+  /**
+   * @brief Размер результата serialize() в байтах.
+   */
+  size_type serialized_size() const noexcept {
+    size_type total = kHeaderBytes;
+    for (const Container &container : containers_)
+      total += kContainerHeaderBytes + PayloadBytes(container);
+    return total;
+  }
+
+  /**
+   * @brief Сохраняет множество в массив байтов (числа - little-endian):
+   * заголовок "S21R" и число контейнеров (4 байта), затем для каждого
+   * контейнера старшие 16 битов (2 байта), вид (1 байт: 0 - массив, 1 -
+   * карта, 2 - серии), число элементов (4 байта) и содержимое: значения
+   * массива по 2 байта, 1024 слова карты по 8 байтов или число серий
+   * (2 байта) и пары (начало, длина - 1) по 2 байта.
+   *
+   * @details Формат не зависит от платформы, но не совместим с форматом
+   * других реализаций roaring bitmap.
+   */
+  std::vector<std::uint8_t> serialize() const {
+    std::vector<std::uint8_t> out;
+    out.reserve(serialized_size());
+    Put(out, kMagic, 4U);
+    Put(out, keys_.size(), 4U);
+    for (size_type i = 0; i < keys_.size(); ++i) {
+      const Container &container = containers_.data()[i];
+      Put(out, keys_.data()[i], 2U);
+      Put(out, static_cast<std::uint8_t>(container.kind_), 1U);
+      Put(out, container.cardinality_, 4U);
+      if (container.kind_ == Kind::kRun) Put(out, Runs(container), 2U);
+      for (std::uint16_t value : container.values_) Put(out, value, 2U);
+      for (std::uint64_t word : container.words_) Put(out, word, 8U);
+    }
+    return out;
+  }
+
+  /**
+   * @brief Восстанавливает множество, сохраненное serialize().
+   *
+   * @throw std::invalid_argument если данные обрезаны, содержат лишние
+   * байты или нарушают формат
+   */
+  static roaring_set deserialize(const std::uint8_t *data, size_type size) {
+    Reader reader{data, size, 0};
+    if (reader.Get(4U) != kMagic) Fail("bad header");
+    std::uint64_t containers = reader.Get(4U);
+    if (containers > kChunk) Fail("too many containers");
+    roaring_set result;
+    for (std::uint64_t i = 0; i < containers; ++i) {
+      std::uint64_t key = reader.Get(2U);
+      if (!result.keys_.empty() && key <= result.keys_.data()[i - 1U])
+        Fail("keys are not increasing");
+      Container container = ReadContainer(reader);
+      result.size_ += container.cardinality_;
+      result.keys_.push_back(static_cast<std::uint16_t>(key));
+      result.containers_.push_back(std::move(container));
+    }
+    if (reader.offset_ != size) Fail("trailing bytes");
+    return result;
+  }
+
+  static roaring_set deserialize(const std::vector<std::uint8_t> &bytes) {
+    return deserialize(bytes.data(), bytes.size());
+  }
+
+ private:
+  enum class Kind : std::uint8_t { kArray, kBitmap, kRun };
+  enum class Operation { kUnion, kIntersection, kDifference };
+
+  static constexpr unsigned kLowBits = 16U;
+  static constexpr std::uint32_t kLowMask = 0xFFFFU;
+  // Значений в блоке; NextFrom() и PrevFrom() возвращают его, если
+  // подходящего элемента нет
+  static constexpr std::uint32_t kChunk = 1U << kLowBits;
+  static constexpr std::uint32_t kNone = kChunk;
+  // Наибольший размер массива: больше 4096 элементов карта (8 КБ) меньше
+  static constexpr std::uint32_t kArrayMax = 4096U;
+  static constexpr size_type kBits = 64U;
+  static constexpr size_type kBitmapWords = kChunk / kBits;
+  // Позиция end(): больше любого значения
+  static constexpr std::uint64_t kEnd = std::uint64_t(1) << 32U;
+
+  static constexpr std::uint64_t kMagic = 0x52313253U;  // "S21R"
+  static constexpr size_type kHeaderBytes = 8U;
+  static constexpr size_type kContainerHeaderBytes = 7U;
+
+  struct Container {
+    Kind kind_ = Kind::kArray;
+    std::uint32_t cardinality_ = 0;
+    // kArray - отсортированные значения, kRun - пары (начало, длина - 1)
+    s21::vector<std::uint16_t> values_;
+    s21::vector<std::uint64_t> words_;  // kBitmap - kBitmapWords слов
+  };
+
+  size_type FindKey(std::uint32_t high) const noexcept {
+    return static_cast<size_type>(
+        std::lower_bound(keys_.begin(), keys_.end(), high) - keys_.begin());
+  }
+
+  std::uint64_t Value(size_type index, std::uint32_t low) const noexcept {
+    return std::uint64_t(keys_.data()[index]) << kLowBits | low;
+  }
+
+  void InsertContainer(size_type index, std::uint32_t high,
+                       Container &&container) {
+    containers_.insert(containers_.begin() + index, std::move(container));
+    try {
+      keys_.insert(keys_.begin() + index, static_cast<std::uint16_t>(high));
+    } catch (...) {
+      containers_.erase(containers_.begin() + index);
+      throw;
+    }
+  }
+
+  // Добавляет в блок high значения [first, last]
+  void InsertRange(std::uint32_t high, std::uint32_t first,
+                   std::uint32_t last) {
+    Container range;
+    range.kind_ = Kind::kRun;
+    range.values_.push_back(static_cast<std::uint16_t>(first));
+    range.values_.push_back(static_cast<std::uint16_t>(last - first));
+    range.cardinality_ = last - first + 1U;
+    size_type index = FindKey(high);
+    if (index == keys_.size() || keys_.data()[index] != high) {
+      size_ += range.cardinality_;
+      InsertContainer(index, high, std::move(range));
+      return;
+    }
+    Container &container = containers_.data()[index];
+    Container merged = range.cardinality_ == kChunk
+                           ? std::move(range)
+                           : Combine(container, range, Operation::kUnion);
+    size_ = size_ - container.cardinality_ + merged.cardinality_;
+    container = std::move(merged);
+  }
+
+  // Первый элемент, не меньший low в контейнере index, или первый элемент
+  // следующих контейнеров
+  iterator Seek(size_type index, std::uint32_t low) const noexcept {
+    for (; index < keys_.size(); ++index, low = 0) {
+      std::uint32_t found = NextFrom(containers_.data()[index], low);
+      if (found != kNone) return iterator(this, index, Value(index, found));
+    }
+    return end();
+  }
+
+  // Элемент перед pos
+  iterator Previous(const iterator &pos) const noexcept {
+    size_type index = pos.index_;
+    std::uint32_t low = static_cast<std::uint32_t>(pos.position_) & kLowMask;
+    if (index == keys_.size() || low == 0) {
+      if (index == 0) return end();
+      --index;
+      low = kLowMask;
+    } else {
+      --low;
+    }
+    for (;; --index, low = kLowMask) {
+      std::uint32_t found = PrevFrom(containers_.data()[index], low);
+      if (found != kNone) return iterator(this, index, Value(index, found));
+      if (index == 0) return end();
+    }
+  }
+
+  // Операции над одним контейнером; low - младшие 16 битов значения
+
+  static size_type Runs(const Container &c) noexcept {
+    return c.values_.size() / 2U;
+  }
+
+  static std::uint32_t RunStart(const Container &c, size_type run) noexcept {
+    return c.values_.data()[2U * run];
+  }
+
+  static std::uint32_t RunLast(const Container &c, size_type run) noexcept {
+    return std::uint32_t(c.values_.data()[2U * run]) +
+           c.values_.data()[2U * run + 1U];
+  }
+
+  // Число серий, начинающихся не позже low
+  static size_type RunsUpTo(const Container &c, std::uint32_t low) noexcept {
+    size_type first = 0;
+    size_type last = Runs(c);
+    while (first < last) {
+      size_type middle = first + (last - first) / 2U;
+      if (RunStart(c, middle) <= low) {
+        first = middle + 1U;
+      } else {
+        last = middle;
+      }
+    }
+    return first;
+  }
+
+  static bool TestBit(const std::uint64_t *words, std::uint32_t low) noexcept {
+    return (words[low / kBits] >> (low % kBits) & 1U) != 0;
+  }
+
+  static bool Contains(const Container &c, std::uint32_t low) noexcept {
+    switch (c.kind_) {
+      case Kind::kArray:
+        return std::binary_search(c.values_.begin(), c.values_.end(), low);
+      case Kind::kBitmap:
+        return TestBit(c.words_.data(), low);
+      case Kind::kRun: {
+        size_type runs = RunsUpTo(c, low);
+        return runs != 0 && low <= RunLast(c, runs - 1U);
+      }
+    }
+    return false;
+  }
+
+  // Наименьший элемент, не меньший low, или kNone
+  static std::uint32_t NextFrom(const Container &c,
+                                std::uint32_t low) noexcept {
+    if (low >= kChunk) return kNone;
+    switch (c.kind_) {
+      case Kind::kArray: {
+        const std::uint16_t *found =
+            std::lower_bound(c.values_.begin(), c.values_.end(), low);
+        return found == c.values_.end() ? kNone : *found;
+      }
+      case Kind::kBitmap: {
+        const std::uint64_t *words = c.words_.data();
+        size_type i = low / kBits;
+        std::uint64_t word = words[i] & (~std::uint64_t(0) << (low % kBits));
+        while (word == 0) {
+          if (++i == kBitmapWords) return kNone;
+          word = words[i];
+        }
+        return static_cast<std::uint32_t>(i * kBits +
+                                          detail::CountTrailingZeros(word));
+      }
+      case Kind::kRun: {
+        size_type runs = RunsUpTo(c, low);
+        if (runs != 0 && low <= RunLast(c, runs - 1U)) return low;
+        return runs < Runs(c) ? RunStart(c, runs) : kNone;
+      }
+    }
+    return kNone;
+  }
+
+  // Наибольший элемент, не больший low, или kNone
+  static std::uint32_t PrevFrom(const Container &c,
+                                std::uint32_t low) noexcept {
+    switch (c.kind_) {
+      case Kind::kArray: {
+        const std::uint16_t *found =
+            std::upper_bound(c.values_.begin(), c.values_.end(), low);
+        return found == c.values_.begin() ? kNone : found[-1];
+      }
+      case Kind::kBitmap: {
+        const std::uint64_t *words = c.words_.data();
+        size_type i = low / kBits;
+        unsigned shift = static_cast<unsigned>(kBits - 1U - low % kBits);
+        std::uint64_t word = words[i] & (~std::uint64_t(0) >> shift);
+        while (word == 0) {
+          if (i-- == 0) return kNone;
+          word = words[i];
+        }
+        return static_cast<std::uint32_t>(i * kBits +
+                                          detail::HighestBit(word));
+      }
+      case Kind::kRun: {
+        size_type runs = RunsUpTo(c, low);
+        return runs == 0 ? kNone : std::min(low, RunLast(c, runs - 1U));
+      }
+    }
+    return kNone;
+  }
+
+  // Устанавливает биты [first, last]
+  static void SetRange(std::uint64_t *words, std::uint32_t first,
+                       std::uint32_t last) noexcept {
+    size_type first_word = first / kBits;
+    size_type last_word = last / kBits;
+    std::uint64_t first_mask = ~std::uint64_t(0) << (first % kBits);
+    std::uint64_t last_mask = ~std::uint64_t(0) >> (kBits - 1U - last % kBits);
+    if (first_word == last_word) {
+      words[first_word] |= first_mask & last_mask;
+      return;
+    }
+    words[first_word] |= first_mask;
+    for (size_type i = first_word + 1U; i < last_word; ++i)
+      words[i] = ~std::uint64_t(0);
+    words[last_word] |= last_mask;
+  }
+
+  // Элементы контейнера любого вида в виде битовой карты
+  static s21::vector<std::uint64_t> ToWords(const Container &c) {
+    if (c.kind_ == Kind::kBitmap) return c.words_;
+    s21::vector<std::uint64_t> words(kBitmapWords);
+    std::uint64_t *out = words.data();
+    if (c.kind_ == Kind::kArray) {
+      for (std::uint16_t value : c.values_)
+        out[value / kBits] |= std::uint64_t(1) << (value % kBits);
+    } else {
+      for (size_type run = 0; run < Runs(c); ++run)
+        SetRange(out, RunStart(c, run), RunLast(c, run));
+    }
+    return words;
+  }
+
+  static void MakeBitmap(Container &c) {
+    if (c.kind_ == Kind::kBitmap) return;
+    c.words_ = ToWords(c);
+    c.values_ = s21::vector<std::uint16_t>();
+    c.kind_ = Kind::kBitmap;
+  }
+
+  static void MakeArray(Container &c) {
+    if (c.kind_ == Kind::kArray) return;
+    s21::vector<std::uint16_t> values(c.cardinality_);
+    std::uint16_t *out = values.data();
+    if (c.kind_ == Kind::kBitmap) {
+      const std::uint64_t *words = c.words_.data();
+      for (size_type i = 0; i < kBitmapWords; ++i) {
+        for (std::uint64_t word = words[i]; word != 0; word &= word - 1U)
+          *out++ = static_cast<std::uint16_t>(
+              i * kBits + detail::CountTrailingZeros(word));
+      }
+    } else {
+      for (size_type run = 0; run < Runs(c); ++run) {
+        for (std::uint32_t value = RunStart(c, run); value <= RunLast(c, run);
+             ++value)
+          *out++ = static_cast<std::uint16_t>(value);
+      }
+    }
+    c.values_.swap(values);
+    c.words_ = s21::vector<std::uint64_t>();
+    c.kind_ = Kind::kArray;
+  }
+
+  static void MakeRuns(Container &c) {
+    if (c.kind_ == Kind::kRun) return;
+    s21::vector<std::uint16_t> runs(2U * CountRuns(c));
+    std::uint16_t *out = runs.data();
+    for (std::uint32_t first = NextFrom(c, 0); first != kNone;) {
+      std::uint32_t last = first;
+      while (last + 1U < kChunk && Contains(c, last + 1U)) ++last;
+      *out++ = static_cast<std::uint16_t>(first);
+      *out++ = static_cast<std::uint16_t>(last - first);
+      first = NextFrom(c, last + 1U);
+    }
+    c.values_.swap(runs);
+    c.words_ = s21::vector<std::uint64_t>();
+    c.kind_ = Kind::kRun;
+  }
+
+  // Массив или карта - в зависимости от числа элементов
+  static void Normalize(Container &c) {
+    if (c.cardinality_ > kArrayMax) {
+      MakeBitmap(c);
+    } else {
+      MakeArray(c);
+    }
+  }
+
+  static size_type CountRuns(const Container &c) noexcept {
+    if (c.kind_ == Kind::kRun) return Runs(c);
+    size_type runs = 0;
+    if (c.kind_ == Kind::kArray) {
+      const std::uint16_t *values = c.values_.data();
+      for (size_type i = 0; i < c.values_.size(); ++i)
+        runs += i == 0 || values[i] != values[i - 1U] + 1U;
+      return runs;
+    }
+    // Начало серии - единичный бит, перед которым нулевой
+    std::uint64_t carry = 0;
+    for (std::uint64_t word : c.words_) {
+      runs += detail::PopCount(word & ~(word << 1U | carry));
+      carry = word >> (kBits - 1U);
+    }
+    return runs;
+  }
+
+  static size_type PayloadBytes(const Container &c) noexcept {
+    switch (c.kind_) {
+      case Kind::kArray:
+        return 2U * c.values_.size();
+      case Kind::kBitmap:
+        return 8U * kBitmapWords;
+      case Kind::kRun:
+        return 2U + 2U * c.values_.size();
+    }
+    return 0;
+  }
+
+  static void Compress(Container &c) {
+    size_type run_bytes = 2U + 4U * CountRuns(c);
+    size_type plain_bytes =
+        c.cardinality_ > kArrayMax ? 8U * kBitmapWords : 2U * c.cardinality_;
+    if (run_bytes < plain_bytes) {
+      MakeRuns(c);
+    } else {
+      Normalize(c);
+    }
+  }
+
+  static bool Insert(Container &c, std::uint32_t low) {
+    if (c.kind_ == Kind::kRun) {
+      if (Contains(c, low)) return false;
+      Normalize(c);
+    }
+    if (c.kind_ == Kind::kArray) {
+      std::uint16_t *pos =
+          std::lower_bound(c.values_.begin(), c.values_.end(), low);
+      if (pos != c.values_.end() && *pos == low) return false;
+      if (c.cardinality_ < kArrayMax) {
+        c.values_.insert(pos, static_cast<std::uint16_t>(low));
+        ++c.cardinality_;
+        return true;
+      }
+      MakeBitmap(c);
+    }
+    std::uint64_t &word = c.words_.data()[low / kBits];
+    std::uint64_t bit = std::uint64_t(1) << (low % kBits);
+    if ((word & bit) != 0) return false;
+    word |= bit;
+    ++c.cardinality_;
+    return true;
+  }
+
+  static bool Erase(Container &c, std::uint32_t low) {
+    if (!Contains(c, low)) return false;
+    if (c.kind_ == Kind::kRun) Normalize(c);
+    if (c.kind_ == Kind::kArray) {
+      c.values_.erase(
+          std::lower_bound(c.values_.begin(), c.values_.end(), low));
+    } else {
+      c.words_.data()[low / kBits] &= ~(std::uint64_t(1) << (low % kBits));
+    }
+    --c.cardinality_;
+    Normalize(c);
+    return true;
+  }
+
+  static bool Equal(const Container &lhs, const Container &rhs) noexcept {
+    if (lhs.cardinality_ != rhs.cardinality_) return false;
+    // Серии всегда максимальны, поэтому контейнеры одного вида с равными
+    // элементами совпадают побайтно
+    if (lhs.kind_ == rhs.kind_)
+      return std::equal(lhs.values_.begin(), lhs.values_.end(),
+                        rhs.values_.begin(), rhs.values_.end()) &&
+             std::equal(lhs.words_.begin(), lhs.words_.end(),
+                        rhs.words_.begin(), rhs.words_.end());
+    for (std::uint32_t low = NextFrom(lhs, 0); low != kNone;
+         low = NextFrom(lhs, low + 1U))
+      if (!Contains(rhs, low)) return false;
+    return true;
+  }
+
+  // Операции над парой контейнеров. Серии перед ними разворачиваются во
+  // временный контейнер buffer
+
+  static const Container &Expanded(const Container &c, Container &buffer) {
+    if (c.kind_ != Kind::kRun) return c;
+    buffer = c;
+    Normalize(buffer);
+    return buffer;
+  }
+
+  static Container ArrayOf(const std::uint16_t *values, size_type count) {
+    Container result;
+    result.values_ = s21::vector<std::uint16_t>(count);
+    std::copy(values, values + count, result.values_.begin());
+    result.cardinality_ = static_cast<std::uint32_t>(count);
+    return result;
+  }
+
+  // Побитовая операция над картами
+  template <class WordOperation>
+  static Container Bitwise(const std::uint64_t *lhs, const std::uint64_t *rhs,
+                           WordOperation operation) {
+    Container result;
+    result.kind_ = Kind::kBitmap;
+    result.words_ = s21::vector<std::uint64_t>(kBitmapWords);
+    std::uint64_t *out = result.words_.data();
+    // Отдельные циклы: первый векторизуется, второй - popcnt по словам
+    for (size_type i = 0; i < kBitmapWords; ++i)
+      out[i] = operation(lhs[i], rhs[i]);
+    std::uint32_t cardinality = 0;
+    for (size_type i = 0; i < kBitmapWords; ++i)
+      cardinality += detail::PopCount(out[i]);
+    result.cardinality_ = cardinality;
+    Normalize(result);
+    return result;
+  }
+
+  /**
+   * @brief Пересечение отсортированных массивов a и b, записанное в out.
+   *
+   * @details С SSE2 массивы обходятся блоками по 8 элементов: блок a
+   * сравнивается с блоком b, циклически сдвинутым на 0..7 элементов, то есть
+   * каждый с каждым за 8 сравнений без ветвлений. Затем блок с меньшим
+   * последним элементом заменяется следующим (оба, если последние равны):
+   * его элементы меньше всех оставшихся в другом массиве. Остаток
+   * сливается обычным способом.
+   *
+   * @return Число элементов пересечения
+   */
+  static size_type IntersectArrays(const std::uint16_t *a, size_type a_size,
+                                   const std::uint16_t *b, size_type b_size,
+                                   std::uint16_t *out) noexcept {
+    size_type i = 0;
+    size_type j = 0;
+    size_type count = 0;
+#if defined(__SSE2__)
+    while (i + 8U <= a_size && j + 8U <= b_size) {
+      __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+      __m128i right =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j));
+      __m128i equal = _mm_cmpeq_epi16(left, right);
+      for (int rotation = 1; rotation < 8; ++rotation) {
+        right =
+            _mm_or_si128(_mm_srli_si128(right, 2), _mm_slli_si128(right, 14));
+        equal = _mm_or_si128(equal, _mm_cmpeq_epi16(left, right));
+      }
+      // Два бита маски на каждый совпавший элемент a
+      unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(equal));
+      while (mask != 0) {
+        out[count++] = a[i + detail::CountTrailingZeros(mask) / 2U];
+        mask &= mask - 1U;
+        mask &= mask - 1U;
+      }
+      std::uint16_t a_last = a[i + 7U];
+      std::uint16_t b_last = b[j + 7U];
+      if (a_last <= b_last) i += 8U;
+      if (b_last <= a_last) j += 8U;
+    }
+#endif
+    while (i < a_size && j < b_size) {
+      if (a[i] < b[j]) {
+        ++i;
+      } else if (b[j] < a[i]) {
+        ++j;
+      } else {
+        out[count++] = a[i];
+        ++i;
+        ++j;
+      }
+    }
+    return count;
+  }
+
+  static Container Intersect(const Container &lhs, const Container &rhs) {
+    Container lhs_buffer;
+    Container rhs_buffer;
+    const Container &a = Expanded(lhs, lhs_buffer);
+    const Container &b = Expanded(rhs, rhs_buffer);
+    if (a.kind_ == Kind::kBitmap && b.kind_ == Kind::kBitmap)
+      return Bitwise(a.words_.data(), b.words_.data(),
+                     [](std::uint64_t x, std::uint64_t y) { return x & y; });
+    std::uint16_t result[kArrayMax];
+    size_type count = 0;
+    if (a.kind_ == Kind::kArray && b.kind_ == Kind::kArray) {
+      count = IntersectArrays(a.values_.data(), a.values_.size(),
+                              b.values_.data(), b.values_.size(), result);
+    } else {
+      const Container &array = a.kind_ == Kind::kArray ? a : b;
+      const Container &bitmap = a.kind_ == Kind::kArray ? b : a;
+      for (std::uint16_t value : array.values_)
+        if (TestBit(bitmap.words_.data(), value)) result[count++] = value;
+    }
+    return ArrayOf(result, count);
+  }
+
+  static Container Unite(const Container &lhs, const Container &rhs) {
+    Container lhs_buffer;
+    Container rhs_buffer;
+    const Container &a = Expanded(lhs, lhs_buffer);
+    const Container &b = Expanded(rhs, rhs_buffer);
+    if (a.kind_ == Kind::kBitmap && b.kind_ == Kind::kBitmap)
+      return Bitwise(a.words_.data(), b.words_.data(),
+                     [](std::uint64_t x, std::uint64_t y) { return x | y; });
+    if (a.kind_ == Kind::kArray && b.kind_ == Kind::kArray &&
+        a.cardinality_ + b.cardinality_ <= kArrayMax) {
+      std::uint16_t result[kArrayMax];
+      std::uint16_t *last =
+          std::set_union(a.values_.begin(), a.values_.end(),
+                         b.values_.begin(), b.values_.end(), result);
+      return ArrayOf(result, static_cast<size_type>(last - result));
+    }
+    // Карта одного из аргументов (или построенная по массиву), в которую
+    // добавляются элементы массива другого
+    const Container &base = a.kind_ == Kind::kBitmap ? a : b;
+    const Container &array = a.kind_ == Kind::kBitmap ? b : a;
+    Container result;
+    result.kind_ = Kind::kBitmap;
+    result.words_ = ToWords(base);
+    result.cardinality_ = base.cardinality_;
+    std::uint64_t *words = result.words_.data();
+    for (std::uint16_t value : array.values_) {
+      std::uint64_t bit = std::uint64_t(1) << (value % kBits);
+      result.cardinality_ += (words[value / kBits] & bit) == 0;
+      words[value / kBits] |= bit;
+    }
+    Normalize(result);
+    return result;
+  }
+
+  static Container Subtract(const Container &lhs, const Container &rhs) {
+    Container lhs_buffer;
+    Container rhs_buffer;
+    const Container &a = Expanded(lhs, lhs_buffer);
+    const Container &b = Expanded(rhs, rhs_buffer);
+    if (a.kind_ == Kind::kBitmap && b.kind_ == Kind::kBitmap)
+      return Bitwise(a.words_.data(), b.words_.data(),
+                     [](std::uint64_t x, std::uint64_t y) { return x & ~y; });
+    if (a.kind_ == Kind::kBitmap) {
+      Container result = a;
+      std::uint64_t *words = result.words_.data();
+      for (std::uint16_t value : b.values_) {
+        std::uint64_t bit = std::uint64_t(1) << (value % kBits);
+        result.cardinality_ -= (words[value / kBits] & bit) != 0;
+        words[value / kBits] &= ~bit;
+      }
+      Normalize(result);
+      return result;
+    }
+    std::uint16_t result[kArrayMax];
+    size_type count = 0;
+    if (b.kind_ == Kind::kArray) {
+      count = static_cast<size_type>(
+          std::set_difference(a.values_.begin(), a.values_.end(),
+                              b.values_.begin(), b.values_.end(), result) -
+          result);
+    } else {
+      for (std::uint16_t value : a.values_)
+        if (!TestBit(b.words_.data(), value)) result[count++] = value;
+    }
+    return ArrayOf(result, count);
+  }
+
+  static Container Combine(const Container &lhs, const Container &rhs,
+                           Operation operation) {
+    switch (operation) {
+      case Operation::kUnion:
+        return Unite(lhs, rhs);
+      case Operation::kIntersection:
+        return Intersect(lhs, rhs);
+      case Operation::kDifference:
+        return Subtract(lhs, rhs);
+    }
+    return Container();
+  }
+
+  // Добавляет в конец непустой контейнер с ключом key
+  void Append(std::uint16_t key, Container &&container) {
+    if (container.cardinality_ == 0) return;
+    size_ += container.cardinality_;
+    containers_.push_back(std::move(container));
+    keys_.push_back(key);
+  }
+
+  // Операция над множествами: слияние упорядоченных списков ключей
+  static roaring_set Combine(const roaring_set &lhs, const roaring_set &rhs,
+                             Operation operation) {
+    roaring_set result;
+    const std::uint16_t *lhs_keys = lhs.keys_.data();
+    const std::uint16_t *rhs_keys = rhs.keys_.data();
+    const Container *lhs_containers = lhs.containers_.data();
+    const Container *rhs_containers = rhs.containers_.data();
+    bool keep_lhs = operation != Operation::kIntersection;
+    bool keep_rhs = operation == Operation::kUnion;
+    size_type i = 0;
+    size_type j = 0;
+    while (i < lhs.keys_.size() && j < rhs.keys_.size()) {
+      if (lhs_keys[i] < rhs_keys[j]) {
+        if (keep_lhs) result.Append(lhs_keys[i], Container(lhs_containers[i]));
+        ++i;
+      } else if (rhs_keys[j] < lhs_keys[i]) {
+        if (keep_rhs) result.Append(rhs_keys[j], Container(rhs_containers[j]));
+        ++j;
+      } else {
+        result.Append(lhs_keys[i], Combine(lhs_containers[i],
+                                           rhs_containers[j], operation));
+        ++i;
+        ++j;
+      }
+    }
+    for (; keep_lhs && i < lhs.keys_.size(); ++i)
+      result.Append(lhs_keys[i], Container(lhs_containers[i]));
+    for (; keep_rhs && j < rhs.keys_.size(); ++j)
+      result.Append(rhs_keys[j], Container(rhs_containers[j]));
+    return result;
+  }
+
+  // Сериализация
+
+  [[noreturn]] static void Fail(const char *reason) {
+    throw std::invalid_argument(std::string("s21::roaring_set::deserialize: ") +
+                                reason);
+  }
+
+  static void Put(std::vector<std::uint8_t> &out, std::uint64_t value,
+                  unsigned bytes) {
+    for (unsigned i = 0; i < bytes; ++i)
+      out.push_back(static_cast<std::uint8_t>(value >> (8U * i)));
+  }
+
+  struct Reader {
+    std::uint64_t Get(unsigned bytes) {
+      if (size_ - offset_ < bytes) Fail("truncated input");
+      std::uint64_t value = 0;
+      for (unsigned i = 0; i < bytes; ++i)
+        value |= std::uint64_t(data_[offset_ + i]) << (8U * i);
+      offset_ += bytes;
+      return value;
+    }
+
+    const std::uint8_t *data_;
+    size_type size_;
+    size_type offset_;
+  };
+
+  // Читает и проверяет контейнер: значения возрастают, серии максимальны и
+  // не выходят за блок, число элементов совпадает с содержимым
+  static Container ReadContainer(Reader &reader) {
+    Container container;
+    std::uint64_t kind = reader.Get(1U);
+    std::uint64_t cardinality = reader.Get(4U);
+    if (cardinality == 0 || cardinality > kChunk) Fail("bad cardinality");
+    container.cardinality_ = static_cast<std::uint32_t>(cardinality);
+    if (kind == static_cast<std::uint8_t>(Kind::kArray)) {
+      if (cardinality > kArrayMax) Fail("array container is too large");
+      container.values_ = s21::vector<std::uint16_t>(cardinality);
+      std::uint16_t *values = container.values_.data();
+      for (size_type i = 0; i < cardinality; ++i) {
+        values[i] = static_cast<std::uint16_t>(reader.Get(2U));
+        if (i != 0 && values[i] <= values[i - 1U]) Fail("unsorted array");
+      }
+    } else if (kind == static_cast<std::uint8_t>(Kind::kBitmap)) {
+      container.kind_ = Kind::kBitmap;
+      container.words_ = s21::vector<std::uint64_t>(kBitmapWords);
+      std::uint64_t ones = 0;
+      for (std::uint64_t &word : container.words_) {
+        word = reader.Get(8U);
+        ones += detail::PopCount(word);
+      }
+      if (ones != cardinality) Fail("bitmap cardinality mismatch");
+      Normalize(container);
+    } else if (kind == static_cast<std::uint8_t>(Kind::kRun)) {
+      container.kind_ = Kind::kRun;
+      size_type runs = static_cast<size_type>(reader.Get(2U));
+      container.values_ = s21::vector<std::uint16_t>(2U * runs);
+      std::uint16_t *values = container.values_.data();
+      std::uint64_t ones = 0;
+      for (size_type run = 0; run < runs; ++run) {
+        values[2U * run] = static_cast<std::uint16_t>(reader.Get(2U));
+        values[2U * run + 1U] = static_cast<std::uint16_t>(reader.Get(2U));
+        if (RunLast(container, run) >= kChunk) Fail("run exceeds the block");
+        if (run != 0 &&
+            RunStart(container, run) <= RunLast(container, run - 1U) + 1U)
+          Fail("runs are unsorted or adjacent");
+        ones += values[2U * run + 1U] + 1U;
+      }
+      if (ones != cardinality) Fail("run cardinality mismatch");
+    } else {
+      Fail("unknown container kind");
+    }
+    return container;
+  }
+
+  struct RoaringSetIterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = roaring_set::value_type;
+    using reference = roaring_set::value_type;
+    using pointer = void;
+
+    RoaringSetIterator() noexcept
+        : owner_(nullptr), index_(0), position_(kEnd) {}
+
+    RoaringSetIterator(const roaring_set *owner, size_type index,
+                       std::uint64_t position) noexcept
+        : owner_(owner), index_(index), position_(position) {}
+
+    reference operator*() const noexcept {
+      return static_cast<value_type>(position_);
+    }
+
+    RoaringSetIterator &operator++() noexcept {
+      *this = owner_->Seek(
+          index_, (static_cast<std::uint32_t>(position_) & kLowMask) + 1U);
+      return *this;
+    }
+
+    RoaringSetIterator operator++(int) noexcept {
+      RoaringSetIterator tmp{*this};
+      ++(*this);
+      return tmp;
+    }
+
+    RoaringSetIterator &operator--() noexcept {
+      *this = owner_->Previous(*this);
+      return *this;
+    }
+
+    RoaringSetIterator operator--(int) noexcept {
+      RoaringSetIterator tmp{*this};
+      --(*this);
+      return tmp;
+    }
+
+    bool operator==(const RoaringSetIterator &other) const noexcept {
+      return position_ == other.position_;
+    }
+
+    bool operator!=(const RoaringSetIterator &other) const noexcept {
+      return position_ != other.position_;
+    }
+
+    const roaring_set *owner_;
+    size_type index_;         // Номер контейнера, keys_.size() - end().
+    std::uint64_t position_;  // Значение элемента, kEnd - end().
+  };
+
+  s21::vector<std::uint16_t> keys_;  // Старшие 16 битов блоков, по возрастанию.
+  s21::vector<Container> containers_;  // Контейнеры блоков keys_.
+  size_type size_ = 0;
+};
+
+}  // namespace s21
+
+#endif
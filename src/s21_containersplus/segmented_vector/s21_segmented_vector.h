@@ -0,0 +1,340 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_SEGMENTED_VECTOR_S21_SEGMENTED_VECTOR_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_SEGMENTED_VECTOR_S21_SEGMENTED_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "../../s21_containers/vector/s21_vector.h"
+#include "../iterator/s21_index_iterator.h"
+
+namespace s21 {
+namespace detail {
+
+// Примерный размер одного куска segmented_vector в байтах
+inline constexpr std::size_t kSegmentedChunkBytes = 64U * 1024U;
+
+// Наибольшая степень двойки элементов T, помещающаяся в
+// kSegmentedChunkBytes (но не меньше одного элемента)
+template <class T>
+constexpr std::size_t SegmentedChunkSize() noexcept {
+  std::size_t count = 1;
+  while (count * 2U * sizeof(T) <= kSegmentedChunkBytes) count *= 2U;
+  return count;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Вектор из кусков фиксированного размера: рост без перемещения
+ * элементов и постоянные ссылки на них.
+ *
+ * @details Элементы лежат в кусках по ChunkSize штук, адреса кусков - в
+ * небольшом каталоге (s21::vector указателей). Элемент i находится в куске
+ * i >> log2(ChunkSize) на позиции i & (ChunkSize - 1), так что доступ по
+ * индексу - O(1) без деления. При росте выделяется только новый кусок, а
+ * копируется лишь каталог, поэтому в отличие от s21::vector элементы
+ * никогда не перемещаются, а пиковая память при добавлении в конец -
+ * данные плюс один кусок, а не старый и новый буферы одновременно.
+ *
+ * Ссылки, указатели и итераторы на элементы остаются действительными до
+ * удаления самих элементов (pop_back(), resize(), clear()). Внутри куска
+ * элементы лежат подряд: chunk_data() и chunk_size() отдают кусок целиком,
+ * и куски можно обрабатывать независимо, например в thread_pool::
+ * parallel_for по chunk_count().
+ *
+ * @tparam T Тип элемента
+ * @tparam ChunkSize Число элементов в куске, степень двойки (по умолчанию
+ * кусок занимает не больше 64 КБ)
+ */
+template <class T, std::size_t ChunkSize = detail::SegmentedChunkSize<T>()>
+class segmented_vector {
+  static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0,
+                "s21::segmented_vector: ChunkSize must be a power of two");
+
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using iterator = detail::index_iterator<segmented_vector, false>;
+  using const_iterator = detail::index_iterator<segmented_vector, true>;
+  using size_type = std::size_t;
+
+  // Число элементов в одном куске
+  static constexpr size_type chunk_capacity = ChunkSize;
+
+  segmented_vector() = default;
+
+  /**
+   * @brief count value-инициализированных элементов.
+   */
+  explicit segmented_vector(size_type count) : segmented_vector() {
+    resize(count);
+  }
+
+  segmented_vector(size_type count, const_reference value)
+      : segmented_vector() {
+    resize(count, value);
+  }
+
+  segmented_vector(std::initializer_list<value_type> const &items)
+      : segmented_vector() {
+    reserve(items.size());
+    for (const value_type &item : items) emplace_back(item);
+  }
+
+  segmented_vector(const segmented_vector &other) : segmented_vector() {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; ++i) emplace_back(other[i]);
+  }
+
+  segmented_vector(segmented_vector &&other) noexcept : segmented_vector() {
+    swap(other);
+  }
+
+  segmented_vector &operator=(const segmented_vector &other) {
+    if (this != &other) {
+      segmented_vector tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  segmented_vector &operator=(segmented_vector &&other) noexcept {
+    if (this != &other) {
+      segmented_vector tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ~segmented_vector() {
+    clear();
+    ReleaseChunks(0);
+  }
+
+ public:
+  reference operator[](size_type pos) noexcept { return *Slot(pos); }
+
+  const_reference operator[](size_type pos) const noexcept {
+    return *Slot(pos);
+  }
+
+  /**
+   * @throw std::out_of_range если pos >= size()
+   */
+  reference at(size_type pos) {
+    if (pos >= size_)
+      throw std::out_of_range("s21::segmented_vector::at: pos >= size()");
+    return *Slot(pos);
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range("s21::segmented_vector::at: pos >= size()");
+    return *Slot(pos);
+  }
+
+  reference front() noexcept { return *Slot(0); }
+  const_reference front() const noexcept { return *Slot(0); }
+  reference back() noexcept { return *Slot(size_ - 1U); }
+  const_reference back() const noexcept { return *Slot(size_ - 1U); }
+
+ public:
+  iterator begin() noexcept { return iterator(this, 0); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, size_); }
+  const_iterator end() const noexcept { return const_iterator(this, size_); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) /
+           ChunkSize * ChunkSize;
+  }
+
+  /**
+   * @brief Число элементов, которые поместятся в уже выделенные куски.
+   */
+  size_type capacity() const noexcept { return chunks_.size() * ChunkSize; }
+
+  /**
+   * @brief Выделяет куски под count элементов. Элементы не перемещаются.
+   *
+   * @throw std::length_error если count > max_size()
+   */
+  void reserve(size_type count) {
+    if (count > max_size())
+      throw std::length_error(
+          "s21::segmented_vector::reserve: count is larger than max_size()");
+    size_type needed = ChunksFor(count);
+    if (needed <= chunks_.size()) return;
+    chunks_.reserve(needed);
+    while (chunks_.size() < needed) AddChunk();
+  }
+
+  /**
+   * @brief Освобождает куски, в которых нет элементов.
+   */
+  void shrink_to_fit() {
+    ReleaseChunks(ChunksFor(size_));
+    chunks_.shrink_to_fit();
+  }
+
+  /**
+   * @brief Число кусков, в которых есть элементы.
+   */
+  size_type chunk_count() const noexcept { return ChunksFor(size_); }
+
+  /**
+   * @brief Начало куска index (index < chunk_count()): chunk_size(index)
+   * элементов подряд.
+   */
+  pointer chunk_data(size_type index) noexcept {
+    return chunks_.data()[index];
+  }
+
+  const_pointer chunk_data(size_type index) const noexcept {
+    return chunks_.data()[index];
+  }
+
+  /**
+   * @brief Число элементов в куске index: ChunkSize во всех, кроме
+   * последнего.
+   */
+  size_type chunk_size(size_type index) const noexcept {
+    return index + 1U < chunk_count() ? ChunkSize
+                                      : size_ - index * ChunkSize;
+  }
+
+  /**
+   * @brief Вызывает fn(first, last) для каждого куска по порядку.
+   */
+  template <class Fn>
+  void for_each_chunk(Fn &&fn) {
+    for (size_type i = 0, count = chunk_count(); i < count; ++i)
+      fn(chunk_data(i), chunk_data(i) + chunk_size(i));
+  }
+
+  template <class Fn>
+  void for_each_chunk(Fn &&fn) const {
+    for (size_type i = 0, count = chunk_count(); i < count; ++i)
+      fn(chunk_data(i), chunk_data(i) + chunk_size(i));
+  }
+
+ public:
+  /**
+   * @brief Удаляет все элементы; выделенные куски сохраняются.
+   */
+  void clear() noexcept {
+    while (size_ > 0) pop_back();
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  /**
+   * @brief Создает элемент из args в конце. Если все куски заполнены,
+   * выделяет новый; остальные элементы не перемещаются.
+   *
+   * @return Ссылка на новый элемент
+   */
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity()) {
+      if (size_ >= max_size())
+        throw std::length_error(
+            "s21::segmented_vector::emplace_back: size() is max_size()");
+      AddChunk();
+    }
+    pointer slot = Slot(size_);
+    ::new (static_cast<void *>(slot)) value_type(std::forward<Args>(args)...);
+    ++size_;
+    return *slot;
+  }
+
+  void pop_back() noexcept {
+    --size_;
+    Slot(size_)->~value_type();
+  }
+
+  /**
+   * @brief Изменяет размер до count: лишние элементы удаляются, новые
+   * value-инициализируются.
+   */
+  void resize(size_type count) {
+    reserve(count);
+    while (size_ > count) pop_back();
+    while (size_ < count) emplace_back();
+  }
+
+  void resize(size_type count, const_reference value) {
+    reserve(count);
+    while (size_ > count) pop_back();
+    while (size_ < count) emplace_back(value);
+  }
+
+  void swap(segmented_vector &other) noexcept {
+    chunks_.swap(other.chunks_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  using allocator_type = std::allocator<value_type>;
+  using allocator_traits = std::allocator_traits<allocator_type>;
+
+  static constexpr size_type kShift = [] {
+    size_type shift = 0;
+    while ((size_type{1} << shift) < ChunkSize) ++shift;
+    return shift;
+  }();
+  static constexpr size_type kMask = ChunkSize - 1U;
+
+  static constexpr size_type ChunksFor(size_type count) noexcept {
+    return (count >> kShift) + ((count & kMask) != 0 ? 1U : 0U);
+  }
+
+  pointer Slot(size_type pos) const noexcept {
+    return chunks_.data()[pos >> kShift] + (pos & kMask);
+  }
+
+  // Место в каталоге занимается до выделения куска, чтобы кусок не
+  // потерялся, если каталог не сможет вырасти
+  void AddChunk() {
+    chunks_.push_back(nullptr);
+    allocator_type allocator;
+    try {
+      chunks_.data()[chunks_.size() - 1U] =
+          allocator_traits::allocate(allocator, ChunkSize);
+    } catch (...) {
+      chunks_.pop_back();
+      throw;
+    }
+  }
+
+  // Освобождает куски с номера first; элементов в них быть не должно
+  void ReleaseChunks(size_type first) noexcept {
+    allocator_type allocator;
+    while (chunks_.size() > first) {
+      allocator_traits::deallocate(allocator,
+                                   chunks_.data()[chunks_.size() - 1U],
+                                   ChunkSize);
+      chunks_.pop_back();
+    }
+  }
+
+  s21::vector<pointer> chunks_;  // Адреса кусков по порядку.
+  size_type size_ = 0;           // Число элементов.
+};
+
+}  // namespace s21
+
+#endif
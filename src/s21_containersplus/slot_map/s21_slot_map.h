@@ -0,0 +1,290 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_SLOT_MAP_S21_SLOT_MAP_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_SLOT_MAP_S21_SLOT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../../s21_containers/policy/s21_storage_policy.h"
+#include "../../s21_containers/vector/s21_vector.h"
+
+namespace s21 {
+
+/**
+ * @brief Контейнер с постоянными ключами-дескрипторами: вставка, удаление
+ * и доступ по ключу за O(1), значения лежат в памяти подряд.
+ *
+ * @details Значения хранятся плотным массивом, поэтому обход - проход по
+ * s21::vector. Ключ - номер ячейки таблицы слотов и поколение: слот хранит
+ * текущую позицию значения в плотном массиве, а обратный массив - номер
+ * слота для каждой позиции. При удалении на место удаленного значения
+ * переносится последнее (меняется его позиция, но не ключ), а поколение
+ * слота увеличивается, и старые ключи перестают находить значение, даже
+ * когда слот занят снова.
+ *
+ * Ключи остаются действительными до удаления их значения, а указатели и
+ * итераторы на значения - как у s21::vector: до вставки или удаления.
+ * Порядок обхода не совпадает с порядком вставки.
+ *
+ * Поколение 32-битное: ключ, сохраненный через 2^32 повторных
+ * использований того же слота, снова станет действительным.
+ *
+ * @tparam T Тип значения (должен допускать присваивание перемещением)
+ * @tparam Storage Политика хранения массива значений (см. vector_policy)
+ */
+template <class T, class Storage = vector_policy<>>
+class slot_map {
+ public:
+  /**
+   * @brief Дескриптор значения: номер слота и его поколение.
+   */
+  struct key {
+    std::uint32_t index;
+    std::uint32_t generation;
+
+    bool operator==(const key &other) const noexcept {
+      return index == other.index && generation == other.generation;
+    }
+
+    bool operator!=(const key &other) const noexcept {
+      return !(*this == other);
+    }
+  };
+
+  using key_type = key;
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename s21::vector<T, Storage>::iterator;
+  using const_iterator = typename s21::vector<T, Storage>::const_iterator;
+  using size_type = std::size_t;
+
+  slot_map() = default;
+
+  slot_map(std::initializer_list<value_type> const &items) : slot_map() {
+    reserve(items.size());
+    for (const value_type &item : items) insert(item);
+  }
+
+  slot_map(const slot_map &other) = default;
+
+  slot_map(slot_map &&other) noexcept : slot_map() { swap(other); }
+
+  slot_map &operator=(const slot_map &other) = default;
+
+  slot_map &operator=(slot_map &&other) noexcept {
+    if (this != &other) {
+      slot_map tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ~slot_map() = default;
+
+ public:
+  iterator begin() noexcept { return values_.begin(); }
+  const_iterator begin() const noexcept { return values_.begin(); }
+  iterator end() noexcept { return values_.end(); }
+  const_iterator end() const noexcept { return values_.end(); }
+
+  /**
+   * @brief Значения подряд в памяти, size() штук.
+   */
+  value_type *data() noexcept { return values_.data(); }
+  const value_type *data() const noexcept { return values_.data(); }
+
+  bool empty() const noexcept { return values_.empty(); }
+
+  size_type size() const noexcept { return values_.size(); }
+
+  size_type max_size() const noexcept {
+    return std::min<size_type>(kNoSlot, values_.max_size());
+  }
+
+  size_type capacity() const noexcept { return values_.capacity(); }
+
+  void reserve(size_type count) {
+    if (count > max_size())
+      throw std::length_error(
+          "s21::slot_map::reserve: count is larger than max_size()");
+    values_.reserve(count);
+    slot_of_.reserve(count);
+    slots_.reserve(count);
+  }
+
+  /**
+   * @brief Удаляет все значения. Все выданные ключи становятся
+   * недействительными, емкость сохраняется.
+   */
+  void clear() noexcept {
+    for (size_type i = 0; i < values_.size(); ++i)
+      Release(slot_of_.data()[i]);
+    values_.clear();
+    slot_of_.clear();
+  }
+
+  key insert(const value_type &value) { return emplace(value); }
+
+  key insert(value_type &&value) { return emplace(std::move(value)); }
+
+  /**
+   * @brief Создает значение из args в конце плотного массива.
+   *
+   * @return Ключ нового значения
+   * @throw std::length_error если занято max_size() слотов
+   */
+  template <class... Args>
+  key emplace(Args &&...args) {
+    if (free_head_ == kNoSlot) {
+      if (slots_.size() >= max_size())
+        throw std::length_error("s21::slot_map::emplace: too many slots");
+      // Новый слот сразу попадает в список свободных: если создание
+      // значения бросит исключение, он просто останется свободным
+      slots_.push_back(Slot{kNoSlot, 0});
+      free_head_ = static_cast<std::uint32_t>(slots_.size() - 1U);
+    }
+    values_.emplace_back(std::forward<Args>(args)...);
+    try {
+      slot_of_.push_back(free_head_);
+    } catch (...) {
+      values_.pop_back();
+      throw;
+    }
+    std::uint32_t index = free_head_;
+    Slot &slot = slots_.data()[index];
+    free_head_ = slot.position;
+    slot.position = static_cast<std::uint32_t>(values_.size() - 1U);
+    return key{index, slot.generation};
+  }
+
+  /**
+   * @brief Удаляет значение по ключу; на его место переносится последнее.
+   *
+   * @return 1, если значение было, иначе 0
+   */
+  size_type erase(const key &k) {
+    if (!contains(k)) return 0;
+    EraseAt(slots_.data()[k.index].position);
+    return 1;
+  }
+
+  /**
+   * @brief Удаляет значение по итератору.
+   *
+   * @return Итератор на ту же позицию: теперь там бывшее последнее значение
+   * (или end())
+   */
+  iterator erase(const_iterator pos) {
+    size_type position = static_cast<size_type>(pos - values_.begin());
+    EraseAt(static_cast<std::uint32_t>(position));
+    return values_.begin() + position;
+  }
+
+  void swap(slot_map &other) noexcept {
+    values_.swap(other.values_);
+    slot_of_.swap(other.slot_of_);
+    slots_.swap(other.slots_);
+    std::swap(free_head_, other.free_head_);
+  }
+
+ public:
+  bool contains(const key &k) const noexcept {
+    return k.index < slots_.size() &&
+           slots_.data()[k.index].generation == k.generation &&
+           slots_.data()[k.index].position < values_.size() &&
+           slot_of_.data()[slots_.data()[k.index].position] == k.index;
+  }
+
+  iterator find(const key &k) noexcept {
+    return contains(k) ? values_.begin() + slots_.data()[k.index].position
+                       : end();
+  }
+
+  const_iterator find(const key &k) const noexcept {
+    return contains(k) ? values_.begin() + slots_.data()[k.index].position
+                       : end();
+  }
+
+  /**
+   * @throw std::out_of_range если ключ недействителен
+   */
+  reference at(const key &k) {
+    if (!contains(k))
+      throw std::out_of_range("s21::slot_map::at: key is not valid");
+    return values_.data()[slots_.data()[k.index].position];
+  }
+
+  const_reference at(const key &k) const {
+    if (!contains(k))
+      throw std::out_of_range("s21::slot_map::at: key is not valid");
+    return values_.data()[slots_.data()[k.index].position];
+  }
+
+  /**
+   * @brief Доступ без проверки; ключ должен быть действительным.
+   */
+  reference operator[](const key &k) noexcept {
+    return values_.data()[slots_.data()[k.index].position];
+  }
+
+  const_reference operator[](const key &k) const noexcept {
+    return values_.data()[slots_.data()[k.index].position];
+  }
+
+  /**
+   * @brief Ключ значения, на которое указывает pos.
+   */
+  key key_of(const_iterator pos) const noexcept {
+    std::uint32_t index = slot_of_.data()[pos - values_.begin()];
+    return key{index, slots_.data()[index].generation};
+  }
+
+ private:
+  static constexpr std::uint32_t kNoSlot =
+      std::numeric_limits<std::uint32_t>::max();
+
+  struct Slot {
+    // Позиция значения в values_; у свободного слота - следующий свободный
+    // слот или kNoSlot
+    std::uint32_t position;
+    std::uint32_t generation;
+  };
+
+  // Делает слот свободным и недействительным для выданных ключей
+  void Release(std::uint32_t index) noexcept {
+    Slot &slot = slots_.data()[index];
+    ++slot.generation;
+    slot.position = free_head_;
+    free_head_ = index;
+  }
+
+  // Слот освобождается последним: если перенос значения бросит исключение,
+  // таблица слотов останется согласованной
+  void EraseAt(std::uint32_t position) {
+    std::uint32_t last = static_cast<std::uint32_t>(values_.size() - 1U);
+    std::uint32_t erased = slot_of_.data()[position];
+    if (position != last) {
+      values_.data()[position] = std::move(values_.data()[last]);
+      std::uint32_t moved = slot_of_.data()[last];
+      slot_of_.data()[position] = moved;
+      slots_.data()[moved].position = position;
+    }
+    values_.pop_back();
+    slot_of_.pop_back();
+    Release(erased);
+  }
+
+  s21::vector<T, Storage> values_;      // Значения подряд.
+  s21::vector<std::uint32_t> slot_of_;  // Слот значения values_[i].
+  s21::vector<Slot> slots_;             // Позиции значений по ключам.
+  std::uint32_t free_head_ = kNoSlot;   // Первый свободный слот.
+};
+
+}  // namespace s21
+
+#endif
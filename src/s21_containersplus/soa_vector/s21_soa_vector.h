@@ -0,0 +1,379 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_SOA_VECTOR_S21_SOA_VECTOR_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_SOA_VECTOR_S21_SOA_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../../s21_containers/policy/s21_storage_policy.h"
+#include "../../s21_containers/vector/s21_vector.h"
+#include "../iterator/s21_index_iterator.h"
+
+namespace s21 {
+
+/**
+ * @brief Непрерывный диапазон элементов одного столбца soa_vector (аналог
+ * std::span из C++20).
+ *
+ * @details Остается действительным до изменения размера или емкости
+ * soa_vector.
+ *
+ * @tparam T Тип элемента (const T - только для чтения)
+ */
+template <class T>
+class column_span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using iterator = T *;
+
+  constexpr column_span() noexcept : data_(nullptr), size_(0) {}
+  constexpr column_span(T *data, size_type size) noexcept
+      : data_(data), size_(size) {}
+
+  constexpr T *data() const noexcept { return data_; }
+  constexpr size_type size() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+  constexpr iterator begin() const noexcept { return data_; }
+  constexpr iterator end() const noexcept { return data_ + size_; }
+  constexpr T &operator[](size_type pos) const noexcept { return data_[pos]; }
+
+ private:
+  T *data_;
+  size_type size_;
+};
+
+/**
+ * @brief Вектор записей, поля которых хранятся по столбцам (structure of
+ * arrays).
+ *
+ * @details Каждое поле лежит в своем s21::vector, поэтому проход по одному
+ * или двум полям читает из памяти только их, а не записи целиком, и
+ * компилятор может векторизовать цикл по column<I>(). Все столбцы растут
+ * одновременно по стратегии роста vector_policy, так что их емкости
+ * совпадают и добавление в конец перевыделяет память не чаще, чем
+ * s21::vector.
+ *
+ * Строка возвращается прокси-ссылкой std::tuple<Fields &...>: ее поля
+ * можно читать и изменять (в том числе через структурные привязки), а
+ * преобразование к value_type копирует строку.
+ *
+ * @tparam Fields Типы полей записи
+ */
+template <class... Fields>
+class soa_vector {
+  static_assert(sizeof...(Fields) > 0,
+                "s21::soa_vector requires at least one field");
+
+ public:
+  using value_type = std::tuple<Fields...>;
+  using reference = std::tuple<Fields &...>;
+  using const_reference = std::tuple<const Fields &...>;
+  using iterator = detail::index_iterator<soa_vector, false>;
+  using const_iterator = detail::index_iterator<soa_vector, true>;
+  using size_type = std::size_t;
+
+  template <std::size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+  soa_vector() = default;
+
+  /**
+   * @brief count строк из value-инициализированных полей.
+   */
+  explicit soa_vector(size_type count) : columns_(MakeColumns(count, Seq())) {}
+
+  soa_vector(std::initializer_list<value_type> const &rows) : soa_vector() {
+    reserve(rows.size());
+    for (const value_type &row : rows) std::apply(PushBack{*this}, row);
+  }
+
+  soa_vector(const soa_vector &other) = default;
+
+  soa_vector(soa_vector &&other) noexcept : soa_vector() { swap(other); }
+
+  soa_vector &operator=(const soa_vector &other) = default;
+
+  soa_vector &operator=(soa_vector &&other) noexcept {
+    if (this != &other) {
+      soa_vector tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ~soa_vector() = default;
+
+ public:
+  reference operator[](size_type pos) noexcept { return Row(pos, Seq()); }
+
+  const_reference operator[](size_type pos) const noexcept {
+    return Row(pos, Seq());
+  }
+
+  /**
+   * @throw std::out_of_range если pos >= size()
+   */
+  reference at(size_type pos) {
+    if (pos >= size())
+      throw std::out_of_range("s21::soa_vector::at: pos >= size()");
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size())
+      throw std::out_of_range("s21::soa_vector::at: pos >= size()");
+    return (*this)[pos];
+  }
+
+  /**
+   * @brief Поле I строки pos.
+   */
+  template <std::size_t I>
+  field_type<I> &get(size_type pos) noexcept {
+    return std::get<I>(columns_).data()[pos];
+  }
+
+  template <std::size_t I>
+  const field_type<I> &get(size_type pos) const noexcept {
+    return std::get<I>(columns_).data()[pos];
+  }
+
+  /**
+   * @brief Столбец поля I: size() элементов подряд в памяти.
+   */
+  template <std::size_t I>
+  column_span<field_type<I>> column() noexcept {
+    return {std::get<I>(columns_).data(), size()};
+  }
+
+  template <std::size_t I>
+  column_span<const field_type<I>> column() const noexcept {
+    return {std::get<I>(columns_).data(), size()};
+  }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+  const_iterator begin() const noexcept { return const_iterator(this, 0); }
+  iterator end() noexcept { return iterator(this, size()); }
+  const_iterator end() const noexcept { return const_iterator(this, size()); }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept { return std::get<0>(columns_).size(); }
+
+  size_type capacity() const noexcept {
+    return std::get<0>(columns_).capacity();
+  }
+
+  /**
+   * @brief Увеличивает емкость всех столбцов до count.
+   *
+   * @details Новые столбцы выделяются и заполняются целиком до замены
+   * старых, поэтому при исключении вектор не меняется и емкости столбцов
+   * остаются равными.
+   */
+  void reserve(size_type count) {
+    if (count > capacity()) Rebuild(count, size(), size());
+  }
+
+  /**
+   * @brief Уменьшает емкость всех столбцов до size(); как и reserve(), при
+   * исключении оставляет вектор без изменений.
+   */
+  void shrink_to_fit() {
+    if (capacity() > size()) Rebuild(size(), size(), size());
+  }
+
+  void clear() noexcept {
+    std::apply([](auto &...column) { (column.clear(), ...); }, columns_);
+  }
+
+  void push_back(const Fields &...values) { emplace_back(values...); }
+
+  /**
+   * @brief Добавляет строку; аргумент i передается конструктору поля i.
+   */
+  template <class... Args>
+  void emplace_back(Args &&...args) {
+    static_assert(sizeof...(Args) == sizeof...(Fields),
+                  "s21::soa_vector::emplace_back: one argument per field");
+    if (size() == capacity()) {
+      // Строка собирается до перевыделения: аргументы могут ссылаться на
+      // поля этого же вектора
+      value_type row(std::forward<Args>(args)...);
+      reserve(growth_type::next(capacity(), size() + 1U));
+      std::apply(
+          [this](Fields &...fields) {
+            EmplaceBack(Seq(), std::move(fields)...);
+          },
+          row);
+    } else {
+      EmplaceBack(Seq(), std::forward<Args>(args)...);
+    }
+  }
+
+  void pop_back() noexcept {
+    std::apply([](auto &...column) { (column.pop_back(), ...); }, columns_);
+  }
+
+  /**
+   * @brief Изменяет число строк; новые поля value-инициализируются.
+   */
+  void resize(size_type count) {
+    size_type old_size = size();
+    if (count > capacity()) reserve(growth_type::next(capacity(), count));
+    try {
+      std::apply([count](auto &...column) { (column.resize(count), ...); },
+                 columns_);
+    } catch (...) {
+      // Столбцы, которые успели вырасти, возвращаются к старому размеру
+      std::apply(
+          [old_size](auto &...column) {
+            (column.resize(std::min(old_size, column.size())), ...);
+          },
+          columns_);
+      throw;
+    }
+  }
+
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+  /**
+   * @brief Удаляет строки [first, last); хвост каждого столбца сдвигается
+   * один раз.
+   *
+   * @details Если перемещающее присваивание какого-то поля может бросить
+   * исключение, столбцы не сдвигаются на месте, а собираются заново без
+   * удаляемых строк: иначе исключение в одном столбце оставило бы столбцы
+   * разной длины.
+   */
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type from = first.index_;
+    size_type to = last.index_;
+    if (from > to || to > size())
+      throw std::out_of_range(
+          "s21::soa_vector::erase: range is out of begin() to end()");
+    if constexpr ((std::is_nothrow_move_assignable_v<Fields> && ...)) {
+      std::apply(
+          [from, to](auto &...column) {
+            (column.erase(column.begin() + from, column.begin() + to), ...);
+          },
+          columns_);
+    } else if (from != to) {
+      Rebuild(capacity(), from, to);
+    }
+    return iterator(this, from);
+  }
+
+  void swap(soa_vector &other) noexcept { Swap(other.columns_, Seq()); }
+
+ private:
+  using Seq = std::index_sequence_for<Fields...>;
+  using growth_type = typename vector_policy<>::growth_type;
+  using Columns = std::tuple<s21::vector<Fields>...>;
+
+  // Вызывает push_back с полями кортежа через std::apply
+  struct PushBack {
+    soa_vector &self;
+    void operator()(const Fields &...values) const {
+      self.push_back(values...);
+    }
+  };
+
+  template <std::size_t... I>
+  static Columns MakeColumns(size_type count, std::index_sequence<I...>) {
+    return Columns(s21::vector<Fields>((static_cast<void>(I), count))...);
+  }
+
+  template <std::size_t... I>
+  reference Row(size_type pos, std::index_sequence<I...>) noexcept {
+    return reference(std::get<I>(columns_).data()[pos]...);
+  }
+
+  template <std::size_t... I>
+  const_reference Row(size_type pos, std::index_sequence<I...>) const noexcept {
+    return const_reference(std::get<I>(columns_).data()[pos]...);
+  }
+
+  template <std::size_t... I>
+  void Swap(Columns &other, std::index_sequence<I...>) noexcept {
+    (std::get<I>(columns_).swap(std::get<I>(other)), ...);
+  }
+
+  // Поля перемещаются, если это не бросает исключений (или их нельзя
+  // скопировать), иначе копируются - как std::move_if_noexcept
+  template <class T>
+  static constexpr bool kMovesOnRelocate =
+      std::is_nothrow_move_constructible_v<T> ||
+      !std::is_copy_constructible_v<T>;
+
+  // Заменяет столбцы новыми емкости capacity со всеми строками, кроме
+  // [from, to). Новые столбцы заполняются целиком до замены старых, поэтому
+  // при исключении вектор не меняется и столбцы остаются одной длины и
+  // емкости
+  void Rebuild(size_type capacity, size_type from, size_type to) {
+    Columns rebuilt;
+    std::apply(
+        [capacity](auto &...column) { (column.reserve(capacity), ...); },
+        rebuilt);
+    Relocate(rebuilt, from, to, Seq());
+    Swap(rebuilt, Seq());
+  }
+
+  // Переносит строки в пустые столбцы out с достаточной емкостью. Сначала
+  // копируются столбцы, которые нельзя переместить без исключений: если
+  // копирование бросит, исходные столбцы еще не тронуты
+  template <std::size_t... I>
+  void Relocate(Columns &out, size_type from, size_type to,
+                std::index_sequence<I...>) {
+    (RelocateColumn<I, false>(out, from, to), ...);
+    (RelocateColumn<I, true>(out, from, to), ...);
+  }
+
+  template <std::size_t I, bool Move>
+  void RelocateColumn(Columns &out, size_type from, size_type to) {
+    if constexpr (kMovesOnRelocate<field_type<I>> == Move) {
+      auto &column = std::get<I>(columns_);
+      auto &target = std::get<I>(out);
+      auto append = [&target](auto first, auto last) {
+        for (; first != last; ++first) {
+          if constexpr (Move) {
+            target.push_back(std::move(*first));
+          } else {
+            target.push_back(*first);
+          }
+        }
+      };
+      append(column.begin(), column.begin() + from);
+      append(column.begin() + to, column.end());
+    }
+  }
+
+  // Емкость уже достаточна, поэтому исключение может бросить только
+  // конструктор поля; добавленные до него поля удаляются
+  template <std::size_t... I, class... Args>
+  void EmplaceBack(std::index_sequence<I...>, Args &&...args) {
+    std::size_t pushed = 0;
+    try {
+      ((std::get<I>(columns_).push_back(
+            field_type<I>(std::forward<Args>(args))),
+        ++pushed),
+       ...);
+    } catch (...) {
+      ((I < pushed ? std::get<I>(columns_).pop_back() : void()), ...);
+      throw;
+    }
+  }
+
+  Columns columns_;
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,291 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_STATIC_MAP_S21_STATIC_MAP_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_STATIC_MAP_S21_STATIC_MAP_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../s21_containers/map/s21_map.h"
+#include "../../s21_containers/policy/s21_storage_policy.h"
+#include "../../s21_containers/vector/s21_vector.h"
+#include "../static_set/s21_eytzinger.h"
+
+namespace s21 {
+
+/**
+ * @brief Словарь с неизменяемым набором ключей для данных, которые строятся
+ * один раз и дальше только читаются.
+ *
+ * @details Ключи и значения лежат в двух параллельных массивах в порядке
+ * Эйтцингера (см. EytzingerLayout): поиск касается только массива ключей, а
+ * в массив значений обращаемся один раз, уже по найденному индексу. Значения
+ * можно менять через at() и итераторы, ключи - нет.
+ *
+ * Так как пара ключ-значение в памяти не хранится, итератор при
+ * разыменовании возвращает std::pair из ссылок на ключ и значение.
+ *
+ * @tparam Key Тип ключа
+ * @tparam T Тип значения
+ * @tparam Compare Функция сравнения ключей
+ */
+template <class Key, class T, class Compare = std::less<Key>>
+class static_map : private detail::EmptyBaseHolder<Compare> {
+ private:
+  template <bool IsConst>
+  struct StaticMapIterator;
+  using CompareHolder = detail::EmptyBaseHolder<Compare>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = std::pair<const key_type &, mapped_type &>;
+  using const_reference = std::pair<const key_type &, const mapped_type &>;
+  using iterator = StaticMapIterator<false>;
+  using const_iterator = StaticMapIterator<true>;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+
+  static_map() : keys_(), values_(), size_(0U) {}
+
+  /**
+   * @brief Пустой словарь с заданной функцией сравнения ключей.
+   */
+  explicit static_map(const key_compare &comp)
+      : CompareHolder(comp), keys_(), values_(), size_(0U) {}
+
+  /**
+   * @brief Строит словарь из s21::map за O(n) (ключи уже упорядочены).
+   */
+  template <class Storage>
+  explicit static_map(const s21::map<Key, T, Compare, Storage> &other)
+      : CompareHolder(other.key_comp()),
+        keys_(other.size() + 1U),
+        values_(other.size() + 1U),
+        size_(other.size()) {
+    EytzingerLayout::Fill(other.begin(), size_,
+                          [this](size_type k, const value_type &item) {
+                            keys_.data()[k] = item.first;
+                            values_.data()[k] = item.second;
+                          });
+  }
+
+  /**
+   * @brief Строит словарь из диапазона пар ключ-значение. Из элементов с
+   * одинаковым ключом остается первый (как при вставке в s21::map).
+   */
+  template <class InputIt>
+  static_map(InputIt first, InputIt last,
+             const key_compare &comp = key_compare())
+      : static_map(comp) {
+    Build(std::vector<std::pair<key_type, mapped_type>>(first, last));
+  }
+
+  static_map(std::initializer_list<value_type> const &items,
+             const key_compare &comp = key_compare())
+      : static_map(items.begin(), items.end(), comp) {}
+
+  static_map(const static_map &other) = default;
+
+  static_map(static_map &&other) noexcept : static_map() { swap(other); }
+
+  static_map &operator=(const static_map &other) = default;
+
+  static_map &operator=(static_map &&other) noexcept {
+    if (this != &other) {
+      static_map tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ~static_map() = default;
+
+ public:
+  iterator begin() noexcept {
+    return iterator(this, EytzingerLayout::First(size_));
+  }
+
+  const_iterator begin() const noexcept {
+    return const_iterator(this, EytzingerLayout::First(size_));
+  }
+
+  iterator end() noexcept { return iterator(this, 0U); }
+
+  const_iterator end() const noexcept { return const_iterator(this, 0U); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept { return keys_.max_size() - 1U; }
+
+  void swap(static_map &other) noexcept {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(size_, other.size_);
+    std::swap(CompareHolder::Get(), other.CompareHolder::Get());
+  }
+
+  key_compare key_comp() const { return Cmp(); }
+
+ public:
+  /**
+   * @brief Доступ к значению по ключу с проверкой наличия ключа.
+   *
+   * @throw std::out_of_range если ключа нет
+   */
+  mapped_type &at(const key_type &key) {
+    size_type k = FindIndex(key);
+    if (k == 0)
+      throw std::out_of_range(
+          "s21::static_map::at: No element exists with key equivalent to key");
+    return values_.data()[k];
+  }
+
+  const mapped_type &at(const key_type &key) const {
+    return const_cast<static_map *>(this)->at(key);
+  }
+
+  iterator find(const key_type &key) { return iterator(this, FindIndex(key)); }
+
+  const_iterator find(const key_type &key) const {
+    return const_iterator(this, FindIndex(key));
+  }
+
+  bool contains(const key_type &key) const { return FindIndex(key) != 0; }
+
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const key_type &key) {
+    return iterator(this, EytzingerLayout::LowerBound(keys_.data(), size_,
+                                                      key, Cmp()));
+  }
+
+  const_iterator lower_bound(const key_type &key) const {
+    return const_iterator(this, EytzingerLayout::LowerBound(
+                                    keys_.data(), size_, key, Cmp()));
+  }
+
+  iterator upper_bound(const key_type &key) {
+    return iterator(this, EytzingerLayout::UpperBound(keys_.data(), size_,
+                                                      key, Cmp()));
+  }
+
+  const_iterator upper_bound(const key_type &key) const {
+    return const_iterator(this, EytzingerLayout::UpperBound(
+                                    keys_.data(), size_, key, Cmp()));
+  }
+
+ private:
+  const key_compare &Cmp() const noexcept { return CompareHolder::Get(); }
+
+  // Индекс элемента с ключом key или 0, если такого ключа нет
+  size_type FindIndex(const key_type &key) const {
+    size_type k = EytzingerLayout::LowerBound(keys_.data(), size_, key, Cmp());
+    if (k == 0 || Cmp()(key, keys_.data()[k])) return 0;
+    return k;
+  }
+
+  void Build(std::vector<std::pair<key_type, mapped_type>> items) {
+    auto less = [this](const std::pair<key_type, mapped_type> &lhs,
+                       const std::pair<key_type, mapped_type> &rhs) {
+      return Cmp()(lhs.first, rhs.first);
+    };
+    // stable_sort, чтобы из дубликатов остался первый по порядку элемент
+    std::stable_sort(items.begin(), items.end(), less);
+    auto last = std::unique(items.begin(), items.end(),
+                            [&less](const auto &lhs, const auto &rhs) {
+                              return !less(lhs, rhs) && !less(rhs, lhs);
+                            });
+    items.erase(last, items.end());
+
+    s21::vector<key_type> keys(items.size() + 1U);
+    s21::vector<mapped_type> values(items.size() + 1U);
+    EytzingerLayout::Fill(
+        std::make_move_iterator(items.begin()), items.size(),
+        [&keys, &values](size_type k, std::pair<key_type, mapped_type> item) {
+          keys.data()[k] = std::move(item.first);
+          values.data()[k] = std::move(item.second);
+        });
+    keys_.swap(keys);
+    values_.swap(values);
+    size_ = items.size();
+  }
+
+  template <bool IsConst>
+  struct StaticMapIterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = static_map::value_type;
+    using reference = std::conditional_t<IsConst, static_map::const_reference,
+                                         static_map::reference>;
+    using pointer = void;
+    using owner_pointer =
+        std::conditional_t<IsConst, const static_map *, static_map *>;
+
+    StaticMapIterator() = delete;
+
+    StaticMapIterator(owner_pointer owner, size_type index)
+        : owner_(owner), index_(index) {}
+
+    /**
+     * @brief Неконстантный итератор неявно приводится к константному.
+     */
+    template <bool OtherConst,
+              typename = std::enable_if_t<IsConst && !OtherConst>>
+    StaticMapIterator(const StaticMapIterator<OtherConst> &other)
+        : owner_(other.owner_), index_(other.index_) {}
+
+    reference operator*() const noexcept {
+      return reference(owner_->keys_.data()[index_],
+                       owner_->values_.data()[index_]);
+    }
+
+    StaticMapIterator &operator++() noexcept {
+      index_ = EytzingerLayout::Next(index_, owner_->size_);
+      return *this;
+    }
+
+    StaticMapIterator operator++(int) noexcept {
+      StaticMapIterator tmp{*this};
+      ++(*this);
+      return tmp;
+    }
+
+    StaticMapIterator &operator--() noexcept {
+      index_ = EytzingerLayout::Prev(index_, owner_->size_);
+      return *this;
+    }
+
+    StaticMapIterator operator--(int) noexcept {
+      StaticMapIterator tmp{*this};
+      --(*this);
+      return tmp;
+    }
+
+    bool operator==(const StaticMapIterator &other) const noexcept {
+      return index_ == other.index_;
+    }
+
+    bool operator!=(const StaticMapIterator &other) const noexcept {
+      return index_ != other.index_;
+    }
+
+    owner_pointer owner_;  // Словарь, по которому идет итерация.
+    size_type index_;      // Индекс Эйтцингера, 0 - end().
+  };
+
+  s21::vector<key_type> keys_;  // Ключи в порядке Эйтцингера, [0] не исп.
+  s21::vector<mapped_type> values_;  // Значения в том же порядке.
+  size_type size_;
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_STATIC_SET_S21_EYTZINGER_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_STATIC_SET_S21_EYTZINGER_H
+
+#include <cstddef>
+
+namespace s21 {
+
+/**
+ * @brief Вспомогательные функции для раскладки отсортированной
+ * последовательности в порядке Эйтцингера (обход дерева в ширину).
+ *
+ * @details Элементы лежат в массиве с индексами 1..n: у элемента k левый
+ * потомок 2k, правый 2k + 1. Это неявное сбалансированное дерево поиска без
+ * указателей. Первые уровни дерева занимают несколько соседних кэш-линий, а
+ * все 2^d потомков элемента k на глубине d лежат подряд начиная с индекса
+ * k * 2^d. Поэтому спуск можно сделать без ветвлений и заранее загружать
+ * (prefetch) кэш-линию с потомками на несколько уровней вперед.
+ *
+ * Индекс 0 не используется и играет роль end().
+ */
+struct EytzingerLayout {
+  using size_type = std::size_t;
+
+  /**
+   * @brief Раскладывает отсортированную последовательность [first, ...) из n
+   * элементов по индексам Эйтцингера.
+   *
+   * @param first Итератор на начало отсортированной последовательности
+   * @param n Количество элементов
+   * @param assign Функция assign(k, element), записывающая элемент в ячейку k
+   * @return Итератор за последним прочитанным элементом
+   */
+  template <typename InputIt, typename Assign>
+  static InputIt Fill(InputIt first, size_type n, Assign assign) {
+    return Fill(first, n, 1U, assign);
+  }
+
+  /**
+   * @brief Индекс первого элемента, не меньшего key (0 - если такого нет).
+   *
+   * @details Спуск без ветвлений: на каждом уровне k = 2k + (data[k] < key).
+   * После выхода за пределы массива двоичная запись k - это путь от корня,
+   * где 1 - переход вправо. Ответ - последний узел, из которого мы ушли
+   * влево, т.е. k без хвостовых единиц и еще одного бита.
+   *
+   * @param data Массив в порядке Эйтцингера (data[1..n])
+   * @param n Количество элементов
+   * @param key Искомый ключ
+   * @param less Функция сравнения
+   */
+  template <typename Key, typename Compare>
+  static size_type LowerBound(const Key *data, size_type n, const Key &key,
+                              const Compare &less) {
+    size_type k = 1;
+    while (k <= n) {
+      Prefetch(data, k * PrefetchStride<Key>(), n);
+      k = 2 * k + static_cast<size_type>(less(data[k], key));
+    }
+    return RestoreIndex(k);
+  }
+
+  /**
+   * @brief Индекс первого элемента, большего key (0 - если такого нет).
+   */
+  template <typename Key, typename Compare>
+  static size_type UpperBound(const Key *data, size_type n, const Key &key,
+                              const Compare &less) {
+    size_type k = 1;
+    while (k <= n) {
+      Prefetch(data, k * PrefetchStride<Key>(), n);
+      k = 2 * k + static_cast<size_type>(!less(key, data[k]));
+    }
+    return RestoreIndex(k);
+  }
+
+  // Индекс минимального элемента (самый левый узел), 0 для пустого массива
+  static size_type First(size_type n) noexcept {
+    if (n == 0) return 0;
+    size_type k = 1;
+    while (2 * k <= n) k = 2 * k;
+    return k;
+  }
+
+  // Индекс максимального элемента (самый правый узел), 0 для пустого массива
+  static size_type Last(size_type n) noexcept {
+    if (n == 0) return 0;
+    size_type k = 1;
+    while (2 * k + 1 <= n) k = 2 * k + 1;
+    return k;
+  }
+
+  // Следующий по порядку элемент (0 после последнего)
+  static size_type Next(size_type k, size_type n) noexcept {
+    if (2 * k + 1 <= n) {
+      k = 2 * k + 1;
+      while (2 * k <= n) k = 2 * k;
+      return k;
+    }
+    // Поднимаемся, пока мы правый потомок, затем еще на один уровень
+    while (k & 1U) k >>= 1U;
+    return k >> 1U;
+  }
+
+  // Предыдущий по порядку элемент (Prev(0) - последний элемент)
+  static size_type Prev(size_type k, size_type n) noexcept {
+    if (k == 0) return Last(n);
+    if (2 * k <= n) {
+      k = 2 * k;
+      while (2 * k + 1 <= n) k = 2 * k + 1;
+      return k;
+    }
+    while (k > 1 && !(k & 1U)) k >>= 1U;
+    return k >> 1U;
+  }
+
+ private:
+  template <typename InputIt, typename Assign>
+  static InputIt Fill(InputIt first, size_type n, size_type k,
+                      Assign &assign) {
+    if (k <= n) {
+      first = Fill(first, n, 2 * k, assign);
+      assign(k, *first);
+      ++first;
+      first = Fill(first, n, 2 * k + 1, assign);
+    }
+    return first;
+  }
+
+  static size_type RestoreIndex(size_type k) noexcept {
+    // Убираем хвостовые единицы (переходы вправо) и последний переход влево
+    return k >> (CountTrailingZeros(~k) + 1U);
+  }
+
+  static unsigned CountTrailingZeros(size_type value) noexcept {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#else
+    unsigned count = 0;
+    while (!(value & 1U)) {
+      value >>= 1U;
+      ++count;
+    }
+    return count;
+#endif
+  }
+
+  // Через сколько уровней вперед загружаем потомков: 2^d элементов потомков
+  // на глубине d должны поместиться в одну кэш-линию (64 байта).
+  template <typename Key>
+  static constexpr size_type PrefetchStride() noexcept {
+    size_type stride = 1;
+    while (stride * 2 * sizeof(Key) <= 64U) stride *= 2;
+    return stride;
+  }
+
+  template <typename Key>
+  static void Prefetch(const Key *data, size_type index, size_type n) noexcept {
+#if defined(__GNUC__)
+    if (index <= n) __builtin_prefetch(data + index);
+#else
+    (void)data;
+    (void)index;
+    (void)n;
+#endif
+  }
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,235 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_STATIC_SET_S21_STATIC_SET_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_STATIC_SET_S21_STATIC_SET_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+#include "../../s21_containers/policy/s21_storage_policy.h"
+#include "../../s21_containers/set/s21_set.h"
+#include "../../s21_containers/vector/s21_vector.h"
+#include "s21_eytzinger.h"
+
+namespace s21 {
+
+/**
+ * @brief Неизменяемое ("замороженное") множество для наборов, которые
+ * строятся один раз и дальше только читаются.
+ *
+ * @details Ключи хранятся в одном массиве в порядке Эйтцингера (см.
+ * EytzingerLayout), поиск идет без ветвлений и с упреждающей загрузкой
+ * потомков. В отличие от s21::set нет указателей и отдельных узлов в куче:
+ * на ключ тратится ровно sizeof(Key) байт.
+ *
+ * Итерация идет в порядке возрастания ключей, итераторы только константные.
+ *
+ * @tparam Key Тип элементов
+ * @tparam Compare Функция сравнения
+ */
+template <class Key, class Compare = std::less<Key>>
+class static_set : private detail::EmptyBaseHolder<Compare> {
+ private:
+  struct StaticSetIterator;
+  using CompareHolder = detail::EmptyBaseHolder<Compare>;
+
+ public:
+  using key_type = Key;
+  using value_type = key_type;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = StaticSetIterator;
+  using const_iterator = StaticSetIterator;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+
+  static_set() : data_(), size_(0U) {}
+
+  /**
+   * @brief Пустое множество с заданной функцией сравнения.
+   */
+  explicit static_set(const key_compare &comp)
+      : CompareHolder(comp), data_(), size_(0U) {}
+
+  /**
+   * @brief Строит множество из s21::set (ключи уже отсортированы и уникальны,
+   * поэтому построение за O(n)).
+   */
+  template <class Storage>
+  explicit static_set(const s21::set<Key, Compare, Storage> &other)
+      : CompareHolder(other.key_comp()),
+        data_(other.size() + 1U),
+        size_(other.size()) {
+    EytzingerLayout::Fill(other.begin(), size_,
+                          [this](size_type k, const_reference key) {
+                            data_.data()[k] = key;
+                          });
+  }
+
+  /**
+   * @brief Строит множество из произвольного диапазона: элементы сортируются,
+   * дубликаты отбрасываются.
+   */
+  template <class InputIt>
+  static_set(InputIt first, InputIt last,
+             const key_compare &comp = key_compare())
+      : static_set(comp) {
+    Build(std::vector<value_type>(first, last));
+  }
+
+  static_set(std::initializer_list<value_type> const &items,
+             const key_compare &comp = key_compare())
+      : static_set(items.begin(), items.end(), comp) {}
+
+  static_set(const static_set &other) = default;
+
+  static_set(static_set &&other) noexcept : static_set() { swap(other); }
+
+  static_set &operator=(const static_set &other) = default;
+
+  static_set &operator=(static_set &&other) noexcept {
+    if (this != &other) {
+      static_set tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ~static_set() = default;
+
+ public:
+  const_iterator begin() const noexcept {
+    return const_iterator(this, EytzingerLayout::First(size_));
+  }
+
+  const_iterator end() const noexcept { return const_iterator(this, 0U); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept { return data_.max_size() - 1U; }
+
+  void swap(static_set &other) noexcept {
+    data_.swap(other.data_);
+    std::swap(size_, other.size_);
+    std::swap(CompareHolder::Get(), other.CompareHolder::Get());
+  }
+
+  key_compare key_comp() const { return Cmp(); }
+
+  value_compare value_comp() const { return Cmp(); }
+
+ public:
+  /**
+   * @brief Первый элемент, не меньший key.
+   */
+  const_iterator lower_bound(const key_type &key) const {
+    return const_iterator(
+        this, EytzingerLayout::LowerBound(data_.data(), size_, key, Cmp()));
+  }
+
+  /**
+   * @brief Первый элемент, больший key.
+   */
+  const_iterator upper_bound(const key_type &key) const {
+    return const_iterator(
+        this, EytzingerLayout::UpperBound(data_.data(), size_, key, Cmp()));
+  }
+
+  const_iterator find(const key_type &key) const {
+    size_type k = EytzingerLayout::LowerBound(data_.data(), size_, key, Cmp());
+    if (k == 0 || Cmp()(key, data_.data()[k])) return end();
+    return const_iterator(this, k);
+  }
+
+  bool contains(const key_type &key) const {
+    size_type k = EytzingerLayout::LowerBound(data_.data(), size_, key, Cmp());
+    return k != 0 && !Cmp()(key, data_.data()[k]);
+  }
+
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+ private:
+  const key_compare &Cmp() const noexcept { return CompareHolder::Get(); }
+
+  // Сортирует ключи, удаляет дубликаты и раскладывает их по Эйтцингеру
+  void Build(std::vector<value_type> keys) {
+    std::sort(keys.begin(), keys.end(), Cmp());
+    auto last = std::unique(keys.begin(), keys.end(),
+                            [this](const_reference lhs, const_reference rhs) {
+                              return !Cmp()(lhs, rhs) && !Cmp()(rhs, lhs);
+                            });
+    keys.erase(last, keys.end());
+
+    s21::vector<value_type> data(keys.size() + 1U);
+    EytzingerLayout::Fill(keys.begin(), keys.size(),
+                          [&data](size_type k, const_reference key) {
+                            data.data()[k] = key;
+                          });
+    data_.swap(data);
+    size_ = keys.size();
+  }
+
+  struct StaticSetIterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = static_set::value_type;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    StaticSetIterator() = delete;
+
+    StaticSetIterator(const static_set *owner, size_type index)
+        : owner_(owner), index_(index) {}
+
+    reference operator*() const noexcept {
+      return owner_->data_.data()[index_];
+    }
+
+    pointer operator->() const noexcept { return &**this; }
+
+    StaticSetIterator &operator++() noexcept {
+      index_ = EytzingerLayout::Next(index_, owner_->size_);
+      return *this;
+    }
+
+    StaticSetIterator operator++(int) noexcept {
+      StaticSetIterator tmp{*this};
+      ++(*this);
+      return tmp;
+    }
+
+    StaticSetIterator &operator--() noexcept {
+      index_ = EytzingerLayout::Prev(index_, owner_->size_);
+      return *this;
+    }
+
+    StaticSetIterator operator--(int) noexcept {
+      StaticSetIterator tmp{*this};
+      --(*this);
+      return tmp;
+    }
+
+    bool operator==(const StaticSetIterator &other) const noexcept {
+      return index_ == other.index_;
+    }
+
+    bool operator!=(const StaticSetIterator &other) const noexcept {
+      return index_ != other.index_;
+    }
+
+    const static_set *owner_;  // Множество, по которому идет итерация.
+    size_type index_;          // Индекс Эйтцингера, 0 - end().
+  };
+
+  // Ключи в порядке Эйтцингера, ячейка 0 не используется
+  s21::vector<value_type> data_;
+  size_type size_;
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,429 @@
+#ifndef S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_STATIC_VECTOR_S21_STATIC_VECTOR_H
+#define S21_CONTAINERS_SRC_S21_CONTAINERSPLUS_STATIC_VECTOR_S21_STATIC_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+namespace detail {
+
+// Хранилище static_vector для тривиальных T: обычный массив. В C++17
+// конструктор constexpr обязан инициализировать все члены, поэтому массив
+// заполняется нулями - это цена вычислимости на этапе компиляции. Все
+// специальные функции тривиальны.
+template <class T, std::size_t N, bool = std::is_trivial_v<T>>
+struct StaticVectorStorage {
+  template <class... Args>
+  constexpr void Construct(std::size_t pos, Args &&...args) {
+    items_[pos] = T(std::forward<Args>(args)...);
+  }
+
+  constexpr void Destroy(std::size_t, std::size_t) noexcept {}
+
+  T items_[N]{};
+  std::size_t size_ = 0;
+};
+
+// Хранилище для остальных T: неинициализированная память внутри объекта
+// (массив в анонимном объединении), элементы создаются размещающим new
+template <class T, std::size_t N>
+struct StaticVectorStorage<T, N, false> {
+  StaticVectorStorage() noexcept {}
+
+  StaticVectorStorage(const StaticVectorStorage &other) {
+    ConstructFrom(other);
+  }
+
+  StaticVectorStorage(StaticVectorStorage &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+    ConstructFrom(std::move(other));
+  }
+
+  StaticVectorStorage &operator=(const StaticVectorStorage &other) {
+    if (this != &other) AssignFrom(other);
+    return *this;
+  }
+
+  StaticVectorStorage &operator=(StaticVectorStorage &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T> &&
+      std::is_nothrow_move_assignable_v<T>) {
+    if (this != &other) AssignFrom(std::move(other));
+    return *this;
+  }
+
+  ~StaticVectorStorage() { Destroy(0, size_); }
+
+  template <class... Args>
+  void Construct(std::size_t pos, Args &&...args) {
+    ::new (static_cast<void *>(items_ + pos)) T(std::forward<Args>(args)...);
+  }
+
+  void Destroy(std::size_t first, std::size_t last) noexcept {
+    for (; first < last; ++first) items_[first].~T();
+  }
+
+  // Копирует (или перемещает, если other - rvalue) элементы other в пустое
+  // хранилище; при исключении созданные элементы уничтожаются
+  template <class Source>
+  void ConstructFrom(Source &&other) {
+    using element = std::conditional_t<std::is_rvalue_reference_v<Source &&>,
+                                       T &&, const T &>;
+    try {
+      for (; size_ < other.size_; ++size_)
+        Construct(size_, static_cast<element>(other.items_[size_]));
+    } catch (...) {
+      Destroy(0, size_);
+      throw;
+    }
+  }
+
+  // Общие элементы переприсваиваются, недостающие создаются, лишние
+  // уничтожаются
+  template <class Source>
+  void AssignFrom(Source &&other) {
+    using element = std::conditional_t<std::is_rvalue_reference_v<Source &&>,
+                                       T &&, const T &>;
+    std::size_t common = size_ < other.size_ ? size_ : other.size_;
+    for (std::size_t i = 0; i < common; ++i)
+      items_[i] = static_cast<element>(other.items_[i]);
+    for (; size_ < other.size_; ++size_)
+      Construct(size_, static_cast<element>(other.items_[size_]));
+    Destroy(other.size_, size_);
+    size_ = other.size_;
+  }
+
+  union {
+    T items_[N];
+  };
+  std::size_t size_ = 0;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Вектор емкости N, хранящий элементы внутри самого объекта: не
+ * обращается к куче ни при каких операциях.
+ *
+ * @details Интерфейс повторяет s21::vector (push_back, insert, erase,
+ * insert_many_back, resize, ...), но емкость задается на этапе компиляции, а
+ * попытка превысить ее бросает std::length_error вместо перевыделения.
+ * Итераторы - обычные указатели; они остаются действительными, пока
+ * элементы не сдвигаются вставкой или удалением перед ними.
+ *
+ * Для тривиальных T (int, double, POD-структуры) все операции constexpr, а
+ * сам static_vector тривиально копируется и уничтожается. Переполнение
+ * при вычислении на этапе компиляции становится ошибкой компиляции.
+ *
+ * @tparam T Тип элемента
+ * @tparam N Емкость (больше нуля)
+ */
+template <class T, std::size_t N>
+class static_vector : private detail::StaticVectorStorage<T, N> {
+  static_assert(N > 0, "s21::static_vector: capacity must be positive");
+
+  using storage_type = detail::StaticVectorStorage<T, N>;
+  using storage_type::Construct;
+  using storage_type::Destroy;
+  using storage_type::items_;
+  using storage_type::size_;
+
+ public:
+  using value_type = T;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = value_type *;
+  using const_iterator = const value_type *;
+  using size_type = std::size_t;
+
+  constexpr static_vector() noexcept = default;
+
+  /**
+   * @brief count value-инициализированных элементов.
+   *
+   * @throw std::length_error если count > N
+   */
+  constexpr explicit static_vector(size_type count) : static_vector() {
+    resize(count);
+  }
+
+  constexpr static_vector(size_type count, const_reference value)
+      : static_vector() {
+    resize(count, value);
+  }
+
+  constexpr static_vector(std::initializer_list<value_type> const &items)
+      : static_vector() {
+    Reserve(items.size(), "s21::static_vector: too many initializers");
+    for (const value_type &item : items) Construct(size_++, item);
+  }
+
+ public:
+  /**
+   * @throw std::out_of_range если pos >= size()
+   */
+  constexpr reference at(size_type pos) {
+    if (pos >= size_)
+      throw std::out_of_range("s21::static_vector::at: pos >= size()");
+    return data()[pos];
+  }
+
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= size_)
+      throw std::out_of_range("s21::static_vector::at: pos >= size()");
+    return data()[pos];
+  }
+
+  /**
+   * @brief Доступ без проверки; pos должен быть меньше size().
+   */
+  constexpr reference operator[](size_type pos) noexcept {
+    return data()[pos];
+  }
+
+  constexpr const_reference operator[](size_type pos) const noexcept {
+    return data()[pos];
+  }
+
+  constexpr reference front() noexcept { return data()[0]; }
+  constexpr const_reference front() const noexcept { return data()[0]; }
+  constexpr reference back() noexcept { return data()[size_ - 1U]; }
+  constexpr const_reference back() const noexcept {
+    return data()[size_ - 1U];
+  }
+
+  constexpr iterator data() noexcept { return items_; }
+  constexpr const_iterator data() const noexcept { return items_; }
+
+  constexpr iterator begin() noexcept { return data(); }
+  constexpr const_iterator begin() const noexcept { return data(); }
+  constexpr iterator end() noexcept { return data() + size_; }
+  constexpr const_iterator end() const noexcept { return data() + size_; }
+
+ public:
+  [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr bool full() const noexcept { return size_ == N; }
+
+  constexpr size_type size() const noexcept { return size_; }
+
+  static constexpr size_type max_size() noexcept { return N; }
+
+  static constexpr size_type capacity() noexcept { return N; }
+
+  /**
+   * @brief Ничего не выделяет: только проверяет, что count помещается.
+   *
+   * @throw std::length_error если count > N
+   */
+  constexpr void reserve(size_type count) const {
+    Reserve(count, "s21::static_vector::reserve: count > capacity()");
+  }
+
+  constexpr void shrink_to_fit() const noexcept {}
+
+ public:
+  constexpr void clear() noexcept {
+    Destroy(0, size_);
+    size_ = 0;
+  }
+
+  constexpr iterator insert(const_iterator pos, const_reference value) {
+    return insert_many(pos, value);
+  }
+
+  constexpr iterator insert(const_iterator pos, value_type &&value) {
+    return insert_many(pos, std::move(value));
+  }
+
+  /**
+   * @brief Создает элементы из args перед pos; хвост сдвигается один раз.
+   *
+   * @details Элементы создаются в конце и затем переставляются на место,
+   * поэтому args могут ссылаться на элементы этого же вектора. Если
+   * создание бросит исключение, вектор не изменится.
+   *
+   * @return Итератор на первый вставленный элемент
+   * @throw std::out_of_range если pos вне [begin(), end()]
+   * @throw std::length_error если элементы не помещаются
+   */
+  template <class... Args>
+  constexpr iterator insert_many(const_iterator pos, Args &&...args) {
+    size_type index = static_cast<size_type>(pos - begin());
+    if (index > size_)
+      throw std::out_of_range(
+          "s21::static_vector::insert_many: pos is out of range");
+    size_type old_size = size_;
+    AppendMany(std::forward<Args>(args)...);
+    Rotate(begin() + index, begin() + old_size, end());
+    return begin() + index;
+  }
+
+  constexpr iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+  /**
+   * @brief Удаляет элементы [first, last); хвост сдвигается один раз.
+   *
+   * @return Итератор, следующий за последним удаленным элементом
+   */
+  constexpr iterator erase(const_iterator first, const_iterator last) {
+    size_type from = static_cast<size_type>(first - begin());
+    size_type to = static_cast<size_type>(last - begin());
+    if (from > to || to > size_)
+      throw std::out_of_range("s21::static_vector::erase: range is out of "
+                              "range of begin() to end()");
+    if (from != to) {
+      iterator out = begin() + from;
+      for (iterator it = begin() + to; it != end(); ++it, ++out)
+        *out = std::move(*it);
+      Destroy(size_ - (to - from), size_);
+      size_ -= to - from;
+    }
+    return begin() + from;
+  }
+
+  constexpr void push_back(const_reference value) { emplace_back(value); }
+
+  constexpr void push_back(value_type &&value) {
+    emplace_back(std::move(value));
+  }
+
+  /**
+   * @return Ссылка на новый элемент
+   * @throw std::length_error если вектор заполнен
+   */
+  template <class... Args>
+  constexpr reference emplace_back(Args &&...args) {
+    if (size_ == N)
+      throw std::length_error(
+          "s21::static_vector::emplace_back: size() is capacity()");
+    Construct(size_, std::forward<Args>(args)...);
+    return data()[size_++];
+  }
+
+  /**
+   * @brief Добавляет в конец по элементу на каждый аргумент.
+   *
+   * @throw std::length_error если элементы не помещаются (вектор не
+   * изменяется)
+   */
+  template <class... Args>
+  constexpr void insert_many_back(Args &&...args) {
+    AppendMany(std::forward<Args>(args)...);
+  }
+
+  constexpr void pop_back() noexcept {
+    --size_;
+    Destroy(size_, size_ + 1U);
+  }
+
+  /**
+   * @brief Изменяет размер до count; новые элементы value-инициализируются.
+   *
+   * @throw std::length_error если count > N
+   */
+  constexpr void resize(size_type count) {
+    Reserve(count, "s21::static_vector::resize: count > capacity()");
+    for (; size_ < count; ++size_) Construct(size_);
+    Destroy(count, size_);
+    size_ = count;
+  }
+
+  constexpr void resize(size_type count, const_reference value) {
+    Reserve(count, "s21::static_vector::resize: count > capacity()");
+    for (; size_ < count; ++size_) Construct(size_, value);
+    Destroy(count, size_);
+    size_ = count;
+  }
+
+  constexpr void swap(static_vector &other) noexcept(
+      std::is_nothrow_move_constructible_v<T> &&
+      std::is_nothrow_move_assignable_v<T>) {
+    static_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+ private:
+  static constexpr void Reserve(size_type count, const char *message) {
+    if (count > N) throw std::length_error(message);
+  }
+
+  template <class... Args>
+  constexpr void AppendMany(Args &&...args) {
+    Reserve(size_ + sizeof...(Args),
+            "s21::static_vector::insert_many: too many elements");
+    if constexpr ((std::is_nothrow_constructible_v<T, Args &&> && ...)) {
+      (Construct(size_++, std::forward<Args>(args)), ...);
+    } else {
+      AppendManyOrRollback(std::forward<Args>(args)...);
+    }
+  }
+
+  // try недопустим в constexpr-функциях C++17, поэтому откат вынесен сюда
+  template <class... Args>
+  void AppendManyOrRollback(Args &&...args) {
+    size_type old_size = size_;
+    try {
+      (Construct(size_++, std::forward<Args>(args)), ...);
+    } catch (...) {
+      // size_ уже учел элемент, создание которого бросило исключение
+      Destroy(old_size, size_ - 1U);
+      size_ = old_size;
+      throw;
+    }
+  }
+
+  static constexpr void Swap(reference lhs, reference rhs) {
+    value_type tmp(std::move(lhs));
+    lhs = std::move(rhs);
+    rhs = std::move(tmp);
+  }
+
+  static constexpr void Reverse(iterator first, iterator last) {
+    for (; first != last && first != --last; ++first) Swap(*first, *last);
+  }
+
+  // Переставляет [middle, last) перед [first, middle). Один элемент
+  // вставляется сдвигом хвоста, несколько - тремя разворотами
+  static constexpr void Rotate(iterator first, iterator middle,
+                               iterator last) {
+    if (first == middle || middle == last) return;
+    if (last - middle == 1) {
+      value_type tmp(std::move(*middle));
+      for (iterator it = middle; it != first; --it) *it = std::move(it[-1]);
+      *first = std::move(tmp);
+    } else {
+      Reverse(first, middle);
+      Reverse(middle, last);
+      Reverse(first, last);
+    }
+  }
+};
+
+/**
+ * @brief Удаляет элементы, для которых pred возвращает true, за один
+ * проход.
+ *
+ * @return Число удаленных элементов
+ */
+template <class T, std::size_t N, class Pred>
+constexpr std::size_t erase_if(static_vector<T, N> &vec, Pred pred) {
+  auto out = vec.begin();
+  for (auto it = vec.begin(); it != vec.end(); ++it) {
+    if (!pred(*it)) {
+      if (out != it) *out = std::move(*it);
+      ++out;
+    }
+  }
+  std::size_t erased = static_cast<std::size_t>(vec.end() - out);
+  vec.erase(out, vec.end());
+  return erased;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,160 @@
+#include "async_queue/s21_async_queue.h"
+
+// Сопрограммы доступны только в C++20 (make test_cpp20)
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+s21::async_task Produce(s21::async_queue<int> &queue, int count,
+                        std::vector<int> &log) {
+  for (int i = 0; i < count; ++i) {
+    // false - очередь закрыли, пока производитель ждал
+    if (!co_await queue.push(i)) co_return;
+    log.push_back(i);
+  }
+  queue.close();
+}
+
+s21::async_task Consume(s21::async_queue<int> &queue,
+                        std::vector<int> &result) {
+  while (auto item = co_await queue.pop()) result.push_back(*item);
+}
+
+// Перемещение отрицательного значения бросает, если throws == true
+struct Fragile {
+  static inline bool throws = false;
+  explicit Fragile(int v) : value(v) {}
+  Fragile(Fragile &&other) : value(other.value) {
+    if (throws && value < 0) throw std::runtime_error("move");
+  }
+  Fragile &operator=(Fragile &&other) {
+    if (throws && other.value < 0) throw std::runtime_error("move");
+    value = other.value;
+    return *this;
+  }
+  int value;
+};
+
+s21::async_task ConsumeOne(s21::async_queue<Fragile> &queue, int &result) {
+  if (auto item = co_await queue.pop()) result = item->value;
+}
+
+s21::async_task ProduceOne(s21::async_queue<Fragile> &queue, int value,
+                           bool &failed) {
+  try {
+    co_await queue.push(Fragile(value));
+  } catch (const std::runtime_error &) {
+    failed = true;
+  }
+}
+
+}  // namespace
+
+TEST(AsyncQueueTest, ProducerConsumer) {
+  s21::run_loop loop;
+  s21::async_queue<int> queue(2, loop);
+  std::vector<int> pushed, popped;
+  // Потребитель стартует первым и ждет на пустой очереди
+  loop.spawn(Consume(queue, popped));
+  loop.spawn(Produce(queue, 100, pushed));
+  loop.run();
+  ASSERT_EQ(popped.size(), 100U);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(popped[i], i);
+  EXPECT_EQ(pushed.size(), 100U);
+  EXPECT_TRUE(queue.closed());
+}
+
+TEST(AsyncQueueTest, PushSuspendsWhenFull) {
+  s21::run_loop loop;
+  s21::async_queue<int> queue(3, loop);
+  std::vector<int> pushed;
+  loop.spawn(Produce(queue, 10, pushed));
+  loop.run();
+  // Производитель остановился на заполненной очереди
+  EXPECT_EQ(pushed.size(), 3U);
+  EXPECT_EQ(queue.size(), 3U);
+  EXPECT_FALSE(queue.try_push(42));
+  EXPECT_EQ(queue.try_pop().value(), 0);
+  loop.run();
+  EXPECT_EQ(pushed.size(), 4U);
+  EXPECT_EQ(queue.try_pop().value(), 1);
+  EXPECT_EQ(queue.try_pop().value(), 2);
+  loop.run();
+  EXPECT_EQ(pushed.size(), 6U);
+  // Закрытие будит ожидающего производителя с false
+  std::vector<int> popped;
+  queue.close();
+  loop.spawn(Consume(queue, popped));
+  loop.run();
+  EXPECT_EQ(popped, (std::vector<int>{3, 4, 5}));
+  EXPECT_FALSE(queue.try_push(1));
+}
+
+TEST(AsyncQueueTest, ThrowingHandoffKeepsWaiters) {
+  s21::run_loop loop;
+  s21::async_queue<Fragile> queue(1, loop);
+  int popped = 0;
+  loop.spawn(ConsumeOne(queue, popped));
+  loop.run();
+  // Передача ждущему pop() не удалась - он продолжает ждать
+  Fragile::throws = true;
+  EXPECT_THROW(queue.try_push(Fragile(-1)), std::runtime_error);
+  Fragile::throws = false;
+  EXPECT_TRUE(queue.try_push(Fragile(1)));
+  loop.run();
+  EXPECT_EQ(popped, 1);
+
+  // Элемент ждущего push() не перешел в буфер: исключение получает push(),
+  // а pop() - свой элемент
+  bool failed = false;
+  EXPECT_TRUE(queue.try_push(Fragile(2)));
+  loop.spawn(ProduceOne(queue, -3, failed));
+  loop.run();
+  Fragile::throws = true;
+  EXPECT_EQ(queue.try_pop()->value, 2);
+  Fragile::throws = false;
+  loop.run();
+  EXPECT_TRUE(failed);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_TRUE(queue.try_push(Fragile(4)));
+}
+
+TEST(AsyncQueueTest, ZeroCapacity) {
+  s21::run_loop loop;
+  EXPECT_THROW(s21::async_queue<int>(0, loop), std::invalid_argument);
+}
+
+TEST(AsyncQueueTest, ConcurrentQueueOnThreadPool) {
+  s21::thread_pool pool(3);
+  s21::pool_executor executor(pool);
+  s21::concurrent_async_queue<int> queue(8, executor);
+  const int kProducers = 3, kItems = 2000;
+  std::atomic<long> sum{0};
+  std::atomic<int> producers_left{kProducers}, running{kProducers + 2};
+  auto producer = [&](int base) -> s21::async_task {
+    for (int i = 0; i < kItems; ++i) co_await queue.push(base + i);
+    if (--producers_left == 0) queue.close();
+    --running;
+  };
+  auto consumer = [&]() -> s21::async_task {
+    while (auto item = co_await queue.pop()) sum += *item;
+    --running;
+  };
+  for (int c = 0; c < 2; ++c) executor.spawn(consumer());
+  for (int p = 0; p < kProducers; ++p) executor.spawn(producer(p * kItems));
+  // Очередь должна пережить все сопрограммы, которые к ней обращаются
+  while (running != 0)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  long n = kProducers * kItems;
+  EXPECT_EQ(sum.load(), n * (n - 1) / 2);
+}
+
+#endif
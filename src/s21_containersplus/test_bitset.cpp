@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <cstddef>
+#include <random>
+
+#include "bitset/s21_bitset.h"
+
+namespace {
+
+constexpr std::size_t kSize = 200;
+
+constexpr s21::bitset<130> MakeConstant() {
+  s21::bitset<130> bits;
+  bits.set(0).set(64).set(129);
+  bits <<= 1;
+  bits.flip(2);
+  return bits;
+}
+
+}  // namespace
+
+// Все операции вычислимы на этапе компиляции
+static_assert(MakeConstant().count() == 3U);
+static_assert(MakeConstant().find_first() == 1U);
+static_assert(MakeConstant().find_next(1) == 2U);
+static_assert(MakeConstant().find_next(2) == 65U);
+static_assert(MakeConstant().find_next(65) == 130U);
+static_assert(MakeConstant().rank(65) == 2U);
+static_assert(s21::bitset<70>().set().all());
+static_assert((~s21::bitset<70>()).count() == 70U);
+static_assert(s21::bitset<8>(0x1FFU).count() == 8U);
+static_assert(s21::bitset<0>().none());
+
+TEST(BitsetTest, Basic) {
+  s21::bitset<100> bits;
+  EXPECT_TRUE(bits.none());
+  EXPECT_EQ(bits.size(), 100U);
+  EXPECT_EQ(bits.find_first(), 100U);
+  bits.set(3).set(99);
+  EXPECT_TRUE(bits.test(3));
+  EXPECT_TRUE(bits[99]);
+  EXPECT_FALSE(bits[4]);
+  EXPECT_EQ(bits.count(), 2U);
+  bits.set(3, false);
+  EXPECT_EQ(bits.find_first(), 99U);
+  EXPECT_EQ(bits.find_next(99), 100U);
+  bits.reset(99);
+  EXPECT_TRUE(bits.none());
+  EXPECT_THROW(bits.test(100), std::out_of_range);
+  EXPECT_THROW(bits.set(100), std::out_of_range);
+  EXPECT_THROW(bits.reset(100), std::out_of_range);
+  EXPECT_THROW(bits.flip(100), std::out_of_range);
+  EXPECT_THROW(bits.rank(101), std::out_of_range);
+}
+
+TEST(BitsetTest, MatchesStdBitset) {
+  std::mt19937 gen(69);
+  s21::bitset<kSize> lhs, rhs;
+  std::bitset<kSize> expected_lhs, expected_rhs;
+  for (int i = 0; i < 150; ++i) {
+    std::size_t a = gen() % kSize, b = gen() % kSize;
+    lhs.flip(a);
+    expected_lhs.flip(a);
+    rhs.set(b);
+    expected_rhs.set(b);
+  }
+  auto same = [](const s21::bitset<kSize> &bits,
+                 const std::bitset<kSize> &expected) {
+    ASSERT_EQ(bits.count(), expected.count());
+    std::size_t rank = 0;
+    for (std::size_t i = 0; i < kSize; ++i) {
+      ASSERT_EQ(bits[i], expected[i]) << i;
+      ASSERT_EQ(bits.rank(i), rank) << i;
+      rank += expected[i];
+    }
+    std::size_t pos = bits.find_first();
+    for (std::size_t i = 0; i < kSize; ++i) {
+      if (!expected[i]) continue;
+      ASSERT_EQ(pos, i);
+      pos = bits.find_next(pos);
+    }
+    EXPECT_EQ(pos, kSize);
+  };
+  same(lhs, expected_lhs);
+  same(lhs & rhs, expected_lhs & expected_rhs);
+  same(lhs | rhs, expected_lhs | expected_rhs);
+  same(lhs ^ rhs, expected_lhs ^ expected_rhs);
+  same(~lhs, ~expected_lhs);
+  for (std::size_t shift : {0U, 1U, 63U, 64U, 65U, 130U, 199U, 200U, 500U}) {
+    same(lhs << shift, expected_lhs << shift);
+    same(lhs >> shift, expected_lhs >> shift);
+  }
+  EXPECT_TRUE(lhs == lhs);
+  EXPECT_TRUE(lhs != ~lhs);
+}
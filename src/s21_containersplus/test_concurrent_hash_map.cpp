@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "concurrent_hash_map/s21_concurrent_hash_map.h"
+
+TEST(ConcurrentHashMapTest, Basic) {
+  s21::concurrent_hash_map<std::string, int> map(4);
+  EXPECT_EQ(map.segment_count(), 4U);
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert({"one", 1}));
+  EXPECT_FALSE(map.insert({"one", 11}));
+  EXPECT_TRUE(map.insert_or_assign("two", 2));
+  EXPECT_FALSE(map.insert_or_assign("two", 22));
+  EXPECT_EQ(map.size(), 2U);
+  EXPECT_EQ(map.find("one").value(), 1);
+  EXPECT_EQ(map.find("two").value(), 22);
+  EXPECT_FALSE(map.find("three").has_value());
+  EXPECT_TRUE(map.contains("one"));
+  EXPECT_EQ(map.count("three"), 0U);
+  EXPECT_EQ(map.erase("one"), 1U);
+  EXPECT_EQ(map.erase("one"), 0U);
+  EXPECT_EQ(map.size(), 1U);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains("two"));
+}
+
+TEST(ConcurrentHashMapTest, Upsert) {
+  s21::concurrent_hash_map<int, int> map;
+  EXPECT_TRUE(map.upsert(7, [](int &value) { value += 5; }));
+  EXPECT_FALSE(map.upsert(7, [](int &value) { value *= 2; }));
+  EXPECT_EQ(map.find(7).value(), 10);
+  int seen = 0;
+  EXPECT_TRUE(map.visit(7, [&seen](const int &value) { seen = value; }));
+  EXPECT_EQ(seen, 10);
+  EXPECT_FALSE(map.visit(8, [&seen](const int &) { seen = -1; }));
+  EXPECT_EQ(seen, 10);
+}
+
+TEST(ConcurrentHashMapTest, GrowthKeepsElements) {
+  s21::concurrent_hash_map<int, int> map(2);
+  std::size_t initial_buckets = map.bucket_count();
+  std::map<int, int> orig_map;
+  for (int i = 0; i < 20000; ++i) {
+    int key = i * 31 % 17000;
+    map.insert_or_assign(key, i);
+    orig_map[key] = i;
+    // Удаления во время переноса корзин
+    if (i % 5 == 0) {
+      map.erase(key / 2);
+      orig_map.erase(key / 2);
+    }
+  }
+  EXPECT_GT(map.bucket_count(), initial_buckets);
+  EXPECT_EQ(map.size(), orig_map.size());
+  for (int key = 0; key < 17000; ++key) {
+    auto it = orig_map.find(key);
+    auto value = map.find(key);
+    ASSERT_EQ(value.has_value(), it != orig_map.end());
+    if (value) {
+      EXPECT_EQ(*value, it->second);
+    }
+  }
+  std::size_t visited = 0;
+  map.for_each([&](const std::pair<const int, int> &item) {
+    ++visited;
+    EXPECT_EQ(orig_map.at(item.first), item.second);
+  });
+  EXPECT_EQ(visited, orig_map.size());
+}
+
+TEST(ConcurrentHashMapTest, ConcurrentUpsert) {
+  s21::concurrent_hash_map<int, int> map(8);
+  const int kThreads = 4, kKeys = 1000, kRounds = 20;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&map] {
+      for (int round = 0; round < kRounds; ++round)
+        for (int key = 0; key < kKeys; ++key)
+          map.upsert(key, [](int &value) { ++value; });
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(map.size(), static_cast<std::size_t>(kKeys));
+  for (int key = 0; key < kKeys; ++key)
+    EXPECT_EQ(map.find(key).value(), kThreads * kRounds);
+}
+
+TEST(ConcurrentHashMapTest, ConcurrentInsertEraseFind) {
+  s21::concurrent_hash_map<int, int> map(4);
+  const int kThreads = 4, kKeys = 5000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&map, t] {
+      // Каждый поток работает со своими ключами, читая и чужие
+      for (int i = 0; i < kKeys; ++i) {
+        int key = i * kThreads + t;
+        EXPECT_TRUE(map.insert({key, key}));
+        if (i % 2) {
+          EXPECT_EQ(map.erase(key - kThreads), 1U);
+        }
+        auto value = map.find(key);
+        EXPECT_TRUE(value && *value == key);
+        map.contains(key + 1);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(map.size(), static_cast<std::size_t>(kThreads * kKeys / 2));
+  for (int key = 0; key < kThreads * kKeys; ++key)
+    EXPECT_EQ(map.contains(key), (key / kThreads) % 2 == 1);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "concurrent_stack/s21_concurrent_stack.h"
+
+TEST(ConcurrentStackTest, Lifo) {
+  s21::concurrent_stack<std::string> stack;
+  EXPECT_TRUE(stack.empty());
+  EXPECT_FALSE(stack.pop().has_value());
+  stack.push("one");
+  std::string two = "two";
+  stack.push(two);
+  stack.emplace(3, 'x');
+  EXPECT_FALSE(stack.empty());
+  EXPECT_EQ(stack.pop().value(), "xxx");
+  EXPECT_EQ(stack.pop().value(), "two");
+  EXPECT_EQ(stack.pop().value(), "one");
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(ConcurrentStackTest, MoveOnlyAndDestructor) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::concurrent_stack<std::shared_ptr<int>> stack;
+    for (int i = 0; i < 100; ++i) stack.push(counter);
+    EXPECT_EQ(counter.use_count(), 101);
+    stack.pop();
+    EXPECT_EQ(counter.use_count(), 100);
+  }
+  // Деструктор уничтожает оставшиеся элементы
+  EXPECT_EQ(counter.use_count(), 1);
+
+  s21::concurrent_stack<std::unique_ptr<int>> stack;
+  stack.push(std::make_unique<int>(5));
+  EXPECT_EQ(*stack.pop().value(), 5);
+}
+
+TEST(ConcurrentStackTest, ThrowingConstructorReturnsNode) {
+  struct Throwing {
+    explicit Throwing(int value) : value_(value) {
+      if (value < 0) throw std::invalid_argument("negative");
+    }
+    int value_;
+  };
+  s21::concurrent_stack<Throwing> stack;
+  stack.emplace(1);
+  EXPECT_THROW(stack.emplace(-1), std::invalid_argument);
+  stack.emplace(2);
+  EXPECT_EQ(stack.pop()->value_, 2);
+  EXPECT_EQ(stack.pop()->value_, 1);
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(ConcurrentStackTest, ThrowingMoveKeepsElement) {
+  struct Throwing {
+    explicit Throwing(int value) : value_(value) {}
+    Throwing(const Throwing &other) : value_(other.value_) {}
+    Throwing(Throwing &&other) : value_(other.value_) {
+      if (value_ < 0) throw std::invalid_argument("negative");
+    }
+    int value_;
+  };
+  s21::concurrent_stack<Throwing> stack;
+  stack.emplace(1);
+  stack.emplace(-1);
+  EXPECT_THROW(stack.pop(), std::invalid_argument);
+  // Элемент остался в стеке, а не пропал вместе с узлом
+  EXPECT_FALSE(stack.empty());
+  EXPECT_THROW(stack.pop(), std::invalid_argument);
+  stack.emplace(2);
+  EXPECT_EQ(stack.pop()->value_, 2);
+}
+
+TEST(ConcurrentStackTest, ConcurrentPushPop) {
+  s21::concurrent_stack<int> stack;
+  const int kThreads = 4, kItems = 20000;
+  std::vector<std::vector<int>> popped(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      // Чередуем push и pop, чтобы потоки сталкивались на вершине
+      for (int i = 0; i < kItems; ++i) {
+        stack.push(t * kItems + i);
+        if (i % 2) {
+          if (auto value = stack.pop()) popped[t].push_back(*value);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  std::vector<int> all;
+  for (auto &values : popped)
+    all.insert(all.end(), values.begin(), values.end());
+  while (auto value = stack.pop()) all.push_back(*value);
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(all.size(), static_cast<std::size_t>(kThreads * kItems));
+  for (int i = 0; i < kThreads * kItems; ++i) ASSERT_EQ(all[i], i);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "dense_int_set/s21_dense_int_set.h"
+
+TEST(DenseIntSetTest, Empty) {
+  s21::dense_int_set set;
+  EXPECT_TRUE(set.empty());
+  EXPECT_TRUE(set.begin() == set.end());
+  EXPECT_FALSE(set.contains(0));
+  EXPECT_EQ(set.rank(12345), 0U);
+  EXPECT_THROW(set.select(0), std::out_of_range);
+  EXPECT_TRUE(set.lower_bound(7) == set.end());
+  EXPECT_EQ(set.erase(3), 0U);
+}
+
+TEST(DenseIntSetTest, MatchesStdSet) {
+  std::mt19937 gen(69);
+  s21::dense_int_set set;
+  std::set<std::uint32_t> expected;
+  auto end = set.end();
+  for (int step = 0; step < 20000; ++step) {
+    std::uint32_t value = gen() % 50000;
+    if (step % 4 == 3) {
+      EXPECT_EQ(set.erase(value), expected.erase(value));
+    } else {
+      EXPECT_EQ(set.insert(value).second, expected.insert(value).second);
+    }
+  }
+  // end() не зависит от роста массива
+  EXPECT_TRUE(end == set.end());
+  ASSERT_EQ(set.size(), expected.size());
+  std::vector<std::uint32_t> values(set.begin(), set.end());
+  EXPECT_EQ(values, std::vector<std::uint32_t>(expected.begin(),
+                                               expected.end()));
+  std::size_t rank = 0;
+  for (std::uint32_t value = 0; value < 50100; ++value) {
+    ASSERT_EQ(set.rank(value), rank) << value;
+    if (expected.count(value)) {
+      ASSERT_EQ(set.select(rank), value);
+      ++rank;
+    }
+    auto lower = expected.lower_bound(value);
+    auto it = set.lower_bound(value);
+    ASSERT_EQ(it == set.end(), lower == expected.end());
+    if (lower != expected.end()) {
+      ASSERT_EQ(*it, *lower);
+    }
+  }
+  EXPECT_THROW(set.select(set.size()), std::out_of_range);
+
+  auto last = set.end();
+  --last;
+  EXPECT_EQ(*last, *expected.rbegin());
+  --last;
+  EXPECT_EQ(*last, *std::next(expected.rbegin()));
+}
+
+TEST(DenseIntSetTest, ConvertsToAndFromSet) {
+  s21::set<std::uint32_t> tree = {5, 1, 4000000, 64, 63};
+  s21::dense_int_set set(tree);
+  EXPECT_EQ(set.size(), 5U);
+  EXPECT_EQ(set.select(4), 4000000U);
+  EXPECT_EQ(set.rank(4000000), 4U);
+  s21::set<std::uint32_t> back = set.to_set();
+  std::vector<std::uint32_t> values(back.begin(), back.end());
+  EXPECT_EQ(values, (std::vector<std::uint32_t>{1, 5, 63, 64, 4000000}));
+}
+
+TEST(DenseIntSetTest, MergeSwapCompare) {
+  s21::dense_int_set first = {1, 2, 3, 1000};
+  s21::dense_int_set second = {3, 4, 100000};
+  first.merge(second);
+  EXPECT_EQ(first, (s21::dense_int_set{1, 2, 3, 4, 1000, 100000}));
+  EXPECT_EQ(second, (s21::dense_int_set{3}));
+  EXPECT_EQ(first.rank(100000), 5U);
+  EXPECT_EQ(second.select(0), 3U);
+
+  first.swap(second);
+  EXPECT_EQ(first.size(), 1U);
+  EXPECT_EQ(second.size(), 6U);
+  s21::dense_int_set copy(second);
+  copy.erase(copy.find(4));
+  EXPECT_NE(copy, second);
+  EXPECT_EQ(copy.count(4), 0U);
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+  EXPECT_TRUE(copy.begin() == copy.end());
+  EXPECT_EQ(*copy.insert(1U << 24U).first, 1U << 24U);
+  EXPECT_EQ(copy.rank(1U << 24U), 0U);
+  EXPECT_EQ(copy.rank(std::uint32_t(-1)), 1U);
+  EXPECT_EQ(copy.select(0), 1U << 24U);
+}
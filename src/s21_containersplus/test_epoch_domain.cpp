@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "epoch/s21_epoch_domain.h"
+
+namespace {
+
+struct Tracked {
+  explicit Tracked(int value, std::atomic<int> &deleted)
+      : value_(value), alive_(kAlive), deleted_(&deleted) {}
+  ~Tracked() {
+    alive_ = 0;
+    ++*deleted_;
+  }
+
+  static constexpr int kAlive = 0x5a5a5a5a;
+
+  int value_;
+  int alive_;
+  std::atomic<int> *deleted_;
+};
+
+}  // namespace
+
+TEST(EpochDomainTest, RetireIsDeferredWhileGuarded) {
+  s21::epoch_domain domain;
+  std::atomic<int> deleted{0};
+  Tracked *object = new Tracked(1, deleted);
+  std::atomic<bool> pinned{false}, release{false};
+  std::thread reader([&] {
+    s21::epoch_domain::guard guard(domain);
+    pinned = true;
+    while (!release) std::this_thread::yield();
+    // Объект все еще жив, хотя его уже отложили на удаление
+    EXPECT_EQ(object->alive_, Tracked::kAlive);
+  });
+  while (!pinned) std::this_thread::yield();
+  domain.retire(object);
+  for (int i = 0; i < 10; ++i) domain.collect();
+  EXPECT_EQ(deleted.load(), 0);
+  EXPECT_EQ(domain.pending(), 1U);
+  release = true;
+  reader.join();
+  domain.synchronize();
+  EXPECT_EQ(deleted.load(), 1);
+  EXPECT_EQ(domain.pending(), 0U);
+}
+
+TEST(EpochDomainTest, CustomDeleterAndBatches) {
+  s21::epoch_domain domain;
+  int calls = 0;
+  int values[200];
+  for (int &value : values)
+    domain.retire(&value, [&calls](int *) { ++calls; });
+  // Без закрепленных потоков пачки удаляются по ходу дела
+  EXPECT_GT(calls, 0);
+  EXPECT_LT(domain.pending(), 200U);
+  domain.synchronize();
+  EXPECT_EQ(calls, 200);
+}
+
+TEST(EpochDomainTest, NestedGuardAndSynchronizeInsideGuard) {
+  s21::epoch_domain domain;
+  std::atomic<int> deleted{0};
+  {
+    s21::epoch_domain::guard outer(domain);
+    {
+      s21::epoch_domain::guard inner(domain);
+      domain.retire(new Tracked(1, deleted));
+    }
+    EXPECT_THROW(domain.synchronize(), std::logic_error);
+    for (int i = 0; i < 10; ++i) domain.collect();
+    // Внешний guard еще держит эпоху
+    EXPECT_EQ(deleted.load(), 0);
+  }
+  domain.synchronize();
+  EXPECT_EQ(deleted.load(), 1);
+}
+
+TEST(EpochDomainTest, DestructorReclaimsEverything) {
+  std::atomic<int> deleted{0};
+  {
+    s21::epoch_domain domain;
+    s21::epoch_domain::guard guard(domain);
+    std::thread([&] {
+      for (int i = 0; i < 10; ++i) domain.retire(new Tracked(i, deleted));
+    }).join();
+    EXPECT_EQ(deleted.load(), 0);
+    // Запись завершившегося потока переиспользуется вместе с его списком
+    std::thread([&] { EXPECT_EQ(domain.pending(), 10U); }).join();
+  }
+  EXPECT_EQ(deleted.load(), 10);
+}
+
+TEST(EpochDomainTest, StressReadersAndWriters) {
+  s21::epoch_domain domain;
+  std::atomic<int> deleted{0};
+  std::atomic<Tracked *> shared{new Tracked(0, deleted)};
+  const int kReaders = 3, kWriters = 2, kUpdates = 20000;
+  std::atomic<int> writers_done{0};
+  std::atomic<bool> failed{false};
+  std::vector<std::thread> threads;
+  for (int r = 0; r < kReaders; ++r) {
+    threads.emplace_back([&] {
+      while (writers_done.load() != kWriters) {
+        s21::epoch_domain::guard guard(domain);
+        Tracked *object = shared.load(std::memory_order_acquire);
+        if (object->alive_ != Tracked::kAlive) failed = true;
+      }
+    });
+  }
+  for (int w = 0; w < kWriters; ++w) {
+    threads.emplace_back([&, w] {
+      for (int i = 0; i < kUpdates; ++i) {
+        Tracked *old = shared.exchange(new Tracked(w * kUpdates + i, deleted),
+                                       std::memory_order_acq_rel);
+        domain.retire(old);
+      }
+      domain.synchronize();
+      ++writers_done;
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_FALSE(failed.load());
+  EXPECT_EQ(deleted.load(), kWriters * kUpdates);
+  delete shared.load();
+}
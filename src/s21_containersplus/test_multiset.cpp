@@ -153,4 +153,60 @@ TEST(MultisetTest, InsertMany) {
   EXPECT_TRUE(ms.contains(1));
   EXPECT_TRUE(ms.contains(2));
   EXPECT_TRUE(ms.contains(3));
-}
\ No newline at end of file
+}
+TEST(MultisetTest, FindMany) {
+  multiset<int> ms = {5, 1, 5, 3, 3, 3, 9};
+  int keys[] = {3, 4, 5, 9, 10, 0, 1};
+  std::vector<multiset<int>::iterator> found;
+  bool present[7];
+  ms.find_many(keys, keys + 7, std::back_inserter(found));
+  ms.contains_many(keys, keys + 7, present);
+  for (int i = 0; i < 7; ++i) {
+    EXPECT_TRUE(found[i] == ms.find(keys[i]));
+    EXPECT_EQ(present[i], ms.contains(keys[i]));
+  }
+}
+
+TEST(MultisetTest, InsertBatch) {
+  multiset<int> ms = {3, 1};
+  int batch[] = {3, 2, 3, 1, 0};
+  EXPECT_EQ(ms.insert_batch(batch, batch + 5), 5U);
+  EXPECT_EQ(ms.size(), 7U);
+  EXPECT_EQ(ms.count(3), 3U);
+  EXPECT_EQ(ms.count(1), 2U);
+  int expected[] = {0, 1, 1, 2, 3, 3, 3};
+  int i = 0;
+  for (auto it = ms.begin(); it != ms.end(); ++it)
+    EXPECT_EQ(*it, expected[i++]);
+}
+
+TEST(MultisetTest, ParallelBuild) {
+  std::vector<int> items;
+  for (int i = 0; i < 40000; ++i) items.push_back(i % 1000);
+  multiset<int> ms(s21::execution::par, items.begin(), items.end());
+  EXPECT_EQ(ms.size(), 40000U);
+  EXPECT_EQ(ms.count(999), 40U);
+  EXPECT_EQ(*ms.begin(), 0);
+}
+
+TEST(MultisetTest, MergeAll) {
+  multiset<int> shards[3] = {{1, 5, 5}, {2, 5}, {}};
+  multiset<int> ms = {5, 0};
+  ms.merge_all(s21::execution::seq, shards, shards + 3);
+  EXPECT_EQ(ms.size(), 7U);
+  EXPECT_EQ(ms.count(5), 4U);
+  for (auto &shard : shards) EXPECT_TRUE(shard.empty());
+  int expected[] = {0, 1, 2, 5, 5, 5, 5};
+  int i = 0;
+  for (auto it = ms.begin(); it != ms.end(); ++it)
+    EXPECT_EQ(*it, expected[i++]);
+}
+
+TEST(MultisetTest, CustomCompare) {
+  multiset<int, std::greater<int>> ms = {1, 3, 3, 2, 3, 5};
+  EXPECT_EQ(*ms.begin(), 5);
+  EXPECT_EQ(ms.count(3), 3U);
+  EXPECT_EQ(ms.count(4), 0U);
+  EXPECT_EQ(ms.count(0), 0U);
+  EXPECT_EQ(*ms.lower_bound(4), 3);
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../s21_containers/map/s21_map.h"
+#include "../s21_containers/set/s21_set.h"
+#include "../s21_containers/vector/s21_vector.h"
+#include "algorithm/s21_parallel_algorithm.h"
+#include "array/s21_array.h"
+#include "multiset/s21_multiset.h"
+
+namespace {
+
+s21::vector<long> MakeVector(std::size_t size) {
+  s21::vector<long> result;
+  std::mt19937 gen(56);
+  std::uniform_int_distribution<long> dist(-1000, 1000);
+  for (std::size_t i = 0; i < size; ++i) result.push_back(dist(gen));
+  return result;
+}
+
+}  // namespace
+
+TEST(ParallelAlgorithmTest, ForEachVector) {
+  s21::thread_pool pool(4);
+  s21::vector<long> data = MakeVector(100000);
+  std::vector<long> expected(data.begin(), data.end());
+  s21::for_each(s21::execution::par.on(pool), data.begin(), data.end(),
+                [](long &x) { x *= 2; });
+  for (long &x : expected) x *= 2;
+  EXPECT_TRUE(std::equal(data.begin(), data.end(), expected.begin()));
+}
+
+TEST(ParallelAlgorithmTest, ForEachArraySequenced) {
+  s21::array<int, 5> data = {1, 2, 3, 4, 5};
+  int sum = 0;
+  s21::for_each(s21::execution::seq, data.begin(), data.end(),
+                [&sum](int x) { sum += x; });
+  EXPECT_EQ(sum, 15);
+}
+
+TEST(ParallelAlgorithmTest, TransformSet) {
+  s21::thread_pool pool(4);
+  s21::set<int> source;
+  for (int i = 0; i < 50000; ++i) source.insert(i * 3);
+  std::vector<int> result(source.size());
+  auto end = s21::transform(s21::execution::par.on(pool), source.begin(),
+                            source.end(), result.begin(),
+                            [](int x) { return x + 1; });
+  EXPECT_TRUE(end == result.end());
+  for (std::size_t i = 0; i < result.size(); ++i)
+    EXPECT_EQ(result[i], static_cast<int>(i) * 3 + 1);
+}
+
+TEST(ParallelAlgorithmTest, ReduceVectorAndMap) {
+  s21::thread_pool pool(3);
+  s21::vector<long> data = MakeVector(123457);
+  long expected = std::accumulate(data.begin(), data.end(), 10L);
+  EXPECT_EQ(s21::reduce(s21::execution::par.on(pool), data.begin(),
+                        data.end(), 10L),
+            expected);
+
+  s21::map<int, int> map;
+  for (int i = 1; i <= 1000; ++i) map.insert(i, i);
+  long sum = 0;
+  s21::for_each(
+      s21::execution::seq, map.begin(), map.end(),
+      [&sum](const std::pair<const int, int> &p) { sum += p.second; });
+  EXPECT_EQ(sum, 500500);
+  std::vector<int> keys(map.size());
+  s21::transform(s21::execution::par.on(pool), map.begin(), map.end(),
+                 keys.begin(), [](const std::pair<const int, int> &p) {
+                   return p.first;
+                 });
+  EXPECT_EQ(s21::reduce(s21::execution::par.on(pool), keys.begin(), keys.end(),
+                        0),
+            500500);
+}
+
+TEST(ParallelAlgorithmTest, ReduceMultisetSubrange) {
+  s21::thread_pool pool(4);
+  s21::multiset<int> ms;
+  for (int i = 0; i < 20000; ++i) ms.insert(i % 100);
+  // Поддиапазон дерева делится по поддеревьям так же, как все дерево
+  auto first = ms.lower_bound(10);
+  auto last = ms.upper_bound(19);
+  long expected = 0;
+  for (auto it = first; it != last; ++it) expected += *it;
+  EXPECT_EQ(s21::reduce(s21::execution::par.on(pool), first, last, 0L),
+            expected);
+  EXPECT_EQ(s21::reduce(s21::execution::par.on(pool), first, first, 7L), 7L);
+}
+
+TEST(ParallelAlgorithmTest, Sort) {
+  s21::thread_pool pool(4);
+  for (std::size_t size : {0U, 1U, 100U, 5000U, 65537U, 300001U}) {
+    s21::vector<long> data = MakeVector(size);
+    std::vector<long> expected(data.begin(), data.end());
+    std::sort(expected.begin(), expected.end());
+    s21::sort(s21::execution::par.on(pool), data.begin(), data.end());
+    EXPECT_TRUE(std::equal(data.begin(), data.end(), expected.begin()));
+  }
+  std::vector<int> desc(100000);
+  std::iota(desc.begin(), desc.end(), 0);
+  s21::sort(s21::execution::par.on(pool), desc.begin(), desc.end(),
+            std::greater<int>());
+  EXPECT_TRUE(std::is_sorted(desc.begin(), desc.end(), std::greater<int>()));
+}
+
+TEST(ParallelAlgorithmTest, InclusiveScan) {
+  s21::thread_pool pool(4);
+  s21::vector<long> data = MakeVector(77777);
+  std::vector<long> expected(data.size());
+  std::partial_sum(data.begin(), data.end(), expected.begin());
+  std::vector<long> result(data.size());
+  auto end = s21::inclusive_scan(s21::execution::par.on(pool), data.begin(),
+                                 data.end(), result.begin());
+  EXPECT_TRUE(end == result.end());
+  EXPECT_EQ(result, expected);
+
+  s21::set<int> set;
+  for (int i = 1; i <= 5000; ++i) set.insert(i);
+  std::vector<long> scan(set.size());
+  s21::inclusive_scan(s21::execution::par.on(pool), set.begin(), set.end(),
+                      scan.begin());
+  EXPECT_EQ(scan.back(), 5000L * 5001 / 2);
+  EXPECT_EQ(scan[99], 5050);
+}
+
+TEST(ParallelAlgorithmTest, CopyIf) {
+  s21::thread_pool pool(4);
+  s21::vector<long> data = MakeVector(100003);
+  auto positive = [](long x) { return x > 0; };
+  std::vector<long> expected;
+  std::copy_if(data.begin(), data.end(), std::back_inserter(expected),
+               positive);
+  std::vector<long> result(data.size());
+  auto end = s21::copy_if(s21::execution::par.on(pool), data.begin(),
+                          data.end(), result.begin(), positive);
+  result.erase(end, result.end());
+  EXPECT_EQ(result, expected);
+}
+
+TEST(ParallelAlgorithmTest, GlobalPoolAndException) {
+  std::vector<int> data(50000, 1);
+  EXPECT_EQ(s21::reduce(s21::execution::par, data.begin(), data.end(), 0),
+            50000);
+  EXPECT_THROW(s21::for_each(s21::execution::par, data.begin(), data.end(),
+                             [](int) { throw std::runtime_error("boom"); }),
+               std::runtime_error);
+}
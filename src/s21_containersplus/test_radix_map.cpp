@@ -0,0 +1,277 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "radix_map/s21_radix_map.h"
+
+namespace {
+
+template <class Key, class T>
+void ExpectSameContents(const s21::radix_map<Key, T> &map,
+                        const std::map<Key, T> &expected) {
+  ASSERT_EQ(map.size(), expected.size());
+  auto it = map.begin();
+  for (const auto &item : expected) {
+    ASSERT_TRUE(it != map.end());
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ(it->second, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == map.end());
+}
+
+// Ключи с общими префиксами разной длины, пустой ключ, ключи-префиксы
+// других ключей и байты '\0' и '\xff'
+std::vector<std::string> TrickyKeys() {
+  std::vector<std::string> keys = {"",
+                                   "a",
+                                   "ab",
+                                   "abc",
+                                   "abd",
+                                   "b",
+                                   std::string(1, '\0'),
+                                   std::string("a\0b", 3),
+                                   "\xff",
+                                   "\xff\xff",
+                                   "/api/v1/users",
+                                   "/api/v1/users/42",
+                                   "/api/v1/user",
+                                   "/api/v2/users",
+                                   "/api/v1/orders/2024/01/01",
+                                   "/api/v1/orders/2024/01/02"};
+  std::string prefix = "/very/long/shared/route/prefix/";
+  for (int i = 0; i < 40; ++i) keys.push_back(prefix + std::to_string(i));
+  for (int c = 0; c < 256; ++c)
+    keys.push_back("fan/" + std::string(1, static_cast<char>(c)));
+  return keys;
+}
+
+}  // namespace
+
+TEST(RadixMapTest, Empty) {
+  s21::radix_map<std::string, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.size(), 0U);
+  EXPECT_TRUE(map.begin() == map.end());
+  EXPECT_TRUE(map.find("a") == map.end());
+  EXPECT_TRUE(map.lower_bound("a") == map.end());
+  EXPECT_THROW(map.at("a"), std::out_of_range);
+  auto range = map.prefix_range("a");
+  EXPECT_TRUE(range.first == map.end() && range.second == map.end());
+}
+
+TEST(RadixMapTest, BasicOperations) {
+  s21::radix_map<std::string, int> map = {{"b", 2}, {"a", 1}, {"b", 3}};
+  EXPECT_EQ(map.size(), 2U);
+  EXPECT_EQ(map.at("b"), 2);
+  map["c"] = 3;
+  map["a"] += 10;
+  EXPECT_EQ(map.at("a"), 11);
+  EXPECT_FALSE(map.insert("c", 30).second);
+  EXPECT_FALSE(map.insert_or_assign("c", 30).second);
+  EXPECT_EQ(map.at("c"), 30);
+  EXPECT_TRUE(map.contains("a"));
+  EXPECT_EQ(map.count("z"), 0U);
+  EXPECT_EQ(map.erase("a"), 1U);
+  EXPECT_EQ(map.erase("a"), 0U);
+  auto results = map.insert_many(std::make_pair(std::string("d"), 4),
+                                 std::make_pair(std::string("b"), 5));
+  EXPECT_TRUE(results[0].second);
+  EXPECT_FALSE(results[1].second);
+  ExpectSameContents(map, {{"b", 2}, {"c", 30}, {"d", 4}});
+}
+
+TEST(RadixMapTest, MatchesStdMapOnTrickyStrings) {
+  std::vector<std::string> keys = TrickyKeys();
+  std::mt19937 gen(68);
+  std::shuffle(keys.begin(), keys.end(), gen);
+  s21::radix_map<std::string, int> map;
+  std::map<std::string, int> expected;
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(map.insert(keys[i], static_cast<int>(i)).second,
+              expected.emplace(keys[i], static_cast<int>(i)).second);
+  }
+  ExpectSameContents(map, expected);
+
+  std::vector<std::string> probes = keys;
+  for (const std::string &key : keys) {
+    probes.push_back(key + "x");
+    probes.push_back(key + '\0');
+    if (!key.empty()) probes.push_back(key.substr(0, key.size() - 1));
+  }
+  for (const std::string &probe : probes) {
+    EXPECT_EQ(map.contains(probe), expected.count(probe) == 1) << probe;
+    auto lower = expected.lower_bound(probe);
+    auto it = map.lower_bound(probe);
+    if (lower == expected.end()) {
+      EXPECT_TRUE(it == map.end()) << probe;
+    } else {
+      ASSERT_TRUE(it != map.end()) << probe;
+      EXPECT_EQ(it->first, lower->first);
+    }
+    auto upper = expected.upper_bound(probe);
+    it = map.upper_bound(probe);
+    EXPECT_EQ(it == map.end(), upper == expected.end()) << probe;
+    if (upper != expected.end() && it != map.end()) {
+      EXPECT_EQ(it->first, upper->first);
+    }
+  }
+
+  // Удаление в случайном порядке сжимает и схлопывает узлы
+  std::shuffle(keys.begin(), keys.end(), gen);
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    map.erase(map.find(keys[i]));
+    expected.erase(keys[i]);
+    if (i % 37 == 0) ExpectSameContents(map, expected);
+    EXPECT_FALSE(map.contains(keys[i]));
+  }
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+}
+
+TEST(RadixMapTest, RandomStringsAgainstStdMap) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> length(0, 12);
+  std::uniform_int_distribution<int> letter(0, 3);
+  s21::radix_map<std::string, int> map;
+  std::map<std::string, int> expected;
+  for (int step = 0; step < 20000; ++step) {
+    std::string key(static_cast<std::size_t>(length(gen)), 'a');
+    for (char &c : key) c = static_cast<char>('a' + letter(gen));
+    if (step % 3 == 2) {
+      EXPECT_EQ(map.erase(key), expected.erase(key));
+    } else {
+      map[key] = step;
+      expected[key] = step;
+    }
+  }
+  ExpectSameContents(map, expected);
+}
+
+TEST(RadixMapTest, IntegerKeysKeepNumericOrder) {
+  std::mt19937_64 gen(64);
+  s21::radix_map<std::int64_t, int> map;
+  std::map<std::int64_t, int> expected;
+  std::vector<std::int64_t> keys = {0,
+                                    -1,
+                                    1,
+                                    INT64_MIN,
+                                    INT64_MAX,
+                                    255,
+                                    256,
+                                    -256,
+                                    -257};
+  for (int i = 0; i < 3000; ++i)
+    keys.push_back(static_cast<std::int64_t>(gen()) >> (i % 64));
+  for (std::int64_t key : keys) {
+    map.insert(key, static_cast<int>(key & 0xFFFF));
+    expected.emplace(key, static_cast<int>(key & 0xFFFF));
+  }
+  ExpectSameContents(map, expected);
+  for (std::int64_t key : keys) {
+    std::int64_t probe = key == INT64_MAX ? key : key + 1;
+    auto it = map.lower_bound(probe);
+    auto lower = expected.lower_bound(probe);
+    EXPECT_EQ(it == map.end(), lower == expected.end());
+    if (lower != expected.end()) {
+      EXPECT_EQ(it->first, lower->first);
+    }
+  }
+
+  s21::radix_map<std::uint32_t, int> small;
+  for (std::uint32_t key = 0; key < 1000; ++key) small[key * 7919U] = 1;
+  std::uint32_t previous = 0;
+  for (auto it = small.begin(); it != small.end(); ++it) {
+    if (it != small.begin()) {
+      EXPECT_LT(previous, it->first);
+    }
+    previous = it->first;
+  }
+}
+
+TEST(RadixMapTest, PrefixRange) {
+  s21::radix_map<std::string, int> map;
+  for (const std::string &key : TrickyKeys()) map[key] = 1;
+
+  auto check = [&map](const std::string &prefix) {
+    std::vector<std::string> expected;
+    for (const auto &item : map)
+      if (item.first.compare(0, prefix.size(), prefix) == 0)
+        expected.push_back(item.first);
+    std::vector<std::string> actual;
+    auto range = map.prefix_range(prefix);
+    for (auto it = range.first; it != range.second; ++it)
+      actual.push_back(it->first);
+    EXPECT_EQ(actual, expected) << prefix;
+    if (expected.empty()) {
+      EXPECT_TRUE(range.first == map.lower_bound(prefix)) << prefix;
+    }
+  };
+  for (const std::string prefix :
+       {"", "a", "ab", "abc", "abz", "/api/", "/api/v1/user", "/api/v1/users/",
+        "/very/long/shared", "/very/long/shared/route/prefix/1",
+        "/very/long/shared/route/prefix/x", "/very/long/sharep", "fan/",
+        "fan", "zzz"})
+    check(prefix);
+}
+
+TEST(RadixMapTest, CopyMoveSwapMerge) {
+  s21::radix_map<std::string, int> first = {{"a", 1}, {"ab", 2}, {"b", 3}};
+  s21::radix_map<std::string, int> copy(first);
+  copy["c"] = 4;
+  EXPECT_EQ(first.size(), 3U);
+  EXPECT_EQ(copy.size(), 4U);
+
+  s21::radix_map<std::string, int> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 4U);
+  EXPECT_TRUE(copy.empty());
+  EXPECT_TRUE(copy.begin() == copy.end());
+  copy["z"] = 26;
+
+  s21::radix_map<std::string, int> empty;
+  empty.swap(first);
+  EXPECT_TRUE(first.empty());
+  EXPECT_TRUE(first.begin() == first.end());
+  ExpectSameContents(empty, {{"a", 1}, {"ab", 2}, {"b", 3}});
+  auto last = empty.end();
+  --last;
+  EXPECT_EQ(last->first, "b");
+
+  s21::radix_map<std::string, int> other = {{"ab", 20}, {"abc", 30}, {"d", 5}};
+  auto kept = other.find("abc");
+  empty.merge(other);
+  ExpectSameContents(empty,
+                     {{"a", 1}, {"ab", 2}, {"abc", 30}, {"b", 3}, {"d", 5}});
+  ExpectSameContents(other, {{"ab", 20}});
+  EXPECT_EQ(kept->second, 30);
+  EXPECT_TRUE(empty.find("abc") == kept);
+
+  first = empty;
+  EXPECT_EQ(first.size(), 5U);
+  first = std::move(moved);
+  EXPECT_EQ(first.size(), 4U);
+}
+
+TEST(RadixMapTest, BatchOperations) {
+  s21::radix_map<std::string, int> map;
+  std::vector<std::pair<std::string, int>> batch = {
+      {"x", 1}, {"y", 2}, {"x", 3}};
+  EXPECT_EQ(map.insert_batch(batch.begin(), batch.end()), 2U);
+  EXPECT_EQ(map.at("x"), 1);
+  EXPECT_EQ(map.insert_or_assign_batch(batch.begin(), batch.end()), 0U);
+  EXPECT_EQ(map.at("x"), 3);
+
+  std::vector<std::string> keys = {"y", "q"};
+  std::vector<bool> found;
+  map.contains_many(keys.begin(), keys.end(), std::back_inserter(found));
+  EXPECT_EQ(found, (std::vector<bool>{true, false}));
+  std::vector<s21::radix_map<std::string, int>::iterator> its;
+  map.find_many(keys.begin(), keys.end(), std::back_inserter(its));
+  EXPECT_EQ(its[0]->second, 2);
+  EXPECT_TRUE(its[1] == map.end());
+}
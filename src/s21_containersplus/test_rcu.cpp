@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers/map/s21_map.h"
+#include "../s21_containers/set/s21_set.h"
+#include "rcu/s21_rcu.h"
+
+TEST(RcuTest, LoadStoreUpdate) {
+  s21::rcu<s21::map<std::string, int>> config(
+      s21::map<std::string, int>{{"threads", 4}});
+  EXPECT_EQ(config.load()->at("threads"), 4);
+
+  auto before = config.load();
+  config.update([](s21::map<std::string, int> &map) {
+    map["threads"] = 8;
+    map.insert("timeout", 30);
+  });
+  // Старый снимок не меняется
+  EXPECT_EQ(before->at("threads"), 4);
+  EXPECT_FALSE(before->contains("timeout"));
+  auto after = config.load();
+  EXPECT_EQ(after->at("threads"), 8);
+  EXPECT_EQ((*after).at("timeout"), 30);
+
+  config.store(s21::map<std::string, int>{});
+  EXPECT_TRUE(config.load()->empty());
+}
+
+TEST(RcuTest, FailedUpdateKeepsVersion) {
+  s21::rcu<s21::set<int>> set(s21::set<int>{1, 2});
+  auto failing_builder = [](s21::set<int> &value) {
+    value.insert(3);
+    throw std::runtime_error("builder failed");
+  };
+  EXPECT_THROW(set.update(failing_builder), std::runtime_error);
+  EXPECT_EQ(set.load()->size(), 2U);
+  EXPECT_FALSE(set.load()->contains(3));
+}
+
+TEST(RcuTest, OldVersionsAreReclaimed) {
+  s21::epoch_domain domain;
+  s21::rcu<s21::set<int>> set(s21::set<int>{}, domain);
+  for (int i = 0; i < 10; ++i)
+    set.update([i](s21::set<int> &value) { value.insert(i); });
+  // Без читателей старые версии удаляются по ходу обновлений, не дожидаясь
+  // synchronize() или пачки удалений домена
+  EXPECT_LE(domain.pending(), 2U);
+  set.synchronize();
+  EXPECT_EQ(domain.pending(), 0U);
+  EXPECT_EQ(set.load()->size(), 10U);
+}
+
+TEST(RcuTest, ConcurrentReadersAndWriter) {
+  s21::rcu<s21::map<int, int>> table;
+  std::atomic<bool> done{false};
+  std::atomic<bool> failed{false};
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 3; ++r) {
+    readers.emplace_back([&] {
+      while (!done) {
+        auto snapshot = table.load();
+        // Каждая версия согласована: ключи 0..n-1 со значением n
+        int n = static_cast<int>(snapshot->size());
+        for (int key = 0; key < n; ++key)
+          if (snapshot->at(key) != n) failed = true;
+      }
+    });
+  }
+  for (int n = 1; n <= 200; ++n) {
+    table.update([n](s21::map<int, int> &map) {
+      for (int key = 0; key < n; ++key) map[key] = n;
+    });
+  }
+  done = true;
+  for (auto &reader : readers) reader.join();
+  EXPECT_FALSE(failed.load());
+  EXPECT_EQ(table.load()->size(), 200U);
+}
+
+TEST(RcuTest, FailedPublishKeepsReadersSafe) {
+  s21::epoch_domain domain;
+  s21::rcu<s21::set<int>> set(s21::set<int>{1, 2, 3}, domain);
+  // Почти полная пачка отложенного, последним - объект, удаление которого
+  // бросает исключение: его выбросит очередная уборка в домене
+  for (std::size_t i = 0; i + 2 < s21::epoch_domain::kReclaimBatch; ++i)
+    domain.retire(new int(0));
+  domain.retire(new int(0), [](int *ptr) {
+    delete ptr;
+    throw std::runtime_error("deleter failed");
+  });
+  // Другой поток продвигает эпоху, и отложенное становится готовым к
+  // удалению
+  std::thread([&domain] {
+    domain.collect();
+    domain.collect();
+  }).join();
+
+  std::atomic<int> stage{0};
+  std::atomic<int> read_sum{0};
+  std::thread reader([&] {
+    auto snapshot = set.load();
+    stage = 1;
+    while (stage != 2) std::this_thread::yield();
+    for (int value : *snapshot) read_sum += value;
+  });
+  while (stage != 1) std::this_thread::yield();
+  EXPECT_THROW(set.update([](s21::set<int> &value) { value.insert(4); }),
+               std::runtime_error);
+  stage = 2;
+  reader.join();
+  EXPECT_EQ(read_sum.load(), 6);
+  EXPECT_EQ(set.load()->size(), 3U);
+
+  set.update([](s21::set<int> &value) { value.insert(4); });
+  EXPECT_EQ(set.load()->size(), 4U);
+  set.synchronize();
+  EXPECT_EQ(domain.pending(), 0U);
+}
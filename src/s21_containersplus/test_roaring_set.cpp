@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "roaring_set/s21_roaring_set.h"
+
+namespace {
+
+void ExpectSameContents(const s21::roaring_set &set,
+                        const std::set<std::uint32_t> &expected) {
+  ASSERT_EQ(set.size(), expected.size());
+  std::vector<std::uint32_t> values(set.begin(), set.end());
+  EXPECT_EQ(values,
+            std::vector<std::uint32_t>(expected.begin(), expected.end()));
+}
+
+// Значения всех трех видов контейнеров: редкие по всему диапазону, плотный
+// блок, который станет картой, и длинные серии
+std::set<std::uint32_t> MixedValues(std::uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::set<std::uint32_t> values;
+  for (int i = 0; i < 3000; ++i)
+    values.insert(static_cast<std::uint32_t>(gen()));
+  std::uint32_t block = (seed % 7U + 1U) << 16U;
+  for (int i = 0; i < 20000; ++i) values.insert(block + gen() % 65536U);
+  std::uint32_t run = (seed % 5U + 10U) << 16U;
+  for (std::uint32_t i = 0; i < 70000; ++i) values.insert(run + i);
+  for (std::uint32_t i = 0; i < 300; ++i) values.insert(run + 80000U + 3U * i);
+  values.insert(0);
+  values.insert(UINT32_MAX);
+  return values;
+}
+
+}  // namespace
+
+TEST(RoaringSetTest, Empty) {
+  s21::roaring_set set;
+  EXPECT_TRUE(set.empty());
+  EXPECT_TRUE(set.begin() == set.end());
+  EXPECT_FALSE(set.contains(0));
+  EXPECT_TRUE(set.lower_bound(7) == set.end());
+  EXPECT_EQ(set.erase(3), 0U);
+  EXPECT_TRUE((set | set).empty());
+  EXPECT_EQ(set.insert_range(5, 4), 0U);
+  EXPECT_TRUE(s21::roaring_set::deserialize(set.serialize()).empty());
+}
+
+TEST(RoaringSetTest, MatchesStdSet) {
+  std::mt19937 gen(70);
+  s21::roaring_set set;
+  std::set<std::uint32_t> expected;
+  // Значения из нескольких соседних блоков: массивы растут до карт и при
+  // удалении возвращаются в массивы
+  for (int step = 0; step < 60000; ++step) {
+    std::uint32_t value = gen() % (3U << 16U);
+    if (step % 5 == 4 || (step > 40000 && step % 2 == 0)) {
+      EXPECT_EQ(set.erase(value), expected.erase(value));
+    } else {
+      EXPECT_EQ(set.insert(value).second, expected.insert(value).second);
+    }
+  }
+  ExpectSameContents(set, expected);
+  for (std::uint32_t value = 0; value < (3U << 16U) + 10U; value += 7U) {
+    ASSERT_EQ(set.contains(value), expected.count(value) == 1) << value;
+    auto lower = expected.lower_bound(value);
+    auto it = set.lower_bound(value);
+    ASSERT_EQ(it == set.end(), lower == expected.end()) << value;
+    if (lower != expected.end()) {
+      ASSERT_EQ(*it, *lower);
+    }
+  }
+
+  std::vector<std::uint32_t> backwards;
+  for (auto it = set.end(); it != set.begin();) backwards.push_back(*--it);
+  EXPECT_TRUE(std::equal(backwards.begin(), backwards.end(),
+                         expected.rbegin(), expected.rend()));
+}
+
+TEST(RoaringSetTest, RangesAndRunOptimize) {
+  s21::roaring_set set;
+  EXPECT_EQ(set.insert_range(65530, 65545), 16U);
+  EXPECT_EQ(set.insert_range(65540, 65550), 5U);
+  EXPECT_EQ(set.insert_range(0, 0), 1U);
+  EXPECT_EQ(set.insert_range(UINT32_MAX - 1U, UINT32_MAX), 2U);
+  EXPECT_EQ(set.size(), 24U);
+  EXPECT_EQ(*set.upper_bound(0), 65530U);
+  EXPECT_TRUE(set.upper_bound(UINT32_MAX) == set.end());
+
+  // Миллион идентификаторов подряд - по одной серии на каждый из 16 блоков
+  s21::roaring_set range;
+  EXPECT_EQ(range.insert_range(1000, 1000999), 1000000U);
+  EXPECT_LT(range.serialized_size(), 300U);
+  EXPECT_TRUE(range.contains(1000999));
+  EXPECT_FALSE(range.contains(1001000));
+  EXPECT_EQ(range.erase(500000), 1U);
+  EXPECT_FALSE(range.contains(500000));
+  EXPECT_EQ(range.size(), 999999U);
+  EXPECT_TRUE(range.run_optimize());
+  EXPECT_LT(range.serialized_size(), 300U);
+  EXPECT_EQ(*range.lower_bound(500000), 500001U);
+  EXPECT_EQ(*--range.lower_bound(500000), 499999U);
+
+  std::set<std::uint32_t> values = MixedValues(1);
+  s21::roaring_set mixed(values.begin(), values.end());
+  std::size_t before = mixed.serialized_size();
+  EXPECT_TRUE(mixed.run_optimize());
+  EXPECT_LT(mixed.serialized_size(), before);
+  ExpectSameContents(mixed, values);
+  s21::roaring_set plain(values.begin(), values.end());
+  EXPECT_EQ(mixed, plain);
+  mixed.insert(((1U % 5U + 10U) << 16U) + 80001U);
+  EXPECT_NE(mixed, plain);
+}
+
+TEST(RoaringSetTest, SetOperationsMatchStd) {
+  std::set<std::uint32_t> first = MixedValues(2);
+  std::set<std::uint32_t> second = MixedValues(3);
+  // Общие элементы в массивах обоих множеств для пересечения SSE2
+  for (std::uint32_t i = 0; i < 4000; ++i) {
+    first.insert((20U << 16U) + 2U * i);
+    second.insert((20U << 16U) + 3U * i);
+  }
+  for (bool optimize : {false, true}) {
+    s21::roaring_set a(first.begin(), first.end());
+    s21::roaring_set b(second.begin(), second.end());
+    if (optimize) {
+      a.run_optimize();
+      b.run_optimize();
+    }
+    std::set<std::uint32_t> expected;
+    std::set_union(first.begin(), first.end(), second.begin(), second.end(),
+                   std::inserter(expected, expected.end()));
+    ExpectSameContents(a | b, expected);
+    expected.clear();
+    std::set_intersection(first.begin(), first.end(), second.begin(),
+                          second.end(),
+                          std::inserter(expected, expected.end()));
+    ExpectSameContents(a & b, expected);
+    expected.clear();
+    std::set_difference(first.begin(), first.end(), second.begin(),
+                        second.end(), std::inserter(expected, expected.end()));
+    ExpectSameContents(a - b, expected);
+    s21::roaring_set c = b;
+    c -= a;
+    EXPECT_EQ(c.size(), second.size() - (a & b).size());
+    c |= a;
+    EXPECT_EQ(c, a | b);
+    c &= a;
+    EXPECT_EQ(c, a);
+  }
+}
+
+TEST(RoaringSetTest, SerializeRoundTrip) {
+  std::set<std::uint32_t> values = MixedValues(4);
+  s21::roaring_set set(values.begin(), values.end());
+  set.insert_range(3000000000U, 3000100000U);
+  for (bool optimize : {false, true}) {
+    if (optimize) set.run_optimize();
+    std::vector<std::uint8_t> bytes = set.serialize();
+    EXPECT_EQ(bytes.size(), set.serialized_size());
+    s21::roaring_set loaded = s21::roaring_set::deserialize(bytes);
+    EXPECT_EQ(loaded, set);
+    EXPECT_EQ(loaded.size(), set.size());
+    EXPECT_TRUE(loaded.contains(3000050000U));
+  }
+
+  std::vector<std::uint8_t> bytes = set.serialize();
+  std::vector<std::uint8_t> truncated(bytes.begin(), bytes.end() - 1);
+  EXPECT_THROW(s21::roaring_set::deserialize(truncated), std::invalid_argument);
+  std::vector<std::uint8_t> longer = bytes;
+  longer.push_back(0);
+  EXPECT_THROW(s21::roaring_set::deserialize(longer), std::invalid_argument);
+  std::vector<std::uint8_t> bad_header = bytes;
+  bad_header[0] ^= 1U;
+  EXPECT_THROW(s21::roaring_set::deserialize(bad_header),
+               std::invalid_argument);
+
+  // Массив {1, 2}, записанный в обратном порядке
+  s21::roaring_set small = {1, 2};
+  std::vector<std::uint8_t> unsorted = small.serialize();
+  std::swap(unsorted[15], unsorted[17]);
+  EXPECT_THROW(s21::roaring_set::deserialize(unsorted), std::invalid_argument);
+}
+
+TEST(RoaringSetTest, ConvertsMergesSwaps) {
+  s21::set<std::uint32_t> tree = {5, 1, 4000000, 64, 63};
+  s21::roaring_set set(tree);
+  EXPECT_EQ(set, (s21::roaring_set{1, 5, 63, 64, 4000000}));
+  s21::set<std::uint32_t> back = set.to_set();
+  std::vector<std::uint32_t> values(back.begin(), back.end());
+  EXPECT_EQ(values, (std::vector<std::uint32_t>{1, 5, 63, 64, 4000000}));
+
+  s21::roaring_set other = {5, 6, 70000};
+  set.merge(other);
+  EXPECT_EQ(set, (s21::roaring_set{1, 5, 6, 63, 64, 70000, 4000000}));
+  EXPECT_EQ(other, (s21::roaring_set{5}));
+
+  s21::roaring_set moved(std::move(set));
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(moved.size(), 7U);
+  set.swap(moved);
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(*set.find(70000), 70000U);
+  EXPECT_TRUE(set.find(70001) == set.end());
+  set.erase(set.find(70000));
+  EXPECT_EQ(set.count(70000), 0U);
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_TRUE(set.begin() == set.end());
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../s21_containers/thread_pool/s21_thread_pool.h"
+#include "algorithm/s21_parallel_algorithm.h"
+#include "segmented_vector/s21_segmented_vector.h"
+
+TEST(SegmentedVectorTest, Empty) {
+  s21::segmented_vector<int> vec;
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(vec.capacity(), 0U);
+  EXPECT_EQ(vec.chunk_count(), 0U);
+  EXPECT_TRUE(vec.begin() == vec.end());
+  EXPECT_THROW(vec.at(0), std::out_of_range);
+  EXPECT_EQ(s21::segmented_vector<int>::chunk_capacity, 16384U);
+  using big = std::array<char, 100000>;
+  EXPECT_EQ(s21::segmented_vector<big>::chunk_capacity, 1U);
+}
+
+TEST(SegmentedVectorTest, GrowsWithoutMovingElements) {
+  s21::segmented_vector<std::string, 8> vec;
+  std::vector<const std::string *> addresses;
+  for (int i = 0; i < 100; ++i) {
+    addresses.push_back(&vec.emplace_back(std::to_string(i)));
+  }
+  EXPECT_EQ(vec.size(), 100U);
+  EXPECT_EQ(vec.capacity(), 104U);
+  EXPECT_EQ(vec.chunk_count(), 13U);
+  EXPECT_EQ(vec.chunk_size(12), 4U);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(&vec[i], addresses[i]);
+    ASSERT_EQ(vec.at(i), std::to_string(i));
+  }
+  EXPECT_EQ(vec.front(), "0");
+  EXPECT_EQ(vec.back(), "99");
+
+  vec.resize(20);
+  EXPECT_EQ(vec.back(), "19");
+  EXPECT_EQ(vec.capacity(), 104U);
+  vec.shrink_to_fit();
+  EXPECT_EQ(vec.capacity(), 24U);
+  EXPECT_EQ(&vec[19], addresses[19]);
+  vec.resize(30, "x");
+  EXPECT_EQ(vec[29], "x");
+  vec.pop_back();
+  EXPECT_EQ(vec.size(), 29U);
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(vec.capacity(), 32U);
+}
+
+TEST(SegmentedVectorTest, IteratorsAndCopies) {
+  s21::segmented_vector<int, 4> vec = {5, 3, 9, 1, 7, 2, 8};
+  std::sort(vec.begin(), vec.end());
+  EXPECT_EQ(std::vector<int>(vec.begin(), vec.end()),
+            (std::vector<int>{1, 2, 3, 5, 7, 8, 9}));
+  s21::segmented_vector<int, 4>::const_iterator it = vec.begin() + 3;
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(it - vec.begin(), 3);
+  EXPECT_TRUE(it < vec.end());
+  EXPECT_EQ(*std::lower_bound(vec.begin(), vec.end(), 6), 7);
+
+  s21::segmented_vector<int, 4> copy(vec);
+  copy[0] = 100;
+  EXPECT_EQ(vec[0], 1);
+  s21::segmented_vector<int, 4> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved[0], 100);
+  copy = moved;
+  EXPECT_EQ(copy.size(), 7U);
+  vec = std::move(moved);
+  EXPECT_EQ(vec[0], 100);
+  s21::segmented_vector<int, 4> filled(6, 2);
+  EXPECT_EQ(std::accumulate(filled.begin(), filled.end(), 0), 12);
+  EXPECT_EQ(s21::segmented_vector<int>(3)[2], 0);
+}
+
+TEST(SegmentedVectorTest, ChunksInParallel) {
+  s21::segmented_vector<long, 1024> vec;
+  for (long i = 0; i < 100000; ++i) vec.push_back(i);
+
+  // Каждый кусок - непрерывный массив: обрабатываем их независимо
+  s21::thread_pool pool(4);
+  std::atomic<long> sum{0};
+  pool.parallel_for(vec.chunk_count(), [&](std::size_t i) {
+    long *first = vec.chunk_data(i);
+    sum += std::accumulate(first, first + vec.chunk_size(i), 0L);
+  });
+  EXPECT_EQ(sum.load(), 99999L * 100000L / 2L);
+
+  std::size_t elements = 0;
+  vec.for_each_chunk([&](const long *first, const long *last) {
+    elements += static_cast<std::size_t>(last - first);
+  });
+  EXPECT_EQ(elements, vec.size());
+
+  // Итератор с произвольным доступом делится параллельными алгоритмами
+  s21::for_each(s21::execution::par.on(pool), vec.begin(), vec.end(),
+                [](long &x) { x *= 2; });
+  EXPECT_EQ(vec[99999], 199998L);
+
+  s21::segmented_vector<std::unique_ptr<int>, 2> owners;
+  owners.push_back(std::make_unique<int>(1));
+  owners.emplace_back(new int(2));
+  owners.push_back(std::make_unique<int>(3));
+  EXPECT_EQ(*owners.back(), 3);
+  EXPECT_EQ(*owners.begin()->get(), 1);
+}
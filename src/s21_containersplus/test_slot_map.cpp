@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "slot_map/s21_slot_map.h"
+
+namespace {
+
+// Перемещающее присваивание бросает исключение, пока fail = true
+struct ThrowingMove {
+  explicit ThrowingMove(int v) : value(v) {}
+  ThrowingMove(ThrowingMove &&other) = default;
+  ThrowingMove &operator=(ThrowingMove &&other) {
+    if (fail) throw std::runtime_error("move failed");
+    value = other.value;
+    return *this;
+  }
+
+  static bool fail;
+  int value;
+};
+
+bool ThrowingMove::fail = false;
+
+}  // namespace
+
+TEST(SlotMapTest, Empty) {
+  s21::slot_map<int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+  s21::slot_map<int>::key missing{0, 0};
+  EXPECT_FALSE(map.contains(missing));
+  EXPECT_TRUE(map.find(missing) == map.end());
+  EXPECT_THROW(map.at(missing), std::out_of_range);
+  EXPECT_EQ(map.erase(missing), 0U);
+}
+
+TEST(SlotMapTest, KeysSurviveErasure) {
+  s21::slot_map<std::string> map;
+  auto a = map.insert("a");
+  auto b = map.insert(std::string("b"));
+  auto c = map.emplace(3, 'c');
+  EXPECT_EQ(map.size(), 3U);
+  EXPECT_EQ(map.at(c), "ccc");
+
+  // b удаляется, c переезжает на его место, но ключ c не меняется
+  EXPECT_EQ(map.erase(b), 1U);
+  EXPECT_EQ(map.erase(b), 0U);
+  EXPECT_FALSE(map.contains(b));
+  EXPECT_EQ(map[a], "a");
+  EXPECT_EQ(map[c], "ccc");
+  EXPECT_EQ(map.size(), 2U);
+
+  // Освободившийся слот занят снова, но старый ключ недействителен
+  auto d = map.insert("d");
+  EXPECT_EQ(d.index, b.index);
+  EXPECT_NE(d, b);
+  EXPECT_FALSE(map.contains(b));
+  EXPECT_TRUE(map.find(b) == map.end());
+  EXPECT_EQ(*map.find(d), "d");
+
+  std::vector<std::string> values(map.begin(), map.end());
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ(values, (std::vector<std::string>{"a", "ccc", "d"}));
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    EXPECT_EQ(map.at(map.key_of(it)), *it);
+  }
+
+  // Ключ свободного слота с поколением, которое еще не выдавалось
+  map.erase(d);
+  EXPECT_FALSE(map.contains({d.index, d.generation + 1U}));
+}
+
+TEST(SlotMapTest, MatchesReferenceMap) {
+  std::mt19937 gen(72);
+  s21::slot_map<std::unique_ptr<int>> map;
+  std::map<int, s21::slot_map<std::unique_ptr<int>>::key> expected;
+  std::vector<s21::slot_map<std::unique_ptr<int>>::key> dead;
+  for (int step = 0; step < 20000; ++step) {
+    if (!expected.empty() && gen() % 3 == 0) {
+      auto it = expected.begin();
+      std::advance(it, gen() % expected.size());
+      ASSERT_EQ(**map.find(it->second), it->first);
+      if (step % 2 == 0) {
+        EXPECT_EQ(map.erase(it->second), 1U);
+      } else {
+        map.erase(map.find(it->second));
+      }
+      dead.push_back(it->second);
+      expected.erase(it);
+    } else {
+      expected[step] = map.emplace(new int(step));
+    }
+  }
+  ASSERT_EQ(map.size(), expected.size());
+  for (const auto &item : expected) EXPECT_EQ(*map.at(item.second), item.first);
+  for (const auto &k : dead) EXPECT_FALSE(map.contains(k));
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  for (const auto &item : expected) EXPECT_FALSE(map.contains(item.second));
+}
+
+TEST(SlotMapTest, CopyMoveSwap) {
+  s21::slot_map<int> map = {1, 2, 3};
+  auto k = map.key_of(map.begin() + 1);
+  s21::slot_map<int> copy(map);
+  copy[k] = 20;
+  EXPECT_EQ(map[k], 2);
+  s21::slot_map<int> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.at(k), 20);
+  map.swap(moved);
+  EXPECT_EQ(map.at(k), 20);
+  EXPECT_EQ(moved.at(k), 2);
+  moved = map;
+  EXPECT_EQ(moved.at(k), 20);
+  map.reserve(100);
+  EXPECT_GE(map.capacity(), 100U);
+  EXPECT_EQ(map.at(k), 20);
+}
+
+TEST(SlotMapTest, FailedEraseKeepsSlotsConsistent) {
+  s21::slot_map<ThrowingMove> map;
+  auto first = map.emplace(1);
+  auto second = map.emplace(2);
+  ThrowingMove::fail = true;
+  EXPECT_THROW(map.erase(first), std::runtime_error);
+  ThrowingMove::fail = false;
+  // Ключ не освобожден, и новое значение не занимает его слот
+  EXPECT_TRUE(map.contains(first));
+  auto third = map.emplace(3);
+  EXPECT_NE(third.index, first.index);
+  EXPECT_EQ(map.at(second).value, 2);
+  EXPECT_EQ(map.erase(first), 1U);
+  EXPECT_FALSE(map.contains(first));
+  EXPECT_EQ(map.at(third).value, 3);
+  EXPECT_EQ(map.size(), 2U);
+}
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "soa_vector/s21_soa_vector.h"
+
+namespace {
+
+// Копирование бросает, если throws == true; перемещение может бросать,
+// поэтому при перевыделении поле копируется, а erase не сдвигает столбцы на
+// месте
+struct ThrowingCopy {
+  static inline bool throws = false;
+  explicit ThrowingCopy(int v) : value(v) {}
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+    if (throws) throw std::runtime_error("copy");
+  }
+  ThrowingCopy(ThrowingCopy &&other) : value(other.value) {}
+  ThrowingCopy &operator=(const ThrowingCopy &other) {
+    if (throws) throw std::runtime_error("assign");
+    value = other.value;
+    return *this;
+  }
+  int value;
+};
+
+}  // namespace
+
+TEST(SoaVectorTest, Empty) {
+  s21::soa_vector<int, double> table;
+  EXPECT_TRUE(table.empty());
+  EXPECT_TRUE(table.begin() == table.end());
+  EXPECT_TRUE(table.column<1>().empty());
+  EXPECT_THROW(table.at(0), std::out_of_range);
+}
+
+TEST(SoaVectorTest, RowsAndColumns) {
+  s21::soa_vector<int, std::string, double> table;
+  for (int i = 0; i < 100; ++i)
+    table.push_back(i, std::to_string(i), i / 2.0);
+  table.emplace_back(100, std::string(3, 'x'), 50.0);
+  // Поля собственной строки при перевыделении
+  table.shrink_to_fit();
+  table.push_back(table.get<0>(1), table.get<1>(1), table.get<2>(1));
+  EXPECT_EQ(table.get<1>(101), "1");
+  table.pop_back();
+  ASSERT_EQ(table.size(), 101U);
+  EXPECT_GE(table.capacity(), 101U);
+  EXPECT_EQ(table.get<1>(100), "xxx");
+
+  // Столбцы - непрерывные массивы
+  auto ids = table.column<0>();
+  EXPECT_EQ(ids.size(), 101U);
+  EXPECT_EQ(std::accumulate(ids.begin(), ids.end(), 0), 5050);
+  auto halves = table.column<2>();
+  EXPECT_EQ(&halves[1] - &halves[0], 1);
+  for (double &half : table.column<2>()) half *= 2;
+  EXPECT_EQ(table.get<2>(7), 7.0);
+
+  // Прокси-ссылка на строку
+  auto [id, name, value] = table[5];
+  EXPECT_EQ(id, 5);
+  name = "five";
+  value = -1;
+  EXPECT_EQ(table.get<1>(5), "five");
+  EXPECT_EQ(table.get<2>(5), -1.0);
+  std::tuple<int, std::string, double> row = table.at(5);
+  std::get<1>(row) = "copy";
+  EXPECT_EQ(table.get<1>(5), "five");
+
+  const auto &view = table;
+  EXPECT_EQ(std::get<0>(view[6]), 6);
+  EXPECT_EQ(view.column<1>()[6], "6");
+}
+
+TEST(SoaVectorTest, Iterators) {
+  s21::soa_vector<int, int> table = {{1, 10}, {2, 20}, {3, 30}, {4, 40}};
+  int sum = 0;
+  for (auto row : table) {
+    sum += std::get<0>(row) * std::get<1>(row);
+    std::get<1>(row) += 1;
+  }
+  EXPECT_EQ(sum, 300);
+  EXPECT_EQ(table.get<1>(3), 41);
+
+  auto it = table.begin();
+  s21::soa_vector<int, int>::const_iterator cit = it + 2;
+  EXPECT_EQ(std::get<0>(*cit), 3);
+  EXPECT_EQ(table.end() - table.begin(), 4);
+  EXPECT_EQ(std::get<0>(it[3]), 4);
+  EXPECT_TRUE(it < cit);
+  auto found = std::find_if(table.begin(), table.end(), [](const auto &row) {
+    return std::get<1>(row) == 21;
+  });
+  EXPECT_EQ(found - table.begin(), 1);
+}
+
+TEST(SoaVectorTest, EraseResizeCopy) {
+  s21::soa_vector<int, std::string> table;
+  for (int i = 0; i < 10; ++i) table.push_back(i, std::to_string(i));
+  auto it = table.erase(table.begin() + 2, table.begin() + 5);
+  EXPECT_EQ(std::get<0>(*it), 5);
+  it = table.erase(table.begin());
+  EXPECT_EQ(std::get<1>(*it), "1");
+  EXPECT_EQ(table.size(), 6U);
+  EXPECT_THROW(table.erase(table.begin() + 3, table.begin() + 9),
+               std::out_of_range);
+  table.pop_back();
+  EXPECT_EQ(table.get<0>(table.size() - 1U), 8);
+
+  table.resize(8);
+  EXPECT_EQ(table.get<0>(7), 0);
+  EXPECT_EQ(table.get<1>(7), "");
+  table.resize(2);
+  EXPECT_EQ(table.column<1>().size(), 2U);
+
+  s21::soa_vector<int, std::string> copy(table);
+  copy.get<1>(0) = "changed";
+  EXPECT_EQ(table.get<1>(0), "1");
+  s21::soa_vector<int, std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.get<1>(0), "changed");
+  moved.swap(table);
+  EXPECT_EQ(table.get<1>(0), "changed");
+  table.clear();
+  EXPECT_TRUE(table.empty());
+  table.shrink_to_fit();
+  EXPECT_EQ(table.capacity(), 0U);
+
+  s21::soa_vector<double, double> sized(5);
+  EXPECT_EQ(sized.size(), 5U);
+  EXPECT_EQ(sized.get<1>(4), 0.0);
+}
+
+TEST(SoaVectorTest, FailedReserveKeepsColumnsInSync) {
+  s21::soa_vector<std::string, ThrowingCopy> table;
+  for (int i = 0; i < 3; ++i) table.emplace_back(std::to_string(i), i);
+  const std::string *names = table.column<0>().data();
+  std::size_t capacity = table.capacity();
+
+  ThrowingCopy::throws = true;
+  EXPECT_THROW(table.reserve(capacity + 10U), std::runtime_error);
+  ThrowingCopy::throws = false;
+  EXPECT_EQ(table.capacity(), capacity);
+  EXPECT_EQ(table.column<0>().data(), names);
+  EXPECT_EQ(table.get<0>(2), "2");
+  EXPECT_EQ(table.get<1>(2).value, 2);
+
+  table.reserve(capacity + 10U);
+  EXPECT_EQ(table.capacity(), capacity + 10U);
+  EXPECT_EQ(table.get<0>(2), "2");
+  for (int i = 3; i < 13; ++i) table.emplace_back(std::to_string(i), i);
+  EXPECT_EQ(table.capacity(), capacity + 10U);
+  EXPECT_EQ(table.get<1>(12).value, 12);
+}
+
+TEST(SoaVectorTest, FailedEraseKeepsColumnsInSync) {
+  s21::soa_vector<std::string, ThrowingCopy> table;
+  for (int i = 0; i < 6; ++i) table.emplace_back(std::to_string(i), i);
+  table.reserve(10);
+
+  ThrowingCopy::throws = true;
+  EXPECT_THROW(table.erase(table.begin() + 1, table.begin() + 3),
+               std::runtime_error);
+  EXPECT_THROW(table.shrink_to_fit(), std::runtime_error);
+  ThrowingCopy::throws = false;
+  ASSERT_EQ(table.column<0>().size(), 6U);
+  ASSERT_EQ(table.column<1>().size(), 6U);
+  EXPECT_EQ(table.capacity(), 10U);
+  EXPECT_EQ(table.get<0>(5), "5");
+  EXPECT_EQ(table.get<1>(5).value, 5);
+
+  auto it = table.erase(table.begin() + 1, table.begin() + 3);
+  EXPECT_EQ(it - table.begin(), 1);
+  ASSERT_EQ(table.column<0>().size(), 4U);
+  ASSERT_EQ(table.column<1>().size(), 4U);
+  EXPECT_EQ(table.capacity(), 10U);
+  for (std::size_t i = 0; i < 4; ++i) {
+    int expected = i == 0 ? 0 : static_cast<int>(i) + 2;
+    EXPECT_EQ(table.get<0>(i), std::to_string(expected));
+    EXPECT_EQ(table.get<1>(i).value, expected);
+  }
+
+  table.shrink_to_fit();
+  EXPECT_EQ(table.capacity(), 4U);
+  EXPECT_EQ(table.get<1>(3).value, 5);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "static_map/s21_static_map.h"
+
+namespace {
+
+bool Descending(int lhs, int rhs) { return lhs > rhs; }
+
+// Сравнение по остатку от деления: состояние компаратора важно для порядка
+struct ModuloLess {
+  int mod;
+  bool operator()(int lhs, int rhs) const { return lhs % mod < rhs % mod; }
+};
+
+}  // namespace
+
+TEST(StaticMapTest, Empty) {
+  s21::static_map<int, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+  EXPECT_THROW(map.at(1), std::out_of_range);
+}
+
+TEST(StaticMapTest, InitializerListKeepsFirstDuplicate) {
+  s21::static_map<int, std::string> map = {
+      {3, "three"}, {1, "one"}, {3, "drei"}, {2, "two"}};
+  EXPECT_EQ(map.size(), 3U);
+  EXPECT_EQ(map.at(3), "three");
+  std::vector<int> keys;
+  for (auto item : map) keys.push_back(item.first);
+  EXPECT_EQ(keys, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(StaticMapTest, FromMapAndModifyValues) {
+  s21::map<int, int> source = {{5, 50}, {1, 10}, {3, 30}};
+  s21::static_map<int, int> map(source);
+  EXPECT_EQ(map.size(), 3U);
+  map.at(3) = 33;
+  (*map.find(5)).second += 5;
+  EXPECT_EQ(map.at(1), 10);
+  EXPECT_EQ(map.at(3), 33);
+  EXPECT_EQ(map.at(5), 55);
+  EXPECT_THROW(map.at(2), std::out_of_range);
+  EXPECT_TRUE(map.find(2) == map.end());
+  EXPECT_FALSE(map.contains(4));
+}
+
+TEST(StaticMapTest, FromMapWithComparatorAndStorage) {
+  s21::map<int, int, std::greater<int>> source = {{1, 10}, {2, 20}, {3, 30}};
+  s21::static_map<int, int, std::greater<int>> greater(source);
+  EXPECT_EQ(greater.at(2), 20);
+  EXPECT_EQ((*greater.begin()).first, 3);
+
+  s21::map<int, int, std::less<int>,
+           s21::tree_policy<s21::RedBlackTreeCompactLayout>>
+      compact = {{4, 40}, {1, 10}};
+  s21::static_map<int, int> map(compact);
+  EXPECT_EQ(map.at(4), 40);
+  EXPECT_EQ((*map.begin()).first, 1);
+}
+
+TEST(StaticMapTest, KeepsComparatorState) {
+  // Указатель на функцию берется из исходного словаря, а не обнуляется
+  s21::map<int, int, bool (*)(int, int)> source(&Descending);
+  source.insert(1, 10);
+  source.insert(2, 20);
+  s21::static_map<int, int, bool (*)(int, int)> descending(source);
+  EXPECT_EQ(descending.key_comp(), &Descending);
+  EXPECT_EQ(descending.at(1), 10);
+  EXPECT_EQ((*descending.begin()).first, 2);
+
+  s21::static_map<int, int, ModuloLess> modulo({{13, 1}, {4, 2}, {22, 3}},
+                                               ModuloLess{10});
+  EXPECT_EQ(modulo.key_comp().mod, 10);
+  EXPECT_EQ((*modulo.begin()).first, 22);
+  EXPECT_EQ(modulo.at(3), 1);
+  s21::static_map<int, int, ModuloLess> moved(std::move(modulo));
+  EXPECT_EQ(moved.at(104), 2);
+}
+
+TEST(StaticMapTest, MatchesStdMap) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> dist(0, 1000);
+  for (std::size_t n : {1U, 5U, 64U, 777U}) {
+    std::vector<std::pair<int, int>> items;
+    for (std::size_t i = 0; i < n; ++i) {
+      int key = dist(gen) * 2;
+      items.emplace_back(key, key + 1);
+    }
+    std::map<int, int> expected(items.begin(), items.end());
+    s21::static_map<int, int> map(items.begin(), items.end());
+    ASSERT_EQ(map.size(), expected.size());
+
+    for (int key = -1; key <= 2002; ++key) {
+      auto lower = expected.lower_bound(key);
+      auto it = map.lower_bound(key);
+      if (lower == expected.end()) {
+        EXPECT_TRUE(it == map.end());
+      } else {
+        ASSERT_TRUE(it != map.end());
+        EXPECT_EQ((*it).first, lower->first);
+        EXPECT_EQ((*it).second, lower->second);
+      }
+      auto upper = expected.upper_bound(key);
+      it = map.upper_bound(key);
+      EXPECT_EQ(it == map.end(), upper == expected.end());
+      EXPECT_EQ(map.contains(key), expected.count(key) == 1);
+    }
+  }
+}
+
+TEST(StaticMapTest, ConstIteration) {
+  const s21::static_map<int, int> map = {{2, 4}, {1, 2}, {3, 6}};
+  int sum = 0;
+  for (s21::static_map<int, int>::const_iterator it = map.begin();
+       it != map.end(); ++it)
+    sum += (*it).first * (*it).second;
+  EXPECT_EQ(sum, 2 + 8 + 18);
+  auto last = map.end();
+  --last;
+  EXPECT_EQ((*last).first, 3);
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "static_set/s21_static_set.h"
+
+namespace {
+
+bool Descending(int lhs, int rhs) { return lhs > rhs; }
+
+// Сравнение по остатку от деления: состояние компаратора важно для порядка
+struct ModuloLess {
+  int mod;
+  bool operator()(int lhs, int rhs) const { return lhs % mod < rhs % mod; }
+};
+
+}  // namespace
+
+TEST(StaticSetTest, Empty) {
+  s21::static_set<int> set;
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.size(), 0U);
+  EXPECT_TRUE(set.begin() == set.end());
+  EXPECT_FALSE(set.contains(1));
+  EXPECT_TRUE(set.find(1) == set.end());
+  EXPECT_TRUE(set.lower_bound(1) == set.end());
+}
+
+TEST(StaticSetTest, InitializerListSortsAndRemovesDuplicates) {
+  s21::static_set<int> set = {5, 1, 3, 5, 2, 1};
+  EXPECT_EQ(set.size(), 4U);
+  std::vector<int> items(set.begin(), set.end());
+  EXPECT_EQ(items, (std::vector<int>{1, 2, 3, 5}));
+  EXPECT_EQ(set.count(3), 1U);
+  EXPECT_EQ(set.count(4), 0U);
+}
+
+TEST(StaticSetTest, FromSet) {
+  s21::set<int> source = {7, 3, 9, 1};
+  s21::static_set<int> set(source);
+  EXPECT_EQ(set.size(), source.size());
+  auto it = source.begin();
+  for (int key : set) EXPECT_EQ(key, *it++);
+}
+
+TEST(StaticSetTest, FromSetWithComparatorAndStorage) {
+  s21::set<int, std::greater<int>> source = {1, 2, 3, 4, 5, 6, 7};
+  s21::static_set<int, std::greater<int>> greater(source);
+  EXPECT_TRUE(greater.contains(3));
+  EXPECT_FALSE(greater.contains(8));
+  EXPECT_EQ(*greater.begin(), 7);
+  EXPECT_EQ(*greater.lower_bound(4), 4);
+
+  s21::set<int, std::less<int>, s21::RedBlackTreeCompactLayout> compact = {
+      9, 2, 5};
+  s21::static_set<int> set(compact);
+  EXPECT_EQ(std::vector<int>(set.begin(), set.end()),
+            (std::vector<int>{2, 5, 9}));
+}
+
+TEST(StaticSetTest, KeepsComparatorState) {
+  // Указатель на функцию берется из исходного множества, а не обнуляется
+  s21::set<int, bool (*)(int, int)> source(&Descending);
+  for (int key : {3, 1, 2}) source.insert(key);
+  s21::static_set<int, bool (*)(int, int)> descending(source);
+  EXPECT_EQ(descending.key_comp(), &Descending);
+  EXPECT_TRUE(descending.contains(2));
+  EXPECT_EQ(std::vector<int>(descending.begin(), descending.end()),
+            (std::vector<int>{3, 2, 1}));
+
+  s21::static_set<int, ModuloLess> modulo({13, 4, 22}, ModuloLess{10});
+  EXPECT_EQ(modulo.key_comp().mod, 10);
+  EXPECT_EQ(std::vector<int>(modulo.begin(), modulo.end()),
+            (std::vector<int>{22, 13, 4}));
+  EXPECT_TRUE(modulo.contains(3));
+  s21::static_set<int, ModuloLess> copy(modulo);
+  EXPECT_EQ(*copy.find(102), 22);
+
+  // Компаратор без состояния не занимает места
+  EXPECT_EQ(sizeof(s21::static_set<int>),
+            sizeof(s21::vector<int>) + sizeof(std::size_t));
+}
+
+TEST(StaticSetTest, MatchesStdSet) {
+  std::mt19937 gen(21);
+  std::uniform_int_distribution<int> dist(0, 2000);
+  // Размеры, не являющиеся степенью двойки, и полные деревья
+  for (std::size_t n : {1U, 2U, 3U, 7U, 8U, 100U, 1023U, 1024U, 1500U}) {
+    std::vector<int> keys;
+    for (std::size_t i = 0; i < n; ++i) keys.push_back(dist(gen) * 2);
+    std::set<int> expected(keys.begin(), keys.end());
+    s21::static_set<int> set(keys.begin(), keys.end());
+    ASSERT_EQ(set.size(), expected.size());
+
+    for (int key = -1; key <= 4002; ++key) {
+      auto lower = expected.lower_bound(key);
+      auto it = set.lower_bound(key);
+      if (lower == expected.end()) {
+        EXPECT_TRUE(it == set.end());
+      } else {
+        ASSERT_TRUE(it != set.end());
+        EXPECT_EQ(*it, *lower);
+      }
+      auto upper = expected.upper_bound(key);
+      it = set.upper_bound(key);
+      if (upper == expected.end()) {
+        EXPECT_TRUE(it == set.end());
+      } else {
+        ASSERT_TRUE(it != set.end());
+        EXPECT_EQ(*it, *upper);
+      }
+      EXPECT_EQ(set.contains(key), expected.count(key) == 1);
+    }
+  }
+}
+
+TEST(StaticSetTest, ReverseIteration) {
+  s21::static_set<int> set = {4, 8, 15, 16, 23, 42};
+  std::vector<int> items;
+  auto it = set.end();
+  while (it != set.begin()) items.push_back(*--it);
+  EXPECT_EQ(items, (std::vector<int>{42, 23, 16, 15, 8, 4}));
+}
+
+TEST(StaticSetTest, CopyAndMove) {
+  s21::static_set<int> set = {1, 2, 3};
+  s21::static_set<int> copy(set);
+  s21::static_set<int> moved(std::move(set));
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_EQ(moved.size(), 3U);
+  EXPECT_TRUE(set.empty());
+  copy = s21::static_set<int>{10};
+  EXPECT_EQ(copy.size(), 1U);
+  EXPECT_TRUE(copy.contains(10));
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "static_vector/s21_static_vector.h"
+
+namespace {
+
+// Вычисляется на этапе компиляции: вставки, удаления и копирование
+constexpr int ConstexprSum() {
+  s21::static_vector<int, 8> vec = {1, 2, 3};
+  vec.push_back(5);
+  vec.insert(vec.begin(), 10);
+  vec.insert_many(vec.begin() + 2, 20, 30);
+  vec.erase(vec.begin() + 1);
+  vec.insert_many_back(7);
+  s21::static_vector<int, 8> copy = vec;
+  copy.pop_back();
+  int sum = 0;
+  for (int x : copy) sum = sum * 10 + x % 10;
+  return sum + static_cast<int>(copy.size()) * 1000000;
+}
+
+static_assert(ConstexprSum() == 6000235, "constexpr static_vector");
+static_assert(std::is_trivially_copyable_v<s21::static_vector<int, 4>>);
+static_assert(std::is_trivially_destructible_v<s21::static_vector<int, 4>>);
+static_assert(sizeof(s21::static_vector<int, 16>) ==
+              16 * sizeof(int) + sizeof(std::size_t));
+
+struct Throwing {
+  explicit Throwing(int v) : value(v) {
+    if (v < 0) throw std::runtime_error("negative");
+  }
+  int value;
+};
+
+}  // namespace
+
+TEST(StaticVectorTest, StoresElementsInline) {
+  s21::static_vector<std::string, 4> vec;
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(vec.capacity(), 4U);
+  const char *object = reinterpret_cast<const char *>(&vec);
+  const char *data = reinterpret_cast<const char *>(vec.data());
+  EXPECT_TRUE(data >= object && data < object + sizeof(vec));
+
+  vec.push_back("a");
+  std::string b = "b";
+  vec.push_back(b);
+  EXPECT_EQ(vec.emplace_back(3, 'c'), "ccc");
+  vec.insert_many_back("d");
+  EXPECT_TRUE(vec.full());
+  EXPECT_THROW(vec.push_back("e"), std::length_error);
+  EXPECT_THROW(vec.insert_many_back("e"), std::length_error);
+  EXPECT_THROW(vec.reserve(5), std::length_error);
+  EXPECT_EQ(vec.size(), 4U);
+  EXPECT_EQ(vec.at(2), "ccc");
+  EXPECT_THROW(vec.at(4), std::out_of_range);
+  EXPECT_EQ(vec.front(), "a");
+  EXPECT_EQ(vec.back(), "d");
+}
+
+TEST(StaticVectorTest, InsertsAndErases) {
+  s21::static_vector<std::string, 10> vec = {"1", "2", "3"};
+  EXPECT_EQ(*vec.insert(vec.begin() + 1, "x"), "x");
+  auto it = vec.insert_many(vec.end() - 1, "y", "z");
+  EXPECT_EQ(it - vec.begin(), 3);
+  // Аргумент - ссылка на элемент этого же вектора
+  vec.insert(vec.begin(), vec.back());
+  EXPECT_EQ(std::vector<std::string>(vec.begin(), vec.end()),
+            (std::vector<std::string>{"3", "1", "x", "2", "y", "z", "3"}));
+  EXPECT_THROW(vec.insert(vec.end() + 1, "w"), std::out_of_range);
+
+  EXPECT_EQ(*vec.erase(vec.begin() + 1, vec.begin() + 3), "2");
+  vec.erase(vec.begin());
+  EXPECT_EQ(std::vector<std::string>(vec.begin(), vec.end()),
+            (std::vector<std::string>{"2", "y", "z", "3"}));
+  EXPECT_EQ(s21::erase_if(vec, [](const std::string &s) { return s < "a"; }),
+            2U);
+  EXPECT_EQ(vec.size(), 2U);
+  EXPECT_EQ(vec[1], "z");
+
+  vec.resize(5, "q");
+  EXPECT_EQ(vec[4], "q");
+  vec.resize(1);
+  EXPECT_EQ(vec.size(), 1U);
+  EXPECT_THROW(vec.resize(11), std::length_error);
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+}
+
+TEST(StaticVectorTest, CopiesMovesSwaps) {
+  s21::static_vector<std::unique_ptr<int>, 4> owners;
+  owners.push_back(std::make_unique<int>(1));
+  owners.emplace_back(new int(2));
+  s21::static_vector<std::unique_ptr<int>, 4> moved(std::move(owners));
+  EXPECT_EQ(*moved[1], 2);
+  EXPECT_EQ(owners.size(), 2U);
+  EXPECT_EQ(owners[0], nullptr);
+  owners = std::move(moved);
+  EXPECT_EQ(*owners[0], 1);
+
+  s21::static_vector<std::string, 5> a = {"a", "b", "c"};
+  s21::static_vector<std::string, 5> b(2, "z");
+  s21::static_vector<std::string, 5> c = a;
+  c = b;
+  EXPECT_EQ(c.size(), 2U);
+  EXPECT_EQ(c[1], "z");
+  a.swap(b);
+  EXPECT_EQ(a.size(), 2U);
+  EXPECT_EQ(b[2], "c");
+  EXPECT_EQ((s21::static_vector<int, 3>(2)[1]), 0);
+}
+
+TEST(StaticVectorTest, FailedInsertLeavesVectorUnchanged) {
+  s21::static_vector<Throwing, 6> vec;
+  vec.emplace_back(1);
+  vec.emplace_back(2);
+  EXPECT_THROW(vec.insert_many(vec.begin(), 3, -1, 4), std::runtime_error);
+  EXPECT_EQ(vec.size(), 2U);
+  EXPECT_EQ(vec[0].value, 1);
+  EXPECT_THROW(vec.insert_many_back(3, 4, 5, 6, 7), std::length_error);
+  EXPECT_EQ(vec.size(), 2U);
+  vec.insert_many(vec.begin() + 1, 5, 6);
+  EXPECT_EQ(vec[1].value, 5);
+  EXPECT_EQ(vec[3].value, 2);
+}